@@ -18,12 +18,21 @@ verovio.vrvToolkit.editInfo = Module.cwrap( 'vrvToolkit_editInfo', 'string', ['n
 // char *getAvailableOptions(Toolkit *ic)
 verovio.vrvToolkit.getAvailableOptions = Module.cwrap( 'vrvToolkit_getAvailableOptions', 'string', ['number'] );
 
+// char *getCastOffCache(Toolkit *ic)
+verovio.vrvToolkit.getCastOffCache = Module.cwrap( 'vrvToolkit_getCastOffCache', 'string', ['number'] );
+
 // char *getElementAttr(Toolkit *ic, const char *xmlId)
 verovio.vrvToolkit.getElementAttr = Module.cwrap( 'vrvToolkit_getElementAttr', 'string', ['number', 'string'] );
 
+// char *getElementsAtPoint(Toolkit *ic, int pageNo, int x, int y)
+verovio.vrvToolkit.getElementsAtPoint = Module.cwrap( 'vrvToolkit_getElementsAtPoint', 'string', ['number', 'number', 'number', 'number'] );
+
 // char *getElementsAtTime(Toolkit *ic, int time)
 verovio.vrvToolkit.getElementsAtTime = Module.cwrap( 'vrvToolkit_getElementsAtTime', 'string', ['number', 'number'] );
 
+// char *getElementsInRect(Toolkit *ic, int pageNo, int x, int y, int width, int height)
+verovio.vrvToolkit.getElementsInRect = Module.cwrap( 'vrvToolkit_getElementsInRect', 'string', ['number', 'number', 'number', 'number', 'number', 'number'] );
+
 // char *vrvToolkit_getExpansionIdsForElement(Toolkit *tk, const char *xmlId);
 verovio.vrvToolkit.getExpansionIdsForElement = Module.cwrap( 'vrvToolkit_getExpansionIdsForElement', 'string', ['number', 'string'] );
 
@@ -36,6 +45,9 @@ verovio.vrvToolkit.getLog = Module.cwrap( 'vrvToolkit_getLog', 'string', ['numbe
 // char *getMEI(Toolkit *ic, const char *options)
 verovio.vrvToolkit.getMEI = Module.cwrap( 'vrvToolkit_getMEI', 'string', ['number', 'string'] );
 
+// char *getMemoryUsage(Toolkit *ic)
+verovio.vrvToolkit.getMemoryUsage = Module.cwrap( 'vrvToolkit_getMemoryUsage', 'string', ['number'] );
+
 // char *vrvToolkit_getNotatedIdForElement(Toolkit *tk, const char *xmlId);
 verovio.vrvToolkit.getNotatedIdForElement = Module.cwrap( 'vrvToolkit_getNotatedIdForElement', 'string', ['number', 'string'] );
 
@@ -48,6 +60,9 @@ verovio.vrvToolkit.getPageCount = Module.cwrap( 'vrvToolkit_getPageCount', 'numb
 // int getPageWithElement(Toolkit *ic, const char *xmlId)
 verovio.vrvToolkit.getPageWithElement = Module.cwrap( 'vrvToolkit_getPageWithElement', 'number', ['number', 'string'] );
 
+// char *getSVGCacheStats(Toolkit *ic)
+verovio.vrvToolkit.getSVGCacheStats = Module.cwrap( 'vrvToolkit_getSVGCacheStats', 'string', ['number'] );
+
 // double getTimeForElement(Toolkit *ic, const char *xmlId)
 verovio.vrvToolkit.getTimeForElement = Module.cwrap( 'vrvToolkit_getTimeForElement', 'number', ['number', 'string'] );
 
@@ -57,12 +72,24 @@ verovio.vrvToolkit.getMIDIValuesForElement = Module.cwrap( 'vrvToolkit_getMIDIVa
 // char *getVersion(Toolkit *ic)
 verovio.vrvToolkit.getVersion = Module.cwrap( 'vrvToolkit_getVersion', 'string', ['number'] );
 
+// char *getWorks(Toolkit *ic, const char *data)
+verovio.vrvToolkit.getWorks = Module.cwrap( 'vrvToolkit_getWorks', 'string', ['number', 'string'] );
+
+// bool isPageCountFinal(Toolkit *ic)
+verovio.vrvToolkit.isPageCountFinal = Module.cwrap( 'vrvToolkit_isPageCountFinal', 'number', ['number'] );
+
+// bool loadCastOffCache(Toolkit *ic, const char *cache)
+verovio.vrvToolkit.loadCastOffCache = Module.cwrap( 'vrvToolkit_loadCastOffCache', 'number', ['number', 'string'] );
+
 // bool loadData(Toolkit *ic, const char *data)
 verovio.vrvToolkit.loadData = Module.cwrap( 'vrvToolkit_loadData', 'number', ['number', 'string'] );
 
 // void redoLayout(Toolkit *ic)
 verovio.vrvToolkit.redoLayout = Module.cwrap( 'vrvToolkit_redoLayout', null, ['number'] );
 
+// void redoLayoutWithOptions(Toolkit *ic, const char *options)
+verovio.vrvToolkit.redoLayoutWithOptions = Module.cwrap( 'vrvToolkit_redoLayoutWithOptions', null, ['number', 'string'] );
+
 // void redoPagePitchPosLayout(Toolkit *ic)
 verovio.vrvToolkit.redoPagePitchPosLayout = Module.cwrap( 'vrvToolkit_redoPagePitchPosLayout', null, ['number'] );
 
@@ -75,12 +102,24 @@ verovio.vrvToolkit.renderToMIDI = Module.cwrap( 'vrvToolkit_renderToMIDI', 'stri
 // char *renderToSvg(Toolkit *ic, int pageNo, const char *rendering_options)
 verovio.vrvToolkit.renderToSVG = Module.cwrap( 'vrvToolkit_renderToSVG', 'string', ['number', 'number', 'string'] );
 
+// char *renderToSVGDiff(Toolkit *ic, int pageNo)
+verovio.vrvToolkit.renderToSVGDiff = Module.cwrap( 'vrvToolkit_renderToSVGDiff', 'string', ['number', 'number'] );
+
+// char *renderToSVGRegion(Toolkit *ic, int pageNo, int x, int y, int width, int height)
+verovio.vrvToolkit.renderToSVGRegion = Module.cwrap( 'vrvToolkit_renderToSVGRegion', 'string', ['number', 'number', 'number', 'number', 'number', 'number'] );
+
 // char *renderToTimemap(Toolkit *ic)
 verovio.vrvToolkit.renderToTimemap = Module.cwrap( 'vrvToolkit_renderToTimemap', 'string', ['number'] );
 
+// char *renderToTimemapWithOptions(Toolkit *ic, const char *options)
+verovio.vrvToolkit.renderToTimemapWithOptions = Module.cwrap( 'vrvToolkit_renderToTimemapWithOptions', 'string', ['number', 'string'] );
+
 // void setOptions(Toolkit *ic, const char *options) 
 verovio.vrvToolkit.setOptions = Module.cwrap( 'vrvToolkit_setOptions', null, ['number', 'string'] );
 
+// bool switchSelection(Toolkit *ic, const char *selection)
+verovio.vrvToolkit.switchSelection = Module.cwrap( 'vrvToolkit_switchSelection', 'number', ['number', 'string'] );
+
 // A pointer to the object - only one instance can be created for now
 verovio.instances = [];
 
@@ -115,16 +154,31 @@ verovio.toolkit.prototype.getAvailableOptions = function ()
     return JSON.parse( verovio.vrvToolkit.getAvailableOptions( this.ptr ) );
 };
 
+verovio.toolkit.prototype.getCastOffCache = function ()
+{
+    return verovio.vrvToolkit.getCastOffCache( this.ptr );
+};
+
 verovio.toolkit.prototype.getElementAttr = function ( xmlId )
 {
     return JSON.parse( verovio.vrvToolkit.getElementAttr( this.ptr, xmlId ) );
 };
 
+verovio.toolkit.prototype.getElementsAtPoint = function ( pageNo, x, y )
+{
+    return JSON.parse( verovio.vrvToolkit.getElementsAtPoint( this.ptr, pageNo, x, y ) );
+};
+
 verovio.toolkit.prototype.getElementsAtTime = function ( millisec )
 {
     return JSON.parse( verovio.vrvToolkit.getElementsAtTime( this.ptr, millisec ) );
 };
 
+verovio.toolkit.prototype.getElementsInRect = function ( pageNo, x, y, width, height )
+{
+    return JSON.parse( verovio.vrvToolkit.getElementsInRect( this.ptr, pageNo, x, y, width, height ) );
+};
+
 verovio.toolkit.prototype.getExpansionIdsForElement = function ( xmlId )
 {
     return JSON.parse( verovio.vrvToolkit.getExpansionIdsForElement( this.ptr, xmlId ) );
@@ -140,6 +194,11 @@ verovio.toolkit.prototype.getLog = function ()
     return verovio.vrvToolkit.getLog( this.ptr );
 };
 
+verovio.toolkit.prototype.getMemoryUsage = function ()
+{
+    return JSON.parse( verovio.vrvToolkit.getMemoryUsage( this.ptr ) );
+};
+
 verovio.toolkit.prototype.getMEI = function ( param1, scoreBased )
 {
     if ( typeof param1 === 'undefined' )
@@ -183,6 +242,11 @@ verovio.toolkit.prototype.getPageWithElement = function ( xmlId )
     return verovio.vrvToolkit.getPageWithElement( this.ptr, xmlId );
 };
 
+verovio.toolkit.prototype.getSVGCacheStats = function ()
+{
+    return JSON.parse( verovio.vrvToolkit.getSVGCacheStats( this.ptr ) );
+};
+
 verovio.toolkit.prototype.getTimeForElement = function ( xmlId )
 {
     return verovio.vrvToolkit.getTimeForElement( this.ptr, xmlId );
@@ -193,14 +257,29 @@ verovio.toolkit.prototype.getVersion = function ()
     return verovio.vrvToolkit.getVersion( this.ptr );
 };
 
+verovio.toolkit.prototype.getWorks = function ( data )
+{
+    return JSON.parse( verovio.vrvToolkit.getWorks( this.ptr, data ) );
+};
+
+verovio.toolkit.prototype.isPageCountFinal = function ()
+{
+    return verovio.vrvToolkit.isPageCountFinal( this.ptr );
+};
+
+verovio.toolkit.prototype.loadCastOffCache = function ( cache )
+{
+    return verovio.vrvToolkit.loadCastOffCache( this.ptr, cache );
+};
+
 verovio.toolkit.prototype.loadData = function ( data )
 {
     return verovio.vrvToolkit.loadData( this.ptr, data );
 };
 
-verovio.toolkit.prototype.redoLayout = function ()
+verovio.toolkit.prototype.redoLayout = function ( options )
 {
-    verovio.vrvToolkit.redoLayout( this.ptr );
+    verovio.vrvToolkit.redoLayoutWithOptions( this.ptr, JSON.stringify( options || {} ) );
 }
 
 verovio.toolkit.prototype.redoPagePitchPosLayout = function ()
@@ -235,9 +314,23 @@ verovio.toolkit.prototype.renderToSVG = function ( pageNo, options )
     return verovio.vrvToolkit.renderToSVG( this.ptr, pageNo, JSON.stringify( options ) );
 };
 
-verovio.toolkit.prototype.renderToTimemap = function ()
+verovio.toolkit.prototype.renderToSVGDiff = function ( pageNo )
+{
+    return JSON.parse( verovio.vrvToolkit.renderToSVGDiff( this.ptr, pageNo ) );
+};
+
+verovio.toolkit.prototype.renderToSVGRegion = function ( pageNo, x, y, width, height )
 {
-    return JSON.parse( verovio.vrvToolkit.renderToTimemap( this.ptr ) );
+    return verovio.vrvToolkit.renderToSVGRegion( this.ptr, pageNo, x, y, width, height );
+};
+
+verovio.toolkit.prototype.renderToTimemap = function ( options )
+{
+    options = options || {};
+    var timemap = verovio.vrvToolkit.renderToTimemapWithOptions( this.ptr, JSON.stringify( options ) );
+    // The binary timemap is returned base64 encoded
+    if ( options.format === "binary" ) return timemap;
+    return JSON.parse( timemap );
 };
 
 verovio.toolkit.prototype.setOptions = function ( options )
@@ -245,6 +338,11 @@ verovio.toolkit.prototype.setOptions = function ( options )
     verovio.vrvToolkit.setOptions( this.ptr, JSON.stringify( options ) );
 };
 
+verovio.toolkit.prototype.switchSelection = function ( selection )
+{
+    return verovio.vrvToolkit.switchSelection( this.ptr, JSON.stringify( selection ) );
+};
+
 /***************************************************************************************************************************/
 
 // If the window object is defined (if we are not within a WebWorker)...
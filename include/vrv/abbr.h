@@ -30,6 +30,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Abbr"; }
     virtual ClassId GetClassId() const { return ABBR; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
 private:
@@ -42,6 +42,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Accid"; }
     virtual ClassId GetClassId() const { return ACCID; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     virtual PositionInterface *GetPositionInterface() { return dynamic_cast<PositionInterface *>(this); }
@@ -35,6 +35,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "AnchoredText"; }
     virtual ClassId GetClassId() const { return ANCHORED_TEXT; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
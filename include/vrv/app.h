@@ -30,6 +30,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "App"; }
     virtual ClassId GetClassId() const { return APP; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /** Getter for level **/
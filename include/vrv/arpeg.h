@@ -41,6 +41,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Arpeg"; }
     virtual ClassId GetClassId() const { return ARPEG; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
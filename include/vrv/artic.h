@@ -32,6 +32,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Artic"; }
     virtual ClassId GetClassId() const { return ARTIC; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -125,6 +126,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "ArticPart"; }
     virtual ClassId GetClassId() const { return ARTIC_PART; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /** Override the method since alignment is required */
@@ -9,6 +9,7 @@
 #define __VRV_ATT_H__
 
 #include <string>
+#include <vector>
 
 //----------------------------------------------------------------------------
 
@@ -91,8 +92,39 @@ public:
     static void GetShared(const Object *element, ArrayOfStrAttr *attributes);
     // static void GetUsersymbols(const Object *element, ArrayOfStrAttr *attributes);
     static void GetVisual(const Object *element, ArrayOfStrAttr *attributes);
+
+    /**
+     * Idem for getting the offsets of the att classes from the element (VRV_UNSET for the ones it does not have)
+     * Used for filling the ClassIdDescriptor of the element ClassId
+     */
+    static void GetAnalyticalOffsets(const Object *element, std::vector<int> *offsets);
+    static void GetCmnOffsets(const Object *element, std::vector<int> *offsets);
+    static void GetCmnornamentsOffsets(const Object *element, std::vector<int> *offsets);
+    static void GetCritappOffsets(const Object *element, std::vector<int> *offsets);
+    // static void GetEdittransOffsets(const Object *element, std::vector<int> *offsets);
+    static void GetExternalsymbolsOffsets(const Object *element, std::vector<int> *offsets);
+    static void GetFacsimileOffsets(const Object *element, std::vector<int> *offsets);
+    // static void GetFigtableOffsets(const Object *element, std::vector<int> *offsets);
+    // static void GetFingeringOffsets(const Object *element, std::vector<int> *offsets);
+    static void GetGesturalOffsets(const Object *element, std::vector<int> *offsets);
+    // static void GetHarmonyOffsets(const Object *element, std::vector<int> *offsets);
+    // static void GetHeaderOffsets(const Object *element, std::vector<int> *offsets);
+    static void GetMeiOffsets(const Object *element, std::vector<int> *offsets);
+    static void GetMensuralOffsets(const Object *element, std::vector<int> *offsets);
+    static void GetMidiOffsets(const Object *element, std::vector<int> *offsets);
+    static void GetNeumesOffsets(const Object *element, std::vector<int> *offsets);
+    static void GetPagebasedOffsets(const Object *element, std::vector<int> *offsets);
+    // static void GetPerformanceOffsets(const Object *element, std::vector<int> *offsets);
+    static void GetSharedOffsets(const Object *element, std::vector<int> *offsets);
+    // static void GetUsersymbolsOffsets(const Object *element, std::vector<int> *offsets);
+    static void GetVisualOffsets(const Object *element, std::vector<int> *offsets);
     ///@}
 
+    /**
+     * Return the offset of an att class of the element from the element (VRV_UNSET if NULL)
+     */
+    static int GetOffset(const Object *element, const void *att);
+
     static data_ACCIDENTAL_WRITTEN AccidentalGesturalToWritten(data_ACCIDENTAL_GESTURAL accid);
     static data_ACCIDENTAL_GESTURAL AccidentalWrittenToGestural(data_ACCIDENTAL_WRITTEN accid);
 
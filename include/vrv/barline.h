@@ -33,6 +33,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "BarLine"; }
     virtual ClassId GetClassId() const { return BARLINE; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /** Override the method since alignment is required */
@@ -84,6 +85,7 @@ public:
     virtual Object *Clone() const { return new BarLineAttr(*this); }
     virtual std::string GetClassName() const { return "BarLineAttr"; }
     virtual ClassId GetClassId() const { return (m_isLeft ? BARLINE_ATTR_LEFT : BARLINE_ATTR_RIGHT); }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     void SetLeft() { m_isLeft = true; }
@@ -49,6 +49,11 @@ public:
      */
     const ArrayOfBeamElementCoords *GetElementCoordRefs();
 
+    /**
+     * Return the approximate bytes of the segment with the coordinates of the elements it refers to
+     */
+    size_t GetMemorySize() const;
+
     /**
      * Initializes the m_beamElementCoords vector objects.
      * This is called by Beam::FilterList
@@ -136,6 +141,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Beam"; }
     virtual ClassId GetClassId() const { return BEAM; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     int GetNoteCount() const { return this->GetChildCount(NOTE); }
@@ -184,6 +190,11 @@ public:
      */
     virtual int ResetDrawing(FunctorParams *functorParams);
 
+    /**
+     * See Object::GetMemoryUsage
+     */
+    virtual int GetMemoryUsage(FunctorParams *functorParams);
+
 protected:
     /**
      * Filter the flat list and keep only Note and Chords elements.
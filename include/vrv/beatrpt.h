@@ -35,6 +35,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "BeatRpt"; }
     virtual ClassId GetClassId() const { return BEATRPT; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /** Override the method since alignment is required */
@@ -35,6 +35,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "boundaryEnd"; }
     virtual ClassId GetClassId() const { return BOUNDARY_END; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     void SetMeasure(Measure *measure) { m_drawingMeasure = measure; }
@@ -39,6 +39,12 @@ public:
     bool Is(const std::vector<ClassId> &classIds) const;
     ///@}
 
+    /**
+     * Return the approximate bytes of the object, without its children and the data it points to.
+     * Each class returns its own size, and adds the content it owns when it is significant (e.g., a text).
+     */
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
+
     /**
      * @name Methods for updating the bounding boxes and for providing information about their status.
      */
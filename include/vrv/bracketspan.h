@@ -39,6 +39,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "BracketSpan"; }
     virtual ClassId GetClassId() const { return BRACKETSPAN; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
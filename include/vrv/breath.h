@@ -34,6 +34,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Breath"; }
     virtual ClassId GetClassId() const { return BREATH; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -33,6 +33,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "BTrem"; }
     virtual ClassId GetClassId() const { return BTREM; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
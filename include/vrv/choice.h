@@ -31,6 +31,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Choice"; }
     virtual ClassId GetClassId() const { return CHOICE; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /** Getter for level **/
@@ -52,6 +52,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Chord"; }
     virtual ClassId GetClassId() const { return CHORD; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -39,6 +39,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Clef"; }
     virtual ClassId GetClassId() const { return CLEF; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /** Override the method since alignment is required */
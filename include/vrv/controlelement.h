@@ -35,6 +35,7 @@ public:
     virtual ~ControlElement();
     virtual void Reset();
     virtual ClassId GetClassId() const { return CONTROL_ELEMENT; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -30,6 +30,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Corr"; }
     virtual ClassId GetClassId() const { return CORR; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
 private:
@@ -33,6 +33,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Custos"; }
     virtual ClassId GetClassId() const { return CUSTOS; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
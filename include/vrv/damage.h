@@ -30,6 +30,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Damage"; }
     virtual ClassId GetClassId() const { return DAMAGE; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
 private:
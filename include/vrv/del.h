@@ -30,6 +30,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Del"; }
     virtual ClassId GetClassId() const { return DEL; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
 private:
@@ -24,6 +24,7 @@ namespace vrv {
 
 class Glyph;
 class Object;
+class TextExtentCache;
 class View;
 class Zone;
 
@@ -68,6 +69,7 @@ public:
         m_contentHeight = 0;
         m_userScaleX = 1.0;
         m_userScaleY = 1.0;
+        m_textExtentCache = NULL;
     }
     virtual ~DeviceContext(){};
     virtual ClassId GetClassId() const;
@@ -128,6 +130,12 @@ public:
     virtual void GetTextExtent(const std::wstring &string, TextExtend *extend, bool typeSize);
     virtual void GetSmuflTextExtent(const std::wstring &string, TextExtend *extend);
 
+    /**
+     * Set the cache of the text extents used by GetTextExtent (NULL for none).
+     * See Doc::GetTextExtentCache
+     */
+    void SetTextExtentCache(TextExtentCache *textExtentCache) { m_textExtentCache = textExtentCache; }
+
     /**
      * @name Getters
      */
@@ -299,6 +307,9 @@ private:
     /** stores the scale as requested by the used */
     double m_userScaleX;
     double m_userScaleY;
+
+    /** the cache of the text extents (not owned) */
+    TextExtentCache *m_textExtentCache;
 };
 
 } // namespace vrv
@@ -43,6 +43,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Dir"; }
     virtual ClassId GetClassId() const { return DIR; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -0,0 +1,278 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        displaylistdevicecontext.h
+// Author:      Laurent Pugin
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_DISPLAY_LIST_DC_H__
+#define __VRV_DISPLAY_LIST_DC_H__
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#include "devicecontext.h"
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// DisplayListDeviceContext
+//----------------------------------------------------------------------------
+
+/**
+ * This class records the drawing of a page for replaying it into other device contexts.
+ * The drawing methods, the graphics and the pen, brush and font in use are stored in a compact list of operations,
+ * so the page can be output several times (e.g., at different scales) without the view traversing the object tree
+ * again. The objects and the views passed to the graphic methods are only referenced and need to remain valid, with
+ * the exception of the objects instanciated by the view only for drawing, which are copied.
+ * The view draws some elements differently with a BBoxDeviceContext or with global styling, so a recording is
+ * meant to be replayed into drawing device contexts with the same global styling.
+ */
+class DisplayListDeviceContext : public DeviceContext {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    DisplayListDeviceContext(bool useGlobalStyling = true);
+    virtual ~DisplayListDeviceContext();
+    virtual ClassId GetClassId() const { return DISPLAY_LIST_DEVICE_CONTEXT; }
+    ///@}
+
+    /**
+     * Remove everything recorded.
+     */
+    void Reset();
+
+    /**
+     * Replay the recorded drawing into the device context.
+     * The width, the height and the content height are set from the recording but the user scale of the device
+     * context is left unchanged.
+     */
+    void Replay(DeviceContext *dc);
+
+    /**
+     * Return true if nothing was recorded.
+     */
+    bool IsEmpty() const { return m_operations.empty(); }
+
+    /**
+     * @name Set and get the pixel per unit factor of the page recorded
+     */
+    ///@{
+    void SetPPUFactor(double PPUFactor) { m_PPUFactor = PPUFactor; }
+    double GetPPUFactor() const { return m_PPUFactor; }
+    ///@}
+
+    /**
+     * @name Setters
+     */
+    ///@{
+    virtual void SetBackground(int colour, int style = AxSOLID);
+    virtual void SetBackgroundImage(void *image, double opacity = 1.0);
+    virtual void SetBackgroundMode(int mode);
+    virtual void SetTextForeground(int colour);
+    virtual void SetTextBackground(int colour);
+    virtual void SetLogicalOrigin(int x, int y);
+    ///@}
+
+    /**
+     * @name Getters
+     */
+    ///@{
+    virtual Point GetLogicalOrigin();
+    ///@}
+
+    /**
+     * @name Drawing methods
+     */
+    ///@{
+    virtual void DrawSimpleBezierPath(Point bezier[4]);
+    virtual void DrawComplexBezierPath(Point bezier1[4], Point bezier2[4]);
+    virtual void DrawCircle(int x, int y, int radius);
+    virtual void DrawEllipse(int x, int y, int width, int height);
+    virtual void DrawEllipticArc(int x, int y, int width, int height, double start, double end);
+    virtual void DrawLine(int x1, int y1, int x2, int y2);
+    virtual void DrawPolygon(int n, Point points[], int xOffset, int yOffset, int fillStyle = AxODDEVEN_RULE);
+    virtual void DrawRectangle(int x, int y, int width, int height);
+    virtual void DrawRotatedText(const std::string &text, int x, int y, double angle);
+    virtual void DrawRoundedRectangle(int x, int y, int width, int height, int radius);
+    virtual void DrawText(const std::string &text, const std::wstring wtext = L"", int x = VRV_UNSET, int y = VRV_UNSET,
+        int width = VRV_UNSET, int height = VRV_UNSET);
+    virtual void DrawMusicText(const std::wstring &text, int x, int y, bool setSmuflGlyph = false);
+    virtual void DrawSpline(int n, Point points[]);
+    virtual void DrawSvgShape(int x, int y, int width, int height, pugi::xml_node svg);
+    virtual void DrawBackgroundImage(int x = 0, int y = 0);
+    virtual void DrawPlaceholder(int x, int y);
+    ///@}
+
+    /**
+     * @name Method for starting and ending a text
+     */
+    ///@{
+    virtual void StartText(int x, int y, data_HORIZONTALALIGNMENT alignment = HORIZONTALALIGNMENT_left);
+    virtual void EndText();
+    virtual void MoveTextTo(int x, int y, data_HORIZONTALALIGNMENT alignment);
+    virtual void MoveTextVerticallyTo(int y);
+    ///@}
+
+    /**
+     * @name Methods for starting and ending the graphics
+     */
+    ///@{
+    virtual void StartGraphic(
+        Object *object, std::string gClass, std::string gId, bool primary = true, bool prepend = false);
+    virtual void EndGraphic(Object *object, View *view);
+    virtual void StartCustomGraphic(std::string name, std::string gClass = "", std::string gId = "");
+    virtual void EndCustomGraphic();
+    virtual void ResumeGraphic(Object *object, std::string gId);
+    virtual void EndResumedGraphic(Object *object, View *view);
+    virtual void StartTextGraphic(Object *object, std::string gClass, std::string gId);
+    virtual void EndTextGraphic(Object *object, View *view);
+    virtual void RotateGraphic(Point const &orig, double angle);
+    ///@}
+
+    /**
+     * @name Method for starting and ending page
+     */
+    ///@{
+    virtual void StartPage();
+    virtual void EndPage();
+    ///@}
+
+    /**
+     * @name Method for adding description element
+     */
+    ///@{
+    virtual void AddDescription(const std::string &text);
+    ///@}
+
+    virtual bool UseGlobalStyling() { return m_useGlobalStyling; }
+
+private:
+    /**
+     * The operations in the list, each followed by its int arguments.
+     * Other arguments are stored in the corresponding vectors and passed by index.
+     */
+    enum DisplayListOperation {
+        DL_PEN = 0,
+        DL_BRUSH,
+        DL_FONT,
+        DL_DEACTIVATE,
+        DL_BACKGROUND,
+        DL_BACKGROUND_IMAGE,
+        DL_BACKGROUND_MODE,
+        DL_TEXT_FOREGROUND,
+        DL_TEXT_BACKGROUND,
+        DL_LOGICAL_ORIGIN,
+        DL_SIMPLE_BEZIER_PATH,
+        DL_COMPLEX_BEZIER_PATH,
+        DL_CIRCLE,
+        DL_ELLIPSE,
+        DL_ELLIPTIC_ARC,
+        DL_LINE,
+        DL_POLYGON,
+        DL_RECTANGLE,
+        DL_ROTATED_TEXT,
+        DL_ROUNDED_RECTANGLE,
+        DL_TEXT,
+        DL_MUSIC_TEXT,
+        DL_SPLINE,
+        DL_SVG_SHAPE,
+        DL_BACKGROUND_IMAGE_DRAW,
+        DL_PLACEHOLDER,
+        DL_START_TEXT,
+        DL_END_TEXT,
+        DL_MOVE_TEXT_TO,
+        DL_MOVE_TEXT_VERTICALLY_TO,
+        DL_START_GRAPHIC,
+        DL_END_GRAPHIC,
+        DL_START_CUSTOM_GRAPHIC,
+        DL_END_CUSTOM_GRAPHIC,
+        DL_RESUME_GRAPHIC,
+        DL_END_RESUMED_GRAPHIC,
+        DL_START_TEXT_GRAPHIC,
+        DL_END_TEXT_GRAPHIC,
+        DL_ROTATE_GRAPHIC,
+        DL_START_PAGE,
+        DL_END_PAGE,
+        DL_DESCRIPTION
+    };
+
+    /**
+     * Add an operation after recording the pen, brush, font and deactivation changes since the previous one.
+     */
+    void AddOperation(DisplayListOperation operation);
+
+    /**
+     * @name Add arguments to the last operation
+     */
+    ///@{
+    void AddInt(int value) { m_operations.push_back(value); }
+    void AddPoints(int n, const Point points[]);
+    void AddDouble(double value);
+    void AddString(const std::string &value);
+    void AddWString(const std::wstring &value);
+    void AddObject(Object *object);
+    void AddEndedObject(Object *object);
+    void AddView(View *view);
+    ///@}
+
+    /**
+     * Return true if the object is one of the children of its parent.
+     * The children of each parent are looked up once during the recording.
+     */
+    bool IsChildOfParent(Object *object);
+
+    /**
+     * Delete the copies of the objects that are not in the tree.
+     */
+    void ClearClones();
+
+public:
+    //
+private:
+    bool m_useGlobalStyling;
+    Point m_logicalOrigin;
+    double m_PPUFactor;
+
+    /**
+     * The operations with their int arguments, and the other arguments
+     */
+    ///@{
+    std::vector<int> m_operations;
+    std::vector<Point> m_points;
+    std::vector<double> m_doubles;
+    std::vector<std::string> m_strings;
+    std::vector<std::wstring> m_wstrings;
+    std::vector<Object *> m_objects;
+    ArrayOfObjects m_clones;
+    /** The index of the objects recorded, and of the copies of the objects not in the tree with a graphic open */
+    std::unordered_map<Object *, int> m_objectIndices;
+    /** The children of the parents of the objects recorded */
+    std::unordered_map<Object *, std::unordered_set<Object *> > m_parentChildren;
+    std::vector<View *> m_views;
+    std::vector<pugi::xml_node> m_svgShapes;
+    std::vector<void *> m_images;
+    ///@}
+
+    /**
+     * The pens, brushes and fonts recorded, with the index of the current ones (-1 for none)
+     */
+    ///@{
+    std::vector<Pen> m_pens;
+    std::vector<Brush> m_brushes;
+    std::vector<FontInfo> m_fonts;
+    int m_currentPen;
+    int m_currentBrush;
+    int m_currentFont;
+    int m_currentDeactivation;
+    ///@}
+};
+
+} // namespace vrv
+
+#endif // __VRV_DISPLAY_LIST_DC_H__
@@ -8,11 +8,16 @@
 #ifndef __VRV_DOC_H__
 #define __VRV_DOC_H__
 
+#include <list>
+
+//----------------------------------------------------------------------------
+
 #include "devicecontextbase.h"
 #include "expansionmap.h"
 #include "facsimile.h"
 #include "options.h"
 #include "scoredef.h"
+#include "textextentcache.h"
 
 namespace smf {
 class MidiFile;
@@ -21,11 +26,13 @@ class MidiFile;
 namespace vrv {
 
 class CastOffPagesParams;
+class CastOffSystemsParams;
 class FontInfo;
 class Glyph;
 class Pages;
 class Page;
 class Score;
+class SetCurrentScoreDefParams;
 
 enum DocType { Raw = 0, Rendering, Transcription, Facs };
 
@@ -46,7 +53,9 @@ public:
     ///@{
     Doc();
     virtual ~Doc();
+    virtual std::string GetClassName() const { return "Doc"; }
     virtual ClassId GetClassId() const { return DOC; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -121,6 +130,11 @@ public:
      */
     int GetPageCount();
 
+    /**
+     * Get the total page count or an estimation of it while a progressive cast-off is pending
+     */
+    int GetEstimatedPageCount();
+
     /**
      * Return true if the MIDI generation is already done
      */
@@ -200,6 +214,15 @@ public:
      */
     bool HasMidiTimemap();
 
+    /**
+     * Process the document in performance order for the MIDI and timemap functors.
+     * With an expansion by reference, the performed measures are processed one after the other and the
+     * repeat is set to the occurrence of the measure currently processed (1-based).
+     * Otherwise, the whole document is processed once.
+     */
+    void ProcessPerformance(Functor *functor, FunctorParams *functorParams, int &repeat, Functor *endFunctor = NULL,
+        ArrayOfComparisons *filters = NULL);
+
     /**
      * Export the document to a MIDI file.
      * Run trough all the layers and fill the midi file content.
@@ -207,13 +230,16 @@ public:
     void ExportMIDI(smf::MidiFile *midiFile);
 
     /**
-     * Extract a timemap from the document to a JSON string.
+     * Extract a timemap from the document to a JSON string or to a compact binary buffer.
      * Run trough all the layers and fill the timemap file content.
+     * The events passed to the Prepare methods have to be sorted by real time.
+     * See Doc::PrepareBinaryTimemap for the layout of the binary buffer.
      */
-    bool ExportTimemap(std::string &output);
-    void PrepareJsonTimemap(std::string &output, std::map<double, double> &realTimeToScoreTime,
-        std::map<double, std::vector<std::string> > &realTimeToOnElements,
-        std::map<double, std::vector<std::string> > &realTimeToOffElements, std::map<double, int> &realTimeToTempo);
+    ///@{
+    bool ExportTimemap(std::string &output, bool binary = false);
+    void PrepareJsonTimemap(std::string &output, const ArrayOfTimemapEvents &timemapEvents);
+    void PrepareBinaryTimemap(std::string &output, const ArrayOfTimemapEvents &timemapEvents);
+    ///@}
 
     /**
      * Set the initial scoreDef of each page.
@@ -259,6 +285,24 @@ public:
      */
     void CastOffDocBase(bool useSb, bool usePb);
 
+    /**
+     * Continue a progressive cast-off (see Options::m_progressiveCastOff) until the page is complete.
+     * The systems not laid out vertically yet and the content system with the measures not cast off into systems
+     * are kept in a content page placed as last page until everything is cast off.
+     * With VRV_UNSET, the cast-off is continued until the end.
+     */
+    void ContinueCastOffDoc(int pageIdx = VRV_UNSET);
+
+    /**
+     * Return true if a progressive cast-off has not been completed yet
+     */
+    bool IsCastOffPending() const { return (m_castOffContentPage != NULL); }
+
+    /**
+     * Mark all the pages to be laid out again when they are drawn.
+     */
+    void ResetLayoutDoc();
+
     /**
      * Casts off the running elements (headers and footer)
      * Called from Doc::CastOffDoc
@@ -271,8 +315,11 @@ public:
     /**
      * Undo the cast off of the entire document.
      * The document will then contain one single page with one single system.
+     * Unless resetCache is true, the horizontal layout cached when the document was cast off is restored and re-used
+     * by the next call to Doc::CastOffDoc. The cache of each measure is keyed on its alignments and on the options of the
+     * horizontal layout and it is dropped as a whole if one of the keys does not match.
      */
-    void UnCastOffDoc();
+    void UnCastOffDoc(bool resetCache = true);
 
     /**
      * Cast off of the entire document according to the encoded data (pb and sb).
@@ -314,6 +361,8 @@ public:
 
     /**
      * Transpose the content of the doc.
+     * The transposition only uses the key signature of the mdiv scoreDef and the pitches as loaded. It does not
+     * require Doc::PrepareDrawing and should be called before it, since it adds accidentals to the notes.
      */
     void TransposeDoc();
 
@@ -322,6 +371,47 @@ public:
      */
     void ExpandExpansions();
 
+    /**
+     * Fill the object count and the approximate bytes of the objects for each class name, and of the layout
+     * structures (the aligners, the floating positioners and the beam segments).
+     * It only walks the tree once without modifying it, which makes it cheap enough to be called periodically.
+     */
+    void GetMemoryUsage(MapOfStrMemoryUsages &objects, MapOfStrMemoryUsages &layout);
+
+    /**
+     * @name Apply the mdiv and the reading selection options to the loaded content
+     * The XPath queries are evaluated on the selection skeleton, and the objects of the mdivs and of the readings
+     * are made visible or hidden accordingly, as when the data is read. The content of an mdiv selected is converted
+     * to page-based and not cast off, and the drawing has to be prepared again. Return true if the visible mdiv (or
+     * the visibility of a reading) changed.
+     */
+    ///@{
+    bool SelectMdiv();
+    bool SelectReadings();
+    ///@}
+
+    /**
+     * Build the selection skeleton from the MEI output of the document, unless it is already built.
+     * The content has to be cast off completely beforehand.
+     */
+    void BuildSelectionSkeleton();
+
+    /**
+     * Return the number of nodes of the selection skeleton and the approximate bytes used by it.
+     */
+    std::pair<int, size_t> GetSelectionSkeletonMemoryUsage() const;
+
+    /**
+     * Compile the XPath queries of a reading selection option.
+     * The queries that cannot be compiled or that do not return nodes are skipped with an error.
+     */
+    static void CompileXPathQueries(const std::vector<std::string> &queries, std::list<pugi::xpath_query> &compiled);
+
+    /**
+     * Return the node selected from the node by the first query selecting one (an empty node if none)
+     */
+    static pugi::xml_node SelectXPathNode(pugi::xml_node node, const std::list<pugi::xpath_query> &queries);
+
     /**
      * To be implemented.
      */
@@ -385,6 +475,13 @@ public:
     bool HasFacsimile() const { return m_facsimile != NULL; }
     ///@}
 
+    /**
+     * Return the cache of the text extents, which is cleared when the music font changes.
+     * It is given to the device contexts drawing the pages by View::DrawCurrentPage, so the strings measured for
+     * the layout are not measured again when the page is drawn or laid out again.
+     */
+    TextExtentCache *GetTextExtentCache();
+
     //----------//
     // Functors //
     //----------//
@@ -405,6 +502,33 @@ private:
      */
     int CalcMusicFontSize();
 
+    /**
+     * Move the attributes, the children and the uuid of a scoreDef to another one, which has to be empty.
+     */
+    void MoveScoreDef(ScoreDef *scoreDef, ScoreDef *destination);
+
+    /**
+     * Copy the <mdiv>, <score> and <pages> descendants of a node with their attributes, and the <app>, <choice> and
+     * <subst> ones with their content, to a node of the selection skeleton.
+     */
+    void CopySelectionSkeleton(pugi::xml_node node, pugi::xml_node skeletonParent);
+
+    /**
+     * @name Methods for a progressive cast-off.
+     * The first one lays out horizontally the next measures of the content system and casts them off into systems.
+     * The second one returns the number of systems that can be laid out vertically, i.e., the systems for which the
+     * scoreDef of the next one is set since it can add cautionary elements to them.
+     * The third one sets the scoreDef of a range of systems of a page (or of the content page) and optimizes them,
+     * continuing from the systems processed with the same params before. The last one deletes the state of the cast-off
+     * and adds back the objects pending at the end of the last system.
+     */
+    ///@{
+    void CastOffSystemsChunk();
+    int GetCastOffReadySystemCount();
+    void SetCurrentScoreDefSystems(Page *page, int startIdx, int endIdx, SetCurrentScoreDefParams *params);
+    void ClearCastOffProgress();
+    ///@}
+
 public:
     /**
      * A copy of the header tree stored as pugi::xml_document
@@ -421,6 +545,15 @@ public:
      */
     pugi::xml_document m_back;
 
+    /**
+     * A skeleton of the MEI body with the <mdiv>, <score> and <pages> elements, and the <app>, <choice> and <subst>
+     * elements with their complete content. The elements have the uuid of their object as xml:id.
+     * The selection queries are evaluated on it for changing the selection without loading the data again.
+     * It is built by the first change of the selection (see BuildSelectionSkeleton) and kept until the document is
+     * reset. The body is left empty when the data has only one mdiv and no reading to select from.
+     */
+    pugi::xml_document m_selectionSkeleton;
+
     /**
      * Holds the top scoreDef.
      * In a standard MEI file, this is the <scoreDef> encoded before the first <section>.
@@ -527,6 +660,12 @@ private:
      */
     int m_markup;
 
+    /**
+     * A flag to indicate that the analytical markup was converted to elements used only for the rendering.
+     * They are converted again when the visible readings change.
+     */
+    bool m_markupConversionDone;
+
     /**
      * A flag to indicate whereas to document contains only mensural music.
      * Mensural only music will be converted to cast-off segments by Doc::ConvertToCastOffMensuralDoc
@@ -548,6 +687,49 @@ private:
 
     /** Facsimile information */
     Facsimile *m_facsimile = NULL;
+
+    /**
+     * @name The state of a progressive cast-off.
+     * The content page holds the systems not laid out vertically yet and, as last child, the content system with
+     * the measures not cast off into systems. The params are the ones of the system and page cast-offs, and the ones
+     * for setting the scoreDef of the systems before they are laid out vertically and once they are on a page. The
+     * scoreDef is a copy of the one the measures not cast off point to when it is not theirs. The copies of the previous
+     * chunks are kept until the end since the measures of a system not complete yet can still point to them. The x
+     * position is the one of the end of the measures laid out horizontally. The shift and the bottom overflow are the
+     * ones of the last system laid out vertically. The page and system indexes are the ones of the first system for
+     * which the scoreDef is not set on a page yet.
+     */
+    ///@{
+    Page *m_castOffContentPage;
+    CastOffSystemsParams *m_castOffSystemsParams;
+    CastOffPagesParams *m_castOffPagesParams;
+    SetCurrentScoreDefParams *m_castOffSystemsScoreDefParams;
+    SetCurrentScoreDefParams *m_castOffPagesScoreDefParams;
+    ScoreDef *m_castOffCurrentScoreDef;
+    ArrayOfObjects m_castOffScoreDefs;
+    int m_castOffX;
+    int m_castOffShift;
+    int m_castOffPrevBottomOverflow;
+    int m_castOffScoreDefPage;
+    int m_castOffScoreDefSystem;
+    ///@}
+
+    /**
+     * @name The horizontal layout cached when casting off the document.
+     * The first flag indicates that the cache is valid, the second one that the measures have been restored by
+     * Doc::UnCastOffDoc and that the next cast-off can use them. The widths are the ones of the content page scoreDef
+     * and system labels.
+     */
+    ///@{
+    bool m_hasCachedHorizontalLayout;
+    bool m_useCachedHorizontalLayout;
+    int m_cachedScoreDefWidth;
+    int m_cachedLabelsWidth;
+    int m_cachedAbbrLabelsWidth;
+    ///@}
+
+    /** The cache of the text extents */
+    TextExtentCache m_textExtentCache;
 };
 
 } // namespace vrv
@@ -32,6 +32,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Dot"; }
     virtual ClassId GetClassId() const { return DOT; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -42,6 +42,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Dynam"; }
     virtual ClassId GetClassId() const { return DYNAM; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -47,6 +47,7 @@ public:
     virtual ~EditorialElement();
     virtual void Reset();
     virtual ClassId GetClassId() const { return EDITORIAL_ELEMENT; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -85,6 +85,7 @@ protected:
     ///@{
     bool AdjustPitchFromPosition(Object *obj, Clef *clef = NULL);
     bool AdjustClefLineFromPosition(Clef *clef, Staff *staff = NULL);
+    Staff *GetClosestStaff(int x, int y);
     ///@}
 
 private:
@@ -112,17 +113,17 @@ struct ClosestBB {
         return sqrt(xDiff * xDiff + yDiff * yDiff);
     }
 
+    int distanceToZone(Object *object)
+    {
+        if (!object->GetFacsimileInterface() || !object->GetFacsimileInterface()->GetZone()) return 0;
+        Zone *zone = object->GetFacsimileInterface()->GetZone();
+        return distanceToBB(zone->GetUlx(), zone->GetUly(), zone->GetLrx(), zone->GetLry(), zone->GetRotate());
+    }
+
     bool operator()(Object *a, Object *b)
     {
         if (!a->GetFacsimileInterface() || !b->GetFacsimileInterface()) return true;
-        Zone *zoneA = a->GetFacsimileInterface()->GetZone();
-        Zone *zoneB = b->GetFacsimileInterface()->GetZone();
-
-        int distA
-            = distanceToBB(zoneA->GetUlx(), zoneA->GetUly(), zoneA->GetLrx(), zoneA->GetLry(), zoneA->GetRotate());
-        int distB
-            = distanceToBB(zoneB->GetUlx(), zoneB->GetUly(), zoneB->GetLrx(), zoneB->GetLry(), zoneB->GetRotate());
-        return (distA < distB);
+        return (distanceToZone(a) < distanceToZone(b));
     }
 };
 
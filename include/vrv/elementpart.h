@@ -36,6 +36,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Dots"; }
     virtual ClassId GetClassId() const { return DOTS; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /** Override the method since alignment is required */
@@ -102,6 +103,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Flag"; }
     virtual ClassId GetClassId() const { return FLAG; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /** Override the method since alignment is required */
@@ -158,6 +160,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "TupletBracket"; }
     virtual ClassId GetClassId() const { return TUPLET_BRACKET; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -252,6 +255,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "TupletNum"; }
     virtual ClassId GetClassId() const { return TUPLET_NUM; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -324,6 +328,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Stem"; }
     virtual ClassId GetClassId() const { return STEM; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /** Override the method since alignment is required */
@@ -38,6 +38,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Ending"; }
     virtual ClassId GetClassId() const { return ENDING; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
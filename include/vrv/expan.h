@@ -30,6 +30,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Expan"; }
     virtual ClassId GetClassId() const { return EXPAN; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
 private:
@@ -36,6 +36,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Expansion"; }
     virtual ClassId GetClassId() const { return EXPANSION; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
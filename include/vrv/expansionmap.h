@@ -43,12 +43,49 @@ public:
      */
     void Expand(const xsdAnyURI_List &expansionList, xsdAnyURI_List &existingList, Object *prevSection);
 
+    /**
+     * Expand expansion recursively by reference.
+     * Nothing is cloned and only the sequence of the performed content is filled. It holds the measures and the
+     * scoreDef, sb and pb elements of the sections instead of the sections because the cast-off moves them out of
+     * their section.
+     */
+    void ExpandReferences(const xsdAnyURI_List &expansionList, Object *prevSection);
+
+    /**
+     * Add the ids of the repetitions of an expansion by reference to the expansion map.
+     * An element performed more than once gets the id of the notated element with a "-rend2" suffix for its first
+     * repetition, "-rend3" for the second one, etc. This is the suffix the clone-based expansion gives to the repeated
+     * sections, but not to their content, which gets generated ids.
+     */
+    void MapReferenceIds();
+
+    /**
+     * Return the notated id of an id of a repetition in an expansion by reference and the (1-based) repetition.
+     * Other ids are returned as they are.
+     */
+    std::string GetNotatedReferenceId(const std::string &xmlId, int &repeat) const;
+
+    /**
+     * Check if the expansion was done by reference
+     */
+    bool HasReferences() const { return !m_references.empty(); }
+
+    /**
+     * Return the sequence of performed measures and system elements of an expansion by reference
+     */
+    const ArrayOfObjects &GetReferences() const { return m_references; }
+
     bool UpdateIds(Object *object);
 
     std::vector<std::string> GetExpansionIdsForElement(const std::string &xmlId);
 
     void GetUuidList(Object *object, std::vector<std::string> &idList);
 
+    /**
+     * Return the approximate bytes of the expansion map, including the sequence of performed measures
+     */
+    size_t GetMemorySize() const;
+
 private:
     /** Ads an id string to an original/notated id */
     bool AddExpandedIdToExpansionMap(const std::string &origXmlId, std::string newXmlId);
@@ -58,6 +95,11 @@ public:
     std::map<std::string, std::vector<std::string> > m_map;
 
 private:
+    /**
+     * The measures and system elements of the performed sections (section, ending, lem, rdg) in order for an
+     * expansion by reference
+     */
+    ArrayOfObjects m_references;
 };
 
 } // namespace vrv
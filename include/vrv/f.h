@@ -34,6 +34,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "F"; }
     virtual ClassId GetClassId() const { return FIGURE; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -40,6 +40,7 @@ public:
     virtual Object *Clone() const { return new Facsimile(*this); }
     virtual void Reset();
     virtual ClassId GetClassId() const { return FACSIMILE; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     virtual std::string GetClassName() const { return "facsimile"; }
     ///@}
     virtual bool IsSupportedChild(Object *object);
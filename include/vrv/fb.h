@@ -33,6 +33,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Fb"; }
     virtual ClassId GetClassId() const { return FB; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -43,6 +43,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Fermata"; }
     virtual ClassId GetClassId() const { return FERMATA; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -33,6 +33,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Fig"; }
     virtual ClassId GetClassId() const { return FIG; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -35,6 +35,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Fing"; }
     virtual ClassId GetClassId() const { return FING; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -37,6 +37,7 @@ public:
     virtual ~FloatingObject();
     virtual void Reset();
     virtual ClassId GetClassId() const { return FLOATING_OBJECT; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     virtual void UpdateContentBBoxX(int x1, int x2);
@@ -147,6 +148,7 @@ public:
     FloatingPositioner(FloatingObject *object, StaffAlignment *alignment, char spanningType);
     virtual ~FloatingPositioner(){};
     virtual ClassId GetClassId() const { return FLOATING_POSITIONER; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
 
     virtual void ResetPositioner();
 
@@ -251,6 +253,7 @@ public:
     FloatingCurvePositioner(FloatingObject *object, StaffAlignment *alignment, char spanningType);
     virtual ~FloatingCurvePositioner();
     virtual ClassId GetClassId() const { return FLOATING_CURVE_POSITIONER; }
+    virtual size_t GetMemorySize() const;
 
     virtual void ResetPositioner();
 
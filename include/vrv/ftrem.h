@@ -39,6 +39,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "FTrem"; }
     virtual ClassId GetClassId() const { return FTREM; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -71,6 +72,11 @@ public:
      */
     virtual int GenerateMIDI(FunctorParams *functorParams);
 
+    /**
+     * See Object::GetMemoryUsage
+     */
+    virtual int GetMemoryUsage(FunctorParams *functorParams);
+
 private:
     //
 protected:
@@ -387,8 +387,10 @@ public:
 //----------------------------------------------------------------------------
 
 /**
- * member 1: the doc
- * member 2: a pointer to the functor for passing it to the system aligner
+ * member 0: a flag indicating that at least one slur was adjusted
+ * member 1: the positioners of the slurs whose geometry changed (i.e., for which the bounding box needs to be redrawn)
+ * member 2: the doc
+ * member 3: a pointer to the functor for passing it to the system aligner
  **/
 
 class AdjustSlursParams : public FunctorParams {
@@ -400,6 +402,7 @@ public:
         m_functor = functor;
     }
     bool m_adjusted;
+    ArrayOfFloatingPositioners m_adjustedPositioners;
     Doc *m_doc;
     Functor *m_functor;
 };
@@ -725,6 +728,29 @@ public:
     Page *m_page;
 };
 
+//----------------------------------------------------------------------------
+// CacheHorizontalLayoutParams
+//----------------------------------------------------------------------------
+
+/**
+ * member 0: a flag indicating if the cached values need to be restored (instead of being stored)
+ * member 1: the hash of the options of the horizontal layout
+ * member 2: a flag indicating that a measure has changed since it was cached and that the cache cannot be restored
+ **/
+
+class CacheHorizontalLayoutParams : public FunctorParams {
+public:
+    CacheHorizontalLayoutParams(bool restore, uint64_t optionsHash)
+    {
+        m_restore = restore;
+        m_optionsHash = optionsHash;
+        m_changed = false;
+    }
+    bool m_restore;
+    uint64_t m_optionsHash;
+    bool m_changed;
+};
+
 //----------------------------------------------------------------------------
 // CalcArticParams
 //----------------------------------------------------------------------------
@@ -781,6 +807,8 @@ public:
  * member 0: std::vector<double>: a stack of maximum duration filled by the functor
  * member 1: double: the duration of the current measure
  * member 2: the current bpm
+ * member 3: the tempo adjustment
+ * member 4: the repeat (1-based) of the section being processed with an expansion by reference
  **/
 
 class CalcMaxMeasureDurationParams : public FunctorParams {
@@ -793,6 +821,7 @@ public:
         m_maxCurrentRealTimeSeconds = 0.0;
         m_currentTempo = 120;
         m_tempoAdjustment = 1.0;
+        m_repeat = 1;
     }
     double m_currentScoreTime;
     double m_currentRealTimeSeconds;
@@ -800,6 +829,7 @@ public:
     double m_maxCurrentRealTimeSeconds;
     int m_currentTempo;
     double m_tempoAdjustment;
+    int m_repeat;
 };
 
 //----------------------------------------------------------------------------
@@ -952,6 +982,7 @@ public:
  * member 5: the current scoreDef width
  * member 6: the current pending objects (ScoreDef, Endings, etc.) to be place at the beginning of a system
  * member 7: the doc
+ * member 8: a flag indicating that the measures have the cached horizontal layout and were not laid out again
  **/
 
 class CastOffSystemsParams : public FunctorParams {
@@ -965,6 +996,7 @@ public:
         m_systemWidth = 0;
         m_currentScoreDefWidth = 0;
         m_doc = doc;
+        m_useCachedLayout = false;
     }
     System *m_contentSystem;
     Page *m_page;
@@ -974,6 +1006,7 @@ public:
     int m_currentScoreDefWidth;
     ArrayOfObjects m_pendingObjects;
     Doc *m_doc;
+    bool m_useCachedLayout;
 };
 
 //----------------------------------------------------------------------------
@@ -1294,6 +1327,7 @@ public:
  * member 3: double: the score time from the start of the music to the start of the current measure
  * member 4: int: the semi tone transposition for the current track
  * member 5: int with the current tempo
+ * member 6: the repeat (1-based) of the section being processed with an expansion by reference
  **/
 
 class GenerateMIDIParams : public FunctorParams {
@@ -1306,6 +1340,7 @@ public:
         m_totalTime = 0.0;
         m_transSemi = 0;
         m_currentTempo = 120;
+        m_repeat = 1;
         m_functor = functor;
     }
     smf::MidiFile *m_midiFile;
@@ -1314,21 +1349,49 @@ public:
     double m_totalTime;
     int m_transSemi;
     int m_currentTempo;
+    int m_repeat;
     Functor *m_functor;
 };
 
+//----------------------------------------------------------------------------
+// TimemapEvent
+//----------------------------------------------------------------------------
+
+/**
+ * This class stores a note on or off event collected for the timemap.
+ * Events are sorted by real time once they have all been collected.
+ * The repeat is the one of the note when the expansion is done by reference.
+ **/
+
+class TimemapEvent {
+public:
+    TimemapEvent(double realTime, double scoreTime, int tempo, bool isOn, Object *object, int repeat = 1)
+    {
+        m_realTime = realTime;
+        m_scoreTime = scoreTime;
+        m_tempo = tempo;
+        m_isOn = isOn;
+        m_object = object;
+        m_repeat = repeat;
+    }
+    double m_realTime;
+    double m_scoreTime;
+    int m_tempo;
+    bool m_isOn;
+    Object *m_object;
+    int m_repeat;
+};
+
 //----------------------------------------------------------------------------
 // GenerateTimemapParams
 //----------------------------------------------------------------------------
 
 /**
- * member 0: mapping of real times to score times
- * member 1: mapping of real times to elements which should be highlighted at time
- * member 2: mapping of real times to elements which should be unhighlighted at time
- * member 3: mapping of real times to tempos
- * member 4: Score time from the start of the piece to previous barline in quarter notes
- * member 5: Real time from the start of the piece to previous barline in ms
- * member 6: Currently active tempo
+ * member 0: the note on and off events (in document order, sorted only afterwards)
+ * member 1: Score time from the start of the piece to previous barline in quarter notes
+ * member 2: Real time from the start of the piece to previous barline in ms
+ * member 3: Currently active tempo
+ * member 4: the repeat (1-based) of the section being processed with an expansion by reference
  **/
 
 class GenerateTimemapParams : public FunctorParams {
@@ -1338,15 +1401,14 @@ public:
         m_scoreTimeOffset = 0.0;
         m_realTimeOffsetMilliseconds = 0;
         m_currentTempo = 120;
+        m_repeat = 1;
         m_functor = functor;
     }
-    std::map<double, double> realTimeToScoreTime;
-    std::map<double, std::vector<std::string> > realTimeToOnElements;
-    std::map<double, std::vector<std::string> > realTimeToOffElements;
-    std::map<double, int> realTimeToTempo;
+    ArrayOfTimemapEvents m_timemapEvents;
     double m_scoreTimeOffset;
     double m_realTimeOffsetMilliseconds;
     int m_currentTempo;
+    int m_repeat;
     Functor *m_functor;
 };
 
@@ -1372,6 +1434,34 @@ public:
     Functor *m_functor;
 };
 
+//----------------------------------------------------------------------------
+// GetMemoryUsageParams
+//----------------------------------------------------------------------------
+
+/**
+ * member 0: the object count and the approximate bytes for each class name
+ * member 1: the object count and the approximate bytes of the aligners and their alignments
+ * member 2: the count and the approximate bytes of the floating positioners
+ * member 3: the count and the approximate bytes of the beam segments
+ * member 4: the functor to be redirected to the aligners
+ **/
+
+class GetMemoryUsageParams : public FunctorParams {
+public:
+    GetMemoryUsageParams(Functor *functor)
+    {
+        m_aligners = { 0, 0 };
+        m_floatingPositioners = { 0, 0 };
+        m_beamSegments = { 0, 0 };
+        m_functor = functor;
+    }
+    MapOfStrMemoryUsages m_objects;
+    std::pair<int, size_t> m_aligners;
+    std::pair<int, size_t> m_floatingPositioners;
+    std::pair<int, size_t> m_beamSegments;
+    Functor *m_functor;
+};
+
 //----------------------------------------------------------------------------
 // GetRelativeLayerElementParams
 //----------------------------------------------------------------------------
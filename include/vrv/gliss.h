@@ -39,6 +39,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Gliss"; }
     virtual ClassId GetClassId() const { return GLISS; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
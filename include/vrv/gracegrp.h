@@ -30,6 +30,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "GraceGrp"; };
     virtual ClassId GetClassId() const { return GRACEGRP; };
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -40,6 +40,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "GrpSym"; }
     virtual ClassId GetClassId() const { return GRPSYM; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -41,6 +41,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Hairpin"; }
     virtual ClassId GetClassId() const { return HAIRPIN; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -42,6 +42,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Harm"; }
     virtual ClassId GetClassId() const { return HARM; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -77,6 +77,7 @@ public:
     virtual ~Alignment();
     virtual void Reset();
     virtual ClassId GetClassId() const { return ALIGNMENT; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -279,6 +280,7 @@ public:
     virtual ~AlignmentReference();
     virtual void Reset();
     virtual ClassId GetClassId() const { return ALIGNMENT_REFERENCE; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -415,6 +417,7 @@ public:
     MeasureAligner();
     virtual ~MeasureAligner();
     virtual ClassId GetClassId() const { return MEASURE_ALIGNER; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     virtual void Reset();
     ///@}
 
@@ -537,6 +540,7 @@ public:
     GraceAligner();
     virtual ~GraceAligner();
     virtual ClassId GetClassId() const { return GRACE_ALIGNER; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     virtual void Reset();
     ///@}
 
@@ -618,6 +622,7 @@ public:
     TimestampAligner();
     virtual ~TimestampAligner();
     virtual ClassId GetClassId() const { return TIMESTAMP_ALIGNER; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
 
     /**
      * Reset the aligner (clear the content)
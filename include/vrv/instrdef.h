@@ -39,6 +39,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "InstrDef"; }
     virtual ClassId GetClassId() const { return INSTRDEF; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     //----------//
@@ -8,7 +8,9 @@
 #ifndef __VRV_IOMEI_H__
 #define __VRV_IOMEI_H__
 
+#include <list>
 #include <sstream>
+#include <unordered_set>
 
 //----------------------------------------------------------------------------
 
@@ -208,6 +210,21 @@ private:
      */
     void WriteXmlId(pugi::xml_node currentNode, Object *object);
 
+    /**
+     * @name Methods for streaming the output.
+     * Completed measures are written to the output stream as soon as they are closed and removed from the tree.
+     * Their ancestors are opened once when the first measure is streamed and closed when they are popped.
+     * The output is byte-identical to the one of the pugi::xml_document saved as a whole.
+     */
+    ///@{
+    void StreamMeasure(pugi::xml_node measure);
+    void StreamNodeEnd(pugi::xml_node node);
+    void StreamDocEnd(pugi::xml_document &meiDoc);
+    void StreamChildren(pugi::xml_node parent, pugi::xml_node last, int depth);
+    void StreamStartTag(pugi::xml_node node, int depth);
+    bool IsStreamable(pugi::xml_node node);
+    ///@}
+
     /**
      * @name Methods for writing MEI body elements.
      */
@@ -425,7 +442,13 @@ private:
     pugi::xml_node m_currentNode;
     std::list<pugi::xml_node> m_nodeStack;
     bool m_removeIds;
-    ListOfObjects m_referredObjects;
+    std::unordered_set<Object *> m_referredObjects;
+    /** @name Streaming of the output */
+    ///@{
+    std::string m_indentString;
+    unsigned int m_outputFlags;
+    std::vector<pugi::xml_node> m_streamedNodes;
+    ///@}
 };
 
 //----------------------------------------------------------------------------
@@ -661,6 +684,14 @@ private:
      */
     void ReadUnsupportedAttr(pugi::xml_node element, Object *object);
 
+    /**
+     * Remove a node from the XML tree once it has been read.
+     * This is done only when reading incrementally (see Options::m_incrementalImport).
+     * The next sibling must have been retrieved by the caller beforehand. Since pugixml parses the whole data in
+     * place before it is read, this does not reduce the peak memory usage of the import.
+     */
+    void ReleaseConsumedNode(pugi::xml_node parentNode, pugi::xml_node node);
+
     /**
      * Returns true if the element is name is an editorial element (e.g., "app", "supplied", etc.)
      */
@@ -721,6 +752,11 @@ private:
      */
     bool m_readingScoreBased;
 
+    /**
+     * A flag indicating if the XML nodes of sections, measures or pages are removed once read
+     */
+    bool m_releaseConsumedNodes;
+
     /**
      * This is used when reading a standard MEI file to specify if a scoreDef has already been read or not.
      */
@@ -748,6 +784,15 @@ private:
      */
     bool m_useScoreDefForDoc;
 
+    /**
+     * @name The reading selection queries, compiled once for all the <app>, <choice> and <subst> elements
+     */
+    ///@{
+    std::list<pugi::xpath_query> m_appXPathQueries;
+    std::list<pugi::xpath_query> m_choiceXPathQueries;
+    std::list<pugi::xpath_query> m_substXPathQueries;
+    ///@}
+
     /**
      * The comment to be attached to the next Object
      */
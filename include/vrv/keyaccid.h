@@ -38,6 +38,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "KeyAccid"; }
     virtual ClassId GetClassId() const { return KEYACCID; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     virtual PitchInterface *GetPitchInterface() { return dynamic_cast<PitchInterface *>(this); }
@@ -46,6 +46,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "KeySig"; }
     virtual ClassId GetClassId() const { return KEYSIG; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
 
     /** Override the method since alignment is required */
     virtual bool HasToBeAligned() const { return true; }
@@ -33,6 +33,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Label"; }
     virtual ClassId GetClassId() const { return LABEL; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -33,6 +33,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "LabelAbbr"; }
     virtual ClassId GetClassId() const { return LABELABBR; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -48,6 +48,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Layer"; }
     virtual ClassId GetClassId() const { return LAYER; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -23,9 +23,11 @@ class Alignment;
 class Beam;
 class BeamElementCoord;
 class Layer;
+class Measure;
 class Mensur;
 class MeterSig;
 class Staff;
+class System;
 
 //----------------------------------------------------------------------------
 // LayerElement
@@ -51,6 +53,7 @@ public:
     virtual ~LayerElement();
     virtual void Reset();
     virtual ClassId GetClassId() const { return LAYER_ELEMENT; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -179,6 +182,18 @@ public:
      */
     Staff *GetCrossStaff(Layer *&layer) const;
 
+    /**
+     * @name Get the staff, layer, measure and system the element is in (NULL if none).
+     * The staff, layer and measure are cached and looked for again only when the structure changed (see
+     * Object::GetStructureVersion). The system is looked for from the measure since the cast-off changes it.
+     */
+    ///@{
+    Staff *GetAncestorStaff() const;
+    Layer *GetAncestorLayer() const;
+    Measure *GetAncestorMeasure() const;
+    System *GetAncestorSystem() const;
+    ///@}
+
     /**
      * @name Setter and getter for the Alignment the grace note is pointing to (NULL by default)
      */
@@ -403,11 +418,32 @@ protected:
         const std::set<int> &firstChord, const std::set<int> &secondChord, data_STEMDIRECTION stemDirection);
 
 private:
+    /**
+     * Look for the staff, layer and measure ancestors and cache them for the current structure version and parent.
+     * The parent is also checked because a copied element keeps the cached values but not the parent.
+     */
+    void UpdateAncestors() const;
+    bool HasValidAncestors() const
+    {
+        return (m_ancestorsVersion == Object::GetStructureVersion()) && (m_ancestorsParent == this->GetParent());
+    }
+
     /**
      * Indicates whether it is a ScoreDef or StaffDef attribute
      */
     ElementScoreDefRole m_scoreDefRole;
 
+    /**
+     * The cached ancestors with the structure version (0 for none) and the parent they are valid for
+     */
+    ///@{
+    mutable Object *m_ancestorsParent;
+    mutable Staff *m_ancestorStaff;
+    mutable Layer *m_ancestorLayer;
+    mutable Measure *m_ancestorMeasure;
+    mutable unsigned long m_ancestorsVersion;
+    ///@}
+
     /**
      * The cached alignment layer @n.
      * This also stores the negative values for identifying cross-staff
@@ -33,6 +33,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Lb"; }
     virtual ClassId GetClassId() const { return LB; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -30,6 +30,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Lem"; }
     virtual ClassId GetClassId() const { return LEM; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
 private:
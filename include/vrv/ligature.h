@@ -38,6 +38,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Ligature"; }
     virtual ClassId GetClassId() const { return LIGATURE; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /** Override the method since alignment is required */
@@ -34,6 +34,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Mdiv"; }
     virtual ClassId GetClassId() const { return MDIV; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
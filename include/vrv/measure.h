@@ -52,6 +52,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Measure"; }
     virtual ClassId GetClassId() const { return MEASURE; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -218,6 +219,12 @@ public:
      */
     double GetRealTimeOffsetMilliseconds(int repeat) const;
 
+    /**
+     * Return the score time offset in quarter notes for the repeat (1-based).
+     * The last one is returned if the measure is not performed that many times.
+     */
+    double GetScoreTimeOffset(int repeat) const;
+
     //----------//
     // Functors //
     //----------//
@@ -346,6 +353,11 @@ public:
      */
     virtual int CastOffEncoding(FunctorParams *functorParams);
 
+    /**
+     * See Object::CacheHorizontalLayout
+     */
+    virtual int CacheHorizontalLayout(FunctorParams *functorParams);
+
     /**
      * See Object::ResetDrawing
      */
@@ -415,6 +427,11 @@ public:
      */
     virtual int PrepareTimestampsEnd(FunctorParams *functorParams);
 
+    /**
+     * See Object::GetMemoryUsage
+     */
+    virtual int GetMemoryUsage(FunctorParams *functorParams);
+
 public:
     /**
      * The X absolute position of the measure for facsimile (transcription) encodings.
@@ -439,6 +456,14 @@ protected:
      */
     int m_drawingXRel;
 
+private:
+    /**
+     * Calculate the key of the horizontal layout from a hash of the options, with the time, the type and the
+     * reference count of the alignments. The alignments of the scoreDef at the beginning and at the end of the measure
+     * are left out since they change with the system the measure is cast off to.
+     */
+    uint64_t CalcHorizontalLayoutKey(uint64_t optionsHash) const;
+
 private:
     bool m_measuredMusic;
 
@@ -475,6 +500,20 @@ private:
     std::vector<double> m_scoreTimeOffset;
     std::vector<double> m_realTimeOffsetMilliseconds;
     int m_currentTempo;
+
+    /**
+     * @name The horizontal layout of the measure in the content page before it was cast off, and thus unjustified.
+     * The width and the overflow are used for casting off the systems with the cached layout and the time, type and x
+     * position of the alignments for restoring it. The key is a hash of the options of the horizontal layout and of
+     * the alignments of the content, see Measure::CalcHorizontalLayoutKey.
+     */
+    ///@{
+    int m_cachedXRel;
+    int m_cachedWidth;
+    int m_cachedOverflow;
+    uint64_t m_cachedLayoutKey;
+    std::vector<std::tuple<double, AlignmentType, int> > m_cachedAlignments;
+    ///@}
 };
 
 } // namespace vrv
@@ -44,6 +44,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Mensur"; }
     virtual ClassId GetClassId() const { return MENSUR; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /** Override the method since alignment is required */
@@ -36,6 +36,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "MeterSig"; }
     virtual ClassId GetClassId() const { return METERSIG; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /** Override the method since alignment is required */
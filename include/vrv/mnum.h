@@ -42,6 +42,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "MNum"; }
     virtual ClassId GetClassId() const { return MNUM; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -42,6 +42,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Mordent"; }
     virtual ClassId GetClassId() const { return MORDENT; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
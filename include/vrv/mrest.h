@@ -39,6 +39,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "MRest"; }
     virtual ClassId GetClassId() const { return MREST; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
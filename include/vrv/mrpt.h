@@ -36,6 +36,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "MRpt"; }
     virtual ClassId GetClassId() const { return MRPT; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     //----------//
@@ -32,6 +32,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "MSpace"; }
     virtual ClassId GetClassId() const { return MSPACE; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     //----------//
@@ -41,6 +41,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "MultiRest"; }
     virtual ClassId GetClassId() const { return MULTIREST; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
 private:
@@ -35,6 +35,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "MultiRpt"; }
     virtual ClassId GetClassId() const { return MULTIRPT; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
 private:
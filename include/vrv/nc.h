@@ -49,6 +49,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Nc"; }
     virtual ClassId GetClassId() const { return NC; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
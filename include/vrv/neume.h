@@ -70,6 +70,7 @@ public:
     virtual Object *Clone() const { return new Neume(*this); }
     virtual std::string GetClassName() const { return "Neume"; }
     virtual ClassId GetClassId() const { return NEUME; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
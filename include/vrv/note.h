@@ -71,6 +71,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Note"; }
     virtual ClassId GetClassId() const { return NOTE; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -34,6 +34,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Num"; }
     virtual ClassId GetClassId() const { return NUM; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
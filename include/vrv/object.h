@@ -8,6 +8,9 @@
 #ifndef __VRV_OBJECT_H__
 #define __VRV_OBJECT_H__
 
+#include <assert.h>
+#include <atomic>
+#include <bitset>
 #include <cstdlib>
 #include <ctime>
 #include <iterator>
@@ -43,6 +46,32 @@ class Zone;
 #define FORWARD true
 #define BACKWARD false
 
+//----------------------------------------------------------------------------
+// ClassIdDescriptor
+//----------------------------------------------------------------------------
+
+/**
+ * This class describes the MEI att classes and the interfaces of the objects of a ClassId.
+ * It is built once from the first object of the ClassId looked at and shared by all the others. It also holds the
+ * offsets of the att classes from the Object, which makes the att class and interface checks and the casts to the
+ * att classes constant-time.
+ */
+class ClassIdDescriptor {
+public:
+    ClassIdDescriptor(
+        const Object *object, const std::vector<AttClassId> &attClasses, const std::vector<InterfaceId> &interfaces);
+
+    bool HasAttClass(AttClassId attClassId) const { return m_attClasses.test(attClassId); }
+    bool HasInterface(InterfaceId interfaceId) const { return m_interfaces.test(interfaceId); }
+    int GetAttOffset(AttClassId attClassId) const { return m_attOffsets[attClassId]; }
+
+private:
+    std::bitset<ATT_CLASS_max> m_attClasses;
+    std::bitset<INTERFACE_max> m_interfaces;
+    /** The offsets of the att classes, VRV_UNSET for the ones not registered */
+    std::vector<int> m_attOffsets;
+};
+
 //----------------------------------------------------------------------------
 // Object
 //----------------------------------------------------------------------------
@@ -62,6 +91,7 @@ public:
     virtual ~Object();
     virtual ClassId GetClassId() const;
     virtual std::string GetClassName() const { return "[MISSING]"; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -123,15 +153,46 @@ public:
     void RegisterAttClass(AttClassId attClassId) { m_attClasses.push_back(attClassId); }
     bool HasAttClass(AttClassId attClassId) const
     {
-        return std::find(m_attClasses.begin(), m_attClasses.end(), attClassId) != m_attClasses.end();
+        assert(this->GetClassIdDescriptor()->HasAttClass(attClassId)
+            == (std::find(m_attClasses.begin(), m_attClasses.end(), attClassId) != m_attClasses.end()));
+        return this->GetClassIdDescriptor()->HasAttClass(attClassId);
     }
     void RegisterInterface(std::vector<AttClassId> *attClasses, InterfaceId interfaceId);
     bool HasInterface(InterfaceId interfaceId) const
     {
-        return std::find(m_interfaces.begin(), m_interfaces.end(), interfaceId) != m_interfaces.end();
+        assert(this->GetClassIdDescriptor()->HasInterface(interfaceId)
+            == (std::find(m_interfaces.begin(), m_interfaces.end(), interfaceId) != m_interfaces.end()));
+        return this->GetClassIdDescriptor()->HasInterface(interfaceId);
     }
     ///@}
 
+    /**
+     * @name Return the object as one of its registered MEI att classes (NULL if not registered).
+     * The cast uses the offset of the ClassIdDescriptor and is checked against a dynamic_cast in debug builds.
+     */
+    ///@{
+    template <class ATT> ATT *GetAttClass(AttClassId attClassId)
+    {
+        const int offset = this->GetClassIdDescriptor()->GetAttOffset(attClassId);
+        ATT *att = (offset != VRV_UNSET) ? reinterpret_cast<ATT *>(reinterpret_cast<char *>(this) + offset) : NULL;
+        assert(!att || (att == dynamic_cast<ATT *>(this)));
+        return att;
+    }
+    template <class ATT> const ATT *GetAttClass(AttClassId attClassId) const
+    {
+        return const_cast<Object *>(this)->GetAttClass<ATT>(attClassId);
+    }
+    ///@}
+
+    /**
+     * Return the ClassIdDescriptor of the object ClassId, which is created the first time.
+     */
+    const ClassIdDescriptor *GetClassIdDescriptor() const
+    {
+        const ClassIdDescriptor *descriptor = s_classIdDescriptors[this->GetClassId()].load(std::memory_order_acquire);
+        return (descriptor) ? descriptor : this->CreateClassIdDescriptor();
+    }
+
     virtual DurationInterface *GetDurationInterface() { return NULL; }
     virtual LinkingInterface *GetLinkingInterface() { return NULL; }
     virtual FacsimileInterface *GetFacsimileInterface() { return NULL; }
@@ -317,7 +378,15 @@ public:
      * Reset the parent of the Object.
      * The current parent is not expected to be NULL.
      */
-    void ResetParent() { m_parent = NULL; }
+    void ResetParent();
+
+    /**
+     * Return a counter incremented each time a staff, a layer, a layer element or an editorial element with children
+     * is given a parent, or loses it. This is used for validating the ancestors cached by the layer elements.
+     * The counter is shared by all the documents and is atomic since they can be in different threads. A change in
+     * another document only invalidates the cached ancestors.
+     */
+    static unsigned long GetStructureVersion() { return s_structureVersion.load(std::memory_order_relaxed); }
 
     /**
      * Base method for checking if a child can be added.
@@ -1148,6 +1217,12 @@ public:
      */
     virtual int UnCastOff(FunctorParams *) { return FUNCTOR_CONTINUE; }
 
+    /**
+     * Cache or restore the horizontal layout of the content page used for casting off systems.
+     * This is used by Doc::CastOffDoc for not redoing the horizontal layout when only the page size changes.
+     */
+    virtual int CacheHorizontalLayout(FunctorParams *) { return FUNCTOR_CONTINUE; }
+
     ///@}
 
     /**
@@ -1205,6 +1280,12 @@ public:
      */
     virtual int Transpose(FunctorParams *) { return FUNCTOR_CONTINUE; }
 
+    /**
+     * Count the objects and sum their approximate bytes, including the layout structures.
+     * See Doc::GetMemoryUsage
+     */
+    virtual int GetMemoryUsage(FunctorParams *functorParams);
+
     static bool sortByUlx(Object *a, Object *b);
 
 protected:
@@ -1220,6 +1301,16 @@ private:
      */
     void Init(const std::string &);
 
+    /**
+     * Increment the structure version if the object is an ancestor cached by the layer elements (or one itself).
+     */
+    void UpdateStructureVersion();
+
+    /**
+     * Create the ClassIdDescriptor of the object ClassId if it does not exist yet (thread-safe).
+     */
+    const ClassIdDescriptor *CreateClassIdDescriptor() const;
+
 public:
     /**
      * Keep an array of unsupported attributes as pairs.
@@ -1307,6 +1398,16 @@ private:
      * A static counter for uuid generation.
      */
     static unsigned long s_objectCounter;
+
+    /**
+     * A static counter for the changes of parent (see Object::GetStructureVersion).
+     */
+    static std::atomic<unsigned long> s_structureVersion;
+
+    /**
+     * The ClassIdDescriptor of each ClassId, created when first needed (see Object::GetClassIdDescriptor).
+     */
+    static std::atomic<const ClassIdDescriptor *> s_classIdDescriptors[UNSPECIFIED + 1];
 };
 
 //----------------------------------------------------------------------------
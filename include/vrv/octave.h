@@ -42,6 +42,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Octave"; }
     virtual ClassId GetClassId() const { return OCTAVE; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -12,6 +12,7 @@
 #include "custom_options.h"
 #else
 
+#include <cstdint>
 #include <map>
 #include <string>
 #include <vector>
@@ -63,6 +64,17 @@ enum option_MEASURENUMBER { MEASURENUMBER_system = 0, MEASURENUMBER_interval };
 
 enum option_SYSTEMDIVIDER { SYSTEMDIVIDER_none = 0, SYSTEMDIVIDER_auto, SYSTEMDIVIDER_left, SYSTEMDIVIDER_left_right };
 
+/**
+ * What has to be computed again when the value of an option changes, from the least to the most expensive
+ */
+enum option_INVALIDATION {
+    INVALIDATION_render = 0,
+    INVALIDATION_layout,
+    INVALIDATION_castOff,
+    INVALIDATION_prepare,
+    INVALIDATION_reload
+};
+
 //----------------------------------------------------------------------------
 // Option
 //----------------------------------------------------------------------------
@@ -73,7 +85,7 @@ enum option_SYSTEMDIVIDER { SYSTEMDIVIDER_none = 0, SYSTEMDIVIDER_auto, SYSTEMDI
 class Option {
 public:
     // constructors and destructors
-    Option() : m_isSet(false) {}
+    Option() : m_isSet(false), m_invalidation(INVALIDATION_render) {}
     virtual ~Option() {}
     virtual void CopyTo(Option *option);
 
@@ -93,6 +105,14 @@ public:
 
     bool isSet() const { return m_isSet; }
 
+    /**
+     * The invalidation level of the option (render by default)
+     */
+    ///@{
+    void SetInvalidation(option_INVALIDATION invalidation) { m_invalidation = invalidation; }
+    option_INVALIDATION GetInvalidation() const { return m_invalidation; }
+    ///@}
+
 public:
     /**
      * Static maps used my OptionIntMap objects. Set in OptIntMap::Init
@@ -108,6 +128,7 @@ protected:
     std::string m_title;
     std::string m_description;
     bool m_isSet;
+    option_INVALIDATION m_invalidation;
 
 private:
     std::string m_key;
@@ -478,6 +499,31 @@ public:
     // post processing of parameters
     void Sync();
 
+    /**
+     * Return a hash of the key and value of the options with at least an invalidation level.
+     * It changes whenever one of these option values changes and is stable between runs.
+     */
+    uint64_t GetHash(option_INVALIDATION invalidation) const;
+
+    /**
+     * Return a hash of the key and value of the options changing the horizontal layout of the measures.
+     * These are the options changing the cast-off, except for the page size, the margins and the condensing.
+     */
+    uint64_t GetHorizontalLayoutHash() const;
+
+    /**
+     * Get the values of all the options and, from these, the highest invalidation level of the options changed since.
+     */
+    ///@{
+    std::vector<std::string> GetValues() const;
+    option_INVALIDATION GetInvalidation(const std::vector<std::string> &values) const;
+    ///@}
+
+    /**
+     * Set back the values of the options of an invalidation level to the ones of other options.
+     */
+    void RestoreValues(const Options &options, option_INVALIDATION invalidation);
+
 private:
     void Register(Option *option, const std::string &key, OptionGrp *grp);
 
@@ -499,7 +545,9 @@ public:
     OptionBool m_condenseTempoPages;
     OptionBool m_evenNoteSpacing;
     OptionBool m_humType;
+    OptionBool m_incrementalImport;
     OptionBool m_justifyVertically;
+    OptionBool m_keepLoadedData;
     OptionBool m_landscape;
     OptionBool m_mensuralToMeasure;
     OptionDbl m_midiTempoAdjustment;
@@ -519,10 +567,13 @@ public:
     OptionInt m_pageMarginTop;
     OptionInt m_pageWidth;
     OptionString m_expand;
+    OptionBool m_expandByReference;
+    OptionBool m_progressiveCastOff;
     OptionBool m_shrinkToFit;
     OptionBool m_svgBoundingBoxes;
     OptionBool m_svgViewBox;
     OptionBool m_svgHtml5;
+    OptionInt m_svgCacheSize;
     OptionInt m_unit;
     OptionBool m_useFacsimile;
     OptionBool m_usePgFooterForAll;
@@ -599,6 +650,7 @@ public:
     OptionArray m_substXPathQuery;
     OptionString m_transpose;
     OptionBool m_transposeSelectedOnly;
+    OptionInt m_work;
 
     /**
      * Element margins
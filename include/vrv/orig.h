@@ -30,6 +30,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Orig"; }
     virtual ClassId GetClassId() const { return ORIG; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
 private:
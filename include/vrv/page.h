@@ -16,6 +16,7 @@ namespace vrv {
 class DeviceContext;
 class PrepareProcessingListsParams;
 class RunningElement;
+class SpatialIndex;
 class Staff;
 class System;
 
@@ -40,6 +41,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Page"; }
     virtual ClassId GetClassId() const { return PAGE; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -94,6 +96,11 @@ public:
      */
     void LayOutTranscription(bool force = false);
 
+    /**
+     * Mark the layout as to be done again on the next call of LayOut
+     */
+    void ResetLayoutDone() { m_layoutDone = false; }
+
     /**
      * Lay out the content of the page (measures and their content) horizontally
      */
@@ -119,6 +126,22 @@ public:
      */
     void LayOutPitchPos();
 
+    /**
+     * Return the spatial index of the objects of the page, filled from the layout when first needed.
+     * The index is reset when the page is laid out again and has to be reset when objects are removed.
+     */
+    SpatialIndex *GetSpatialIndex();
+
+    /**
+     * Return the spatial index of the page only if it is already filled (NULL otherwise)
+     */
+    const SpatialIndex *GetFilledSpatialIndex() const { return m_spatialIndex; }
+
+    /**
+     * Delete the spatial index of the page (if any)
+     */
+    void ResetSpatialIndex();
+
     /**
      * Return the height of the content by looking at the last system of the page.
      * This is used for adjusting the page height when this is the expected behaviour,
@@ -221,6 +244,11 @@ private:
      * the force parameter is set.
      */
     bool m_layoutDone;
+
+    /**
+     * The spatial index of the page, filled on demand
+     */
+    SpatialIndex *m_spatialIndex;
 };
 
 } // namespace vrv
@@ -35,6 +35,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Pages"; }
     virtual ClassId GetClassId() const { return PAGES; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
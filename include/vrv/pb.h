@@ -34,6 +34,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Pb"; }
     virtual ClassId GetClassId() const { return PB; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     //----------//
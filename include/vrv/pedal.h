@@ -43,6 +43,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Pedal"; }
     virtual ClassId GetClassId() const { return PEDAL; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
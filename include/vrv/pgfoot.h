@@ -31,6 +31,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "PgFoot"; }
     virtual ClassId GetClassId() const { return PGFOOT; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     //----------//
@@ -31,6 +31,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "PgFoot2"; }
     virtual ClassId GetClassId() const { return PGFOOT2; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     //----------//
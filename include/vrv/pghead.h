@@ -31,6 +31,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "PgHead"; }
     virtual ClassId GetClassId() const { return PGHEAD; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     bool GenerateFromMEIHeader(pugi::xml_document &header);
@@ -29,6 +29,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Phrase"; }
     virtual ClassId GetClassId() const { return PHRASE; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     //----------//
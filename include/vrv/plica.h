@@ -30,6 +30,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Plica"; }
     virtual ClassId GetClassId() const { return PLICA; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
 
     //----------//
     // Functors //
@@ -30,6 +30,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Reg"; }
     virtual ClassId GetClassId() const { return REG; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
 private:
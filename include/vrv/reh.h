@@ -41,6 +41,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Reh"; }
     virtual ClassId GetClassId() const { return REH; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
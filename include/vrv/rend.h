@@ -40,6 +40,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Rend"; }
     virtual ClassId GetClassId() const { return REND; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -50,6 +50,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Rest"; }
     virtual ClassId GetClassId() const { return REST; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
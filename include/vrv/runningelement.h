@@ -37,6 +37,7 @@ public:
     virtual ~RunningElement();
     virtual void Reset();
     virtual ClassId GetClassId() const { return RUNNING_ELEMENT; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -35,6 +35,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Score"; }
     virtual ClassId GetClassId() const { return SCORE; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
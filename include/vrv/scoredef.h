@@ -49,6 +49,7 @@ public:
     virtual ~ScoreDefElement();
     virtual void Reset();
     virtual ClassId GetClassId() const { return SCOREDEF_ELEMENT; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -124,6 +125,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "ScoreDef"; }
     virtual ClassId GetClassId() const { return SCOREDEF; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     virtual bool IsSupportedChild(Object *object);
@@ -37,6 +37,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Section"; }
     virtual ClassId GetClassId() const { return SECTION; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -30,6 +30,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Sic"; }
     virtual ClassId GetClassId() const { return SIC; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
 private:
@@ -35,6 +35,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Slur"; }
     virtual ClassId GetClassId() const { return SLUR; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -33,6 +33,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Space"; }
     virtual ClassId GetClassId() const { return SPACE; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
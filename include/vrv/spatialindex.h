@@ -0,0 +1,203 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        spatialindex.h
+// Author:      Laurent Pugin
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_SPATIAL_INDEX_H__
+#define __VRV_SPATIAL_INDEX_H__
+
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#include "bboxdevicecontext.h"
+#include "vrvdef.h"
+
+namespace vrv {
+
+class Doc;
+class Page;
+
+//----------------------------------------------------------------------------
+// SpatialIndex
+//----------------------------------------------------------------------------
+
+/**
+ * This class indexes the bounding boxes of the objects of a page in a uniform grid for hit-testing.
+ * The boxes are the ones of the laid-out page in logical coordinates, or the zones for facsimile documents.
+ * The objects are kept in the order they are added, which is the z-order (from bottom to top) when the index is
+ * filled from a page.
+ */
+class SpatialIndex {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    SpatialIndex();
+    virtual ~SpatialIndex();
+    ///@}
+
+    /**
+     * Remove all the objects.
+     */
+    void Reset();
+
+    /**
+     * Fill the index with the objects of the page, which has to be laid out.
+     * Objects are added with their content bounding box when drawing the page, or with their zone for facsimile
+     * documents.
+     */
+    void FillFromPage(Doc *doc, Page *page);
+
+    /**
+     * Add an object with its box (the corners can be given in any order).
+     * The grid is built again on the next query.
+     */
+    void Add(Object *object, int x1, int y1, int x2, int y2);
+
+    /**
+     * @name Getters for the number of objects in the index and the approximate bytes used by it
+     */
+    ///@{
+    int GetCount() const { return (int)m_entries.size(); }
+    size_t GetMemorySize() const;
+    ///@}
+
+    /**
+     * @name Find the objects with a box containing the point or intersecting the rectangle, in z-order.
+     */
+    ///@{
+    void FindAtPoint(int x, int y, ArrayOfObjects *objects);
+    void FindInRect(int x1, int y1, int x2, int y2, ArrayOfObjects *objects);
+    ///@}
+
+    /**
+     * Return the object of the ClassId closest to the point (NULL if none).
+     * The distance is the one to the box of the object unless a function is given. The search in the grid stops at
+     * the distance to the box, so the distance given by the function is never taken as smaller than it.
+     */
+    Object *FindClosest(int x, int y, ClassId classId, const std::function<int(Object *)> &distance = nullptr);
+
+private:
+    /**
+     * The box of an object in the index
+     */
+    struct Entry {
+        Object *m_object;
+        int m_x1;
+        int m_y1;
+        int m_x2;
+        int m_y2;
+    };
+
+    /**
+     * Build the grid with a cell size for an average of a few objects per cell.
+     */
+    void BuildGrid();
+
+    /**
+     * @name Return the column or row of the cell of a position, clamped to the grid
+     */
+    ///@{
+    int GetColumn(int x) const;
+    int GetRow(int y) const;
+    ///@}
+
+    /**
+     * Return the distance from a point to the box of an entry (0 if inside).
+     */
+    static int GetDistance(const Entry &entry, int x, int y);
+
+public:
+    //
+private:
+    /** The objects with their box, in z-order */
+    std::vector<Entry> m_entries;
+
+    /**
+     * The grid, with the index of the entries intersecting each cell (in ascending order)
+     */
+    ///@{
+    bool m_gridIsBuilt;
+    int m_gridX;
+    int m_gridY;
+    int m_cellSize;
+    int m_columns;
+    int m_rows;
+    std::vector<std::vector<int> > m_cells;
+    ///@}
+};
+
+//----------------------------------------------------------------------------
+// SpatialIndexDeviceContext
+//----------------------------------------------------------------------------
+
+/**
+ * This class calculates the bounding boxes of the page being drawn as a BBoxDeviceContext does and keeps the box of
+ * each object when its graphic ends, for adding them to a SpatialIndex in the order their graphic started.
+ * The floating objects are added with the bounding box of their current positioner, so an element spanning several
+ * systems is added once per system. Objects created by the view only for drawing are ignored.
+ */
+class SpatialIndexDeviceContext : public BBoxDeviceContext {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    SpatialIndexDeviceContext(View *view, SpatialIndex *spatialIndex);
+    virtual ~SpatialIndexDeviceContext();
+    ///@}
+
+    /**
+     * Add the objects drawn to the SpatialIndex, once the drawing is done
+     */
+    void AddToIndex();
+
+    /**
+     * @name Methods for starting and ending the graphics
+     */
+    ///@{
+    virtual void StartGraphic(
+        Object *object, std::string gClass, std::string gId, bool primary = true, bool prepend = false);
+    virtual void EndGraphic(Object *object, View *view);
+    ///@}
+
+private:
+    /**
+     * The box of an object drawn, set when its graphic ends
+     */
+    struct DrawnBox {
+        Object *m_object;
+        bool m_hasBox;
+        int m_x1;
+        int m_y1;
+        int m_x2;
+        int m_y2;
+    };
+
+    /**
+     * Return true if the object is one of the children of its parent.
+     * The children of each parent are looked up once during the drawing.
+     */
+    bool IsChildOfParent(Object *object);
+
+public:
+    //
+private:
+    SpatialIndex *m_spatialIndex;
+    /** The boxes in the order the graphic started, with the index of the ones not ended yet */
+    std::vector<DrawnBox> m_drawnBoxes;
+    std::vector<int> m_startedBoxes;
+    /** The children of the parents of the objects drawn */
+    std::unordered_map<Object *, std::unordered_set<Object *> > m_parentChildren;
+};
+
+} // namespace vrv
+
+#endif // __VRV_SPATIAL_INDEX_H__
@@ -46,6 +46,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Staff"; }
     virtual ClassId GetClassId() const { return STAFF; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -45,6 +45,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "StaffDef"; }
     virtual ClassId GetClassId() const { return STAFFDEF; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
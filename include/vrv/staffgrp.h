@@ -44,6 +44,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "StaffGrp"; }
     virtual ClassId GetClassId() const { return STAFFGRP; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
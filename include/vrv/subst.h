@@ -33,6 +33,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Subst"; }
     virtual ClassId GetClassId() const { return SUBST; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /** Getter for level **/
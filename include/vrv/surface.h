@@ -37,7 +37,9 @@ public:
     virtual ~Surface();
     virtual Object *Clone() const { return new Surface(*this); }
     virtual void Reset();
+    virtual std::string GetClassName() const { return "Surface"; }
     ClassId GetClassId() const { return SURFACE; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
     virtual bool IsSupportedChild(Object *object);
 
@@ -29,6 +29,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Svg"; }
     virtual ClassId GetClassId() const { return SVG; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
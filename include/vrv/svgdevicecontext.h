@@ -69,6 +69,20 @@ public:
      */
     std::string GetStringSVG(bool xml_declaration = false);
 
+    /**
+     * Get the SVG of a graphic drawn directly in the page (e.g., a system) into a string.
+     * Return an empty string if there is no graphic with this id.
+     */
+    std::string GetGraphicStringSVG(const std::string &gId);
+
+    /**
+     * @name Getters for the glyphs used so far and for the use of the VerovioText font
+     */
+    ///@{
+    const std::set<std::string> &GetSmuflGlyphs() const { return m_smuflGlyphs; }
+    bool UsesVrvTextFont() const { return m_vrvTextFont; }
+    ///@}
+
     /**
      * @name Drawing methods
      */
@@ -47,6 +47,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Syl"; }
     virtual ClassId GetClassId() const { return SYL; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /** Override the method since it is align to the staff */
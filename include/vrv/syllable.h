@@ -36,6 +36,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Syllable"; }
     virtual ClassId GetClassId() const { return SYLLABLE; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -44,6 +44,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "System"; }
     virtual ClassId GetClassId() const { return SYSTEM; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -257,6 +258,11 @@ public:
      */
     virtual int CastOffSystemsEnd(FunctorParams *functorParams);
 
+    /**
+     * See Object::GetMemoryUsage
+     */
+    virtual int GetMemoryUsage(FunctorParams *functorParams);
+
 public:
     SystemAligner m_systemAligner;
 
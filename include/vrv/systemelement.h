@@ -34,6 +34,7 @@ public:
     virtual ~SystemElement();
     virtual void Reset();
     virtual ClassId GetClassId() const { return SYSTEM_ELEMENT; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     //----------//
@@ -42,6 +42,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Tempo"; }
     virtual ClassId GetClassId() const { return TEMPO; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -33,6 +33,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Text"; }
     virtual ClassId GetClassId() const { return TEXT; }
+    virtual size_t GetMemorySize() const { return sizeof(*this) + m_text.capacity() * sizeof(wchar_t); }
     ///@}
 
     /**
@@ -32,6 +32,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "TextElement"; }
     virtual ClassId GetClassId() const { return TEXT_ELEMENT; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
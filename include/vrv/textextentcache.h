@@ -0,0 +1,95 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        textextentcache.h
+// Author:      Laurent Pugin
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_TEXT_EXTENT_CACHE_H__
+#define __VRV_TEXT_EXTENT_CACHE_H__
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#include "devicecontextbase.h"
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// TextExtentCache
+//----------------------------------------------------------------------------
+
+/**
+ * This class caches the text extents measured by DeviceContext::GetTextExtent.
+ * The extents are keyed by the string, the font size, the weight and the style of the text font. The music font,
+ * which provides the glyphs missing in the text font, is the same for all of them since the cache is cleared when
+ * it changes. The number of extents is bounded and the cache is cleared when it is full.
+ */
+class TextExtentCache {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    TextExtentCache();
+    virtual ~TextExtentCache();
+    ///@}
+
+    /**
+     * Remove all the extents.
+     */
+    void Reset();
+
+    /**
+     * Set the name of the music font and clear the cache if it changes.
+     */
+    void SetFontName(const std::string &fontName);
+
+    /**
+     * Look for the extent of a string, returning false if it is not cached.
+     */
+    bool Find(const std::wstring &text, int pointSize, const Resources::StyleAttributes &style, bool typeSize,
+        TextExtend &extend) const;
+
+    /**
+     * Add the extent of a string, clearing the cache first when it is full.
+     */
+    void Add(const std::wstring &text, int pointSize, const Resources::StyleAttributes &style, bool typeSize,
+        const TextExtend &extend);
+
+    /**
+     * @name Getters for the number of extents and the approximate bytes used by the cache
+     */
+    ///@{
+    int GetCount() const { return m_count; }
+    size_t GetMemorySize() const;
+    ///@}
+
+private:
+    /**
+     * An extent with the font parameters it was measured with
+     */
+    struct Entry {
+        int m_pointSize;
+        Resources::StyleAttributes m_style;
+        bool m_typeSize;
+        TextExtend m_extend;
+    };
+
+public:
+    //
+private:
+    /** The extents for each string, which usually has one or two font sizes and styles */
+    std::unordered_map<std::wstring, std::vector<Entry> > m_extents;
+    /** The number of extents in the cache */
+    int m_count;
+    /** The name of the music font the extents are measured with */
+    std::string m_fontName;
+};
+
+} // namespace vrv
+
+#endif // __VRV_TEXT_EXTENT_CACHE_H__
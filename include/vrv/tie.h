@@ -37,6 +37,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Tie"; }
     virtual ClassId GetClassId() const { return TIE; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
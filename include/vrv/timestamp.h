@@ -28,6 +28,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "TimestampAttr"; }
     virtual ClassId GetClassId() const { return TIMESTAMP_ATTR; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
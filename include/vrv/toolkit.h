@@ -8,18 +8,26 @@
 #ifndef __VRV_TOOLKIT_H__
 #define __VRV_TOOLKIT_H__
 
+#include <list>
+#include <set>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 //----------------------------------------------------------------------------
 
 #include "doc.h"
 #include "view.h"
+#include "workindex.h"
 
 //----------------------------------------------------------------------------
 
 namespace vrv {
 
+class DisplayListDeviceContext;
 class EditorToolkit;
+class SpatialIndex;
+class SvgDeviceContext;
 
 enum FileFormat {
     UNKNOWN = 0,
@@ -75,11 +83,36 @@ public:
      */
     bool LoadData(const std::string &data);
 
+    /**
+     * Return the works of a multi-work input as a JSON string, without loading it.
+     * The works are the tunes of an ABC tunebook, the segments of a Humdrum file or the top-level <mdiv> elements of
+     * an MEI file, each with its number for the work option, its byte offset and length in the data, its identifier
+     * (X: number, segment name or xml:id) and its title.
+     */
+    std::string GetWorks(const std::string &data);
+
     /**
      * Save an MEI file.
      */
     bool SaveFile(const std::string &filename, const std::string &jsonOptions);
 
+    /**
+     * @name Get and load a cast-off cache of the loaded document.
+     * The cache is the page-based MEI of the cast-off document, with a processing instruction giving the version and
+     * a hash of the options the cast-off depends on. It is not a compact form of the breaks: loading it parses and
+     * imports the whole MEI and prepares the drawing as for any MEI input. Only the cast-off (Doc::CastOffDoc, i.e.,
+     * the horizontal layout of the whole content and the system and page breaking), the transposition and the
+     * conversion of a non-MEI input are skipped. It is rejected if it was made with another version or different
+     * options. With Options::m_keepLoadedData, the options requiring to load the data again cannot be changed
+     * afterwards.
+     */
+    ///@{
+    std::string GetCastOffCache();
+    bool LoadCastOffCache(const std::string &cache);
+    bool SaveCastOffCacheFile(const std::string &filename);
+    bool LoadCastOffCacheFile(const std::string &filename);
+    ///@}
+
     /**
      * @name Getter and setter for options as JSON string
      */
@@ -97,6 +130,16 @@ public:
     bool SetOption(const std::string &option, const std::string &value);
     ///@}
 
+    /**
+     * Switch the selected mdiv and readings of the loaded MEI data without loading it again.
+     * The JSON object can have the mdivXPathQuery, appXPathQuery, choiceXPathQuery and substXPathQuery options,
+     * which are changed and applied to the mdivs and to the <app>, <choice> and <subst> elements kept in the document.
+     * The content is prepared and cast off again. Readings with sections and expansions still require the data to be
+     * loaded again. The first switch writes the whole document to MEI for finding the mdivs and readings. Return false
+     * without changing anything if an option is not one of these.
+     */
+    bool SwitchSelection(const std::string &jsonSelection);
+
     /**
      * Parse the editor actions passed as JSON string.
      * Only available for Emscripten-based compiles
@@ -142,6 +185,52 @@ public:
      */
     bool RenderToSVGFile(const std::string &filename, int pageNo = 1);
 
+    /**
+     * Render a region of a page to SVG and return it as a string.
+     * Only the systems and the measures intersecting the region are drawn. The region is in pixels from the top left
+     * corner of the page at the current scale, and the SVG has the size of the page as with RenderToSVG.
+     * Page number is 1-based.
+     */
+    std::string RenderToSVGRegion(int pageNo, int x, int y, int width, int height, bool xml_declaration = false);
+
+    /**
+     * Render to SVG the systems of a page changed since the previous call for the same page and return them as a
+     * JSON string.
+     * A system changed when it or its content was modified (see Object::Modify), when it was laid out again, or when
+     * it shares a time spanning element with a system that changed. Only these systems are drawn and the "changed"
+     * object gives their SVG <g> element keyed by their id. When the page has not been rendered with this method
+     * before, or when its systems, its size or the output options changed, "full" is true and "svg" has the entire
+     * SVG. The state of the last pages rendered is kept. Page number is 1-based.
+     */
+    std::string RenderToSVGDiff(int pageNo);
+
+    /**
+     * Record the drawing of the page for rendering it several times without drawing the page again.
+     * The display list needs to be created with the global styling of the output (e.g., SVG without mm output).
+     * Page number is 1-based.
+     */
+    bool RenderToDisplayList(int pageNo, DisplayListDeviceContext *displayList);
+
+    /**
+     * Render in SVG a page recorded with RenderToDisplayList and returns it as a string.
+     * The scale and the SVG options are the current ones. The display list remains valid until the document changes.
+     */
+    std::string RenderDisplayListToSVG(DisplayListDeviceContext *displayList, bool xml_declaration = false);
+
+    /**
+     * Return the statistics of the cache of the rendered SVG pages as a JSON string.
+     * The cache is enabled with Options::m_svgCacheSize.
+     */
+    std::string GetSVGCacheStats() const;
+
+    /**
+     * Return the approximate memory used by the toolkit as a JSON string.
+     * It gives the object count and bytes for each class of the document, the layout structures, the expansion
+     * map, the spatial indexes, the selection skeleton, the work index, the Humdrum buffer and the cached outputs. It does not change the document and its cost is linear in
+     * the number of objects, so it can be sampled periodically.
+     */
+    std::string GetMemoryUsage();
+
     /**
      * Creates a midi file, opens it, and writes to it.
      * currently generates a dummy midi file.
@@ -166,9 +255,15 @@ public:
 
     /**
      * Creates a timemap file, and return it as a JSON string.
+     * Options (JSON) can be:
+     * format: "json"|"binary"; "json" by default
+     * With "binary", the timemap is a compact buffer made of typed arrays with an interned uuid table (see
+     * Doc::PrepareBinaryTimemap). It is returned base64 encoded by RenderToTimemap and written as is to the file.
      */
-    std::string RenderToTimemap();
-    bool RenderToTimemapFile(const std::string &filename);
+    ///@{
+    std::string RenderToTimemap(const std::string &jsonOptions = "");
+    bool RenderToTimemapFile(const std::string &filename, const std::string &jsonOptions = "");
+    ///@}
 
     const char *GetHumdrumBuffer();
     void SetHumdrumBuffer(const char *contents);
@@ -182,6 +277,18 @@ public:
      */
     std::string GetElementsAtTime(int millisec);
 
+    /**
+     * @name Return the ids of the elements drawn at a point or intersecting a rectangle of a page as a JSON string.
+     * The ids are in z-order (from the bottom to the top) with the page number as "page". The point and the
+     * rectangle are in pixels from the top left corner of the page at the current scale as with RenderToSVGRegion, or
+     * in the coordinates of the zones for facsimile documents.
+     * Page number is 1-based.
+     */
+    ///@{
+    std::string GetElementsAtPoint(int pageNo, int x, int y);
+    std::string GetElementsInRect(int pageNo, int x, int y, int width, int height);
+    ///@}
+
     /**
      * Get the MEI as a string.
      * Options (JSON) can be:
@@ -210,8 +317,13 @@ public:
      * Redo the layout of the loaded data.
      * This can be called once the rendering option were changed,
      * For example with a new page (sceen) height or a new zoom level.
+     * Options (JSON) can be:
+     * resetCache: true|false; true by default
+     * The cache can be kept when only the page size (or margins) changed. The horizontal layout of the measures is
+     * then not recalculated and only the systems and the pages are cast off again. The cache is not used if the content
+     * of a measure or an option of the horizontal layout changed in the meantime.
      */
-    void RedoLayout();
+    void RedoLayout(const std::string &jsonOptions = "");
 
     /**
      * Redo the layout of the pitch postitions of the current drawing page.
@@ -276,9 +388,13 @@ public:
 
     /**
      * @name Get the pages for a loaded file
+     * With a progressive cast-off (see Options::m_progressiveCastOff), the page count is an estimation from the
+     * pages cast off so far until the last page is rendered or until a method needing all the pages is called.
+     * IsPageCountFinal returns false as long as the page count is such an estimation.
      */
     ///@{
     int GetPageCount();
+    bool IsPageCountFinal();
     ///@}
 
     /**
@@ -296,6 +412,60 @@ private:
     bool LoadUTF16File(const std::string &filename);
     void GetClassIds(const std::vector<std::string> &classStrings, std::vector<ClassId> &classIds);
 
+    /**
+     * Do what has to be computed again after option changes (see Options::GetInvalidation).
+     * Called before the pages are accessed.
+     */
+    void ApplyInvalidation();
+
+    /**
+     * Return true if the options requiring to load the data again can be applied, which is not the case when the
+     * loaded data is kept (Options::m_keepLoadedData) and the document was edited or restored from a cast-off cache.
+     * When the data is not kept, these options are always accepted and applied when the data is loaded next.
+     */
+    bool CanReload();
+
+    /**
+     * Generate the header, the footer and the measure numbers, prepare the drawing and cast off the document
+     * according to the breaks option, as after loading the data.
+     * With isCastOff, the document is already cast off (e.g., with a cast-off cache) and only the scoreDef is reset.
+     */
+    void PrepareLoadedDoc(bool hasLayoutInformation, bool isCastOff = false);
+
+    /**
+     * Create the editor toolkit for the notation type of the loaded document.
+     */
+    void CreateEditorToolkit();
+
+    /**
+     * Index the works of the data in the input format in m_workIndex, stopping after maxWorks works when it is not -1.
+     * The index is kept as it is when it is already the one of the data. Return false if the format has no work index.
+     */
+    bool IndexWorks(const std::string &data, FileFormat inputFormat, int maxWorks = -1);
+
+    /**
+     * Make the page the drawing page and return its spatial index (NULL if the page does not exist).
+     * Page number is 1-based.
+     */
+    SpatialIndex *GetPageSpatialIndex(int pageNo);
+
+    /**
+     * Convert a point in pixels from the top left corner of the drawing page to logical coordinates.
+     * The point is left unchanged for facsimile documents.
+     */
+    Point ToPageLogicalPoint(int x, int y);
+
+    /**
+     * Empty the cache of the rendered SVG pages.
+     * Called whenever the layout or the content changes.
+     */
+    void ClearSVGCache();
+
+    /**
+     * Set the SVG device context according to the options.
+     */
+    void InitSVGDeviceContext(SvgDeviceContext *svg);
+
 public:
     static std::map<std::string, ClassId> s_MEItoClassIdMap;
 
@@ -310,6 +480,59 @@ private:
 
     Options *m_options;
 
+    /**
+     * The highest invalidation level of the options changed since the data was loaded and laid out
+     */
+    option_INVALIDATION m_invalidation;
+
+    /**
+     * The data loaded, for loading it again when options requiring it change (empty if it cannot be or if
+     * Options::m_keepLoadedData is not set)
+     */
+    std::string m_loadedData;
+
+    /**
+     * The index of the works of the last multi-work data indexed and its input format, for extracting the works
+     * directly from their offset when the same data is loaded again
+     */
+    ///@{
+    WorkIndex m_workIndex;
+    FileFormat m_workIndexFormat;
+    ///@}
+
+    /**
+     * The cache of the rendered SVG pages, with the most recently used page first.
+     * The key is the page number and the values of the options used for the output.
+     */
+    ///@{
+    std::list<std::pair<std::string, std::string> > m_svgCache;
+    std::unordered_map<std::string, std::list<std::pair<std::string, std::string> >::iterator> m_svgCacheIndex;
+    size_t m_svgCacheSize;
+    int m_svgCacheHits;
+    int m_svgCacheMisses;
+    int m_svgCacheEvictions;
+    ///@}
+
+    /**
+     * The state of a page rendered with RenderToSVGDiff.
+     * The key identifies the page and the output options. The size is the one of the SVG. The glyphs and the
+     * VerovioText font are the ones included in the SVG. The systems are the ids and the positions they were drawn
+     * with.
+     */
+    struct SVGDiffPage {
+        int m_pageNo;
+        std::string m_key;
+        std::string m_size;
+        std::set<std::string> m_glyphs;
+        bool m_vrvTextFont;
+        std::vector<std::pair<std::string, std::vector<int> > > m_systems;
+    };
+
+    /**
+     * The pages rendered with RenderToSVGDiff, with the most recently rendered page first
+     */
+    std::list<SVGDiffPage> m_svgDiffPages;
+
     /**
      * The C buffer string.
      */
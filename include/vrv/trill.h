@@ -44,6 +44,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Trill"; }
     virtual ClassId GetClassId() const { return TRILL; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -39,6 +39,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Tuplet"; }
     virtual ClassId GetClassId() const { return TUPLET; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
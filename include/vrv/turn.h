@@ -42,6 +42,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Turn"; }
     virtual ClassId GetClassId() const { return TURN; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -30,6 +30,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Unclear"; }
     virtual ClassId GetClassId() const { return UNCLEAR; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
 private:
@@ -33,6 +33,7 @@ public:
     virtual void Reset();
     virtual std::string GetClassName() const { return "Verse"; }
     virtual ClassId GetClassId() const { return VERSE; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -40,6 +40,7 @@ public:
     SystemAligner();
     virtual ~SystemAligner();
     virtual ClassId GetClassId() const { return SYSTEM_ALIGNER; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
 
     /**
      * Do not copy children for HorizontalAligner
@@ -149,6 +150,7 @@ public:
     StaffAlignment();
     virtual ~StaffAlignment();
     virtual ClassId GetClassId() const { return STAFF_ALIGNMENT; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
 
     /**
@@ -313,6 +315,11 @@ public:
      */
     virtual int JustifyY(FunctorParams *functorParams);
 
+    /**
+     * See Object::GetMemoryUsage
+     */
+    virtual int GetMemoryUsage(FunctorParams *functorParams);
+
 private:
     /**
      * Returns minimus preset spacing
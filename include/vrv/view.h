@@ -164,6 +164,35 @@ public:
      */
     void DrawCurrentPage(DeviceContext *dc, bool background = true);
 
+    /**
+     * Redraw only the time spanning objects of the floating positioners of the current page.
+     * This is used during the layout for updating the bounding boxes of the positioners whose geometry changed
+     * without drawing the entire page again. The page is started as in DrawCurrentPage and the objects are drawn
+     * within their system, whose content bounding box is extended as with a full drawing.
+     * Defined in view_page.cpp
+     */
+    void DrawCurrentPagePositioners(DeviceContext *dc, const ArrayOfFloatingPositioners &positioners);
+
+    /**
+     * @name Set and reset the region of the page to be drawn by DrawCurrentPage.
+     * Only the systems and the measures intersecting the region are drawn.
+     * The region is given in pixels from the top left corner of the page and converted with the user scale of the
+     * device context. A width or a height of 0 means no region.
+     */
+    ///@{
+    void SetDrawingRegion(int x, int y, int width, int height);
+    void ResetDrawingRegion() { this->SetDrawingRegion(0, 0, 0, 0); }
+    ///@}
+
+    /**
+     * @name Set and reset the systems of the page to be drawn by DrawCurrentPage.
+     * Only the systems given are drawn, without the running elements of the page. No system means all of them.
+     */
+    ///@{
+    void SetDrawingSystems(const ArrayOfObjects &systems) { m_drawingSystems = systems; }
+    void ResetDrawingSystems() { m_drawingSystems.clear(); }
+    ///@}
+
     /**
      * Return the pixel per unit factor of the current page (if any, 1.0 otherwise)
      */
@@ -190,6 +219,14 @@ protected:
         bool isLastMeasure = false);
     void DrawStaffGrp(DeviceContext *dc, Measure *measure, StaffGrp *staffGrp, int x, bool topStaffGrp = false,
         bool abbreviations = false);
+
+    /**
+     * @name Return true if the system or the measure intersects the drawing region (or if there is none)
+     */
+    ///@{
+    bool IsInDrawingRegion(System *system);
+    bool IsInDrawingRegion(Measure *measure);
+    ///@}
     void DrawStaffDef(DeviceContext *dc, Staff *staff, Measure *measure);
     void DrawStaffDefCautionary(DeviceContext *dc, Staff *staff, Measure *measure);
     void DrawStaffDefLabels(DeviceContext *dc, Measure *measure, StaffGrp *staffGrp, int x, bool abbreviations = false);
@@ -615,6 +652,26 @@ protected:
     ScoreDef m_drawingScoreDef;
 
 private:
+    /**
+     * The region set with SetDrawingRegion and its logical coordinates on the current page
+     */
+    ///@{
+    int m_drawingRegionX;
+    int m_drawingRegionY;
+    int m_drawingRegionWidth;
+    int m_drawingRegionHeight;
+    bool m_hasDrawingRegion;
+    int m_drawingRegionLeft;
+    int m_drawingRegionRight;
+    int m_drawingRegionTop;
+    int m_drawingRegionBottom;
+    ///@}
+
+    /**
+     * The systems set with SetDrawingSystems
+     */
+    ArrayOfObjects m_drawingSystems;
+
     /** @name Internal values for storing temporary values for ligatures */
     ///@{
     static int s_drawingLigX[2], s_drawingLigY[2];
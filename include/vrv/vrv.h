@@ -150,6 +150,8 @@ public:
     static Glyph *GetGlyph(wchar_t smuflCode);
     /** Set current text style*/
     static void SelectTextFont(data_FONTWEIGHT fontWeight, data_FONTSTYLE fontStyle);
+    /** Returns the current text style */
+    static StyleAttributes GetTextStyle() { return s_currentStyle; }
     /** Returns the glyph (if exists) for the text font (bounding box and ASCII only) */
     static Glyph *GetTextGlyph(wchar_t code);
     ///@}
@@ -174,6 +176,26 @@ private:
 
 std::string Base64Encode(unsigned char const *, unsigned int len);
 
+/**
+ * Incremental base64 encoder appending to an output string.
+ * This avoids building the binary data as a whole before encoding it.
+ * The output is the one of Base64Encode on the concatenated bytes once Finish() has been called.
+ */
+class Base64Encoder {
+public:
+    Base64Encoder(std::string &output) : m_output(output), m_count(0) {}
+
+    void Append(unsigned char byte);
+    void Append(unsigned char const *bytes, unsigned int len);
+    /** Encode the remaining bytes and add the padding */
+    void Finish();
+
+private:
+    std::string &m_output;
+    unsigned char m_bytes[3];
+    int m_count;
+};
+
 } // namespace vrv
 
 #endif
@@ -236,6 +236,7 @@ enum ClassId {
     TEXT_ELEMENT_max,
     //
     BBOX_DEVICE_CONTEXT,
+    DISPLAY_LIST_DEVICE_CONTEXT,
     SVG_DEVICE_CONTEXT,
     CUSTOM_DEVICE_CONTEXT,
     //
@@ -259,7 +260,9 @@ enum InterfaceId {
     INTERFACE_SCOREDEF,
     INTERFACE_TEXT_DIR,
     INTERFACE_TIME_POINT,
-    INTERFACE_TIME_SPANNING
+    INTERFACE_TIME_SPANNING,
+    //
+    INTERFACE_max
 };
 
 //----------------------------------------------------------------------------
@@ -288,6 +291,7 @@ class Point;
 class Staff;
 class Option;
 class TextElement;
+class TimemapEvent;
 class TimePointInterface;
 class TimeSpanningInterface;
 
@@ -327,10 +331,14 @@ typedef std::vector<LedgerLine> ArrayOfLedgerLines;
 
 typedef std::vector<TextElement *> ArrayOfTextElements;
 
+typedef std::vector<TimemapEvent> ArrayOfTimemapEvents;
+
 typedef std::map<Staff *, std::list<int> > MapOfDotLocs;
 
 typedef std::map<std::string, Option *> MapOfStrOptions;
 
+typedef std::map<std::string, std::pair<int, size_t> > MapOfStrMemoryUsages;
+
 typedef std::map<data_PITCHNAME, data_ACCIDENTAL_WRITTEN> MapOfPitchAccid;
 
 typedef std::map<int, GraceAligner *> MapOfIntGraceAligners;
@@ -0,0 +1,122 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        workindex.h
+// Author:      Laurent Pugin
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_WORK_INDEX_H__
+#define __VRV_WORK_INDEX_H__
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// WorkIndex
+//----------------------------------------------------------------------------
+
+/**
+ * This class indexes the works of an input with several of them (the tunes of an ABC tunebook, the segments of a
+ * Humdrum file or the top-level mdivs of an MEI file) by scanning the data without parsing it.
+ * The works are given with their byte range in the data, which makes it possible to load only one of them.
+ */
+class WorkIndex {
+public:
+    /**
+     * The byte range of a work in the data, with its identifier (X: number, segment name or xml:id) and its title
+     */
+    struct Work {
+        size_t m_offset;
+        size_t m_length;
+        std::string m_id;
+        std::string m_title;
+    };
+
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    WorkIndex();
+    virtual ~WorkIndex();
+    ///@}
+
+    /**
+     * Remove all the works.
+     */
+    void Reset();
+
+    /**
+     * @name Index the works of the data in the corresponding format.
+     * The scan stops once maxWorks works are indexed when maxWorks is not -1.
+     */
+    ///@{
+    void IndexABC(const std::string &data, int maxWorks = -1);
+    void IndexHumdrum(const std::string &data, int maxWorks = -1);
+    void IndexMEI(const std::string &data, int maxWorks = -1);
+    ///@}
+
+    /**
+     * Return true if the works were indexed from the same data and include the work maxWorks (all of them when -1),
+     * in which case they can be extracted without scanning the data again.
+     */
+    bool IsIndexOf(const std::string &data, int maxWorks = -1) const;
+
+    /**
+     * Return the works in the order of the data.
+     */
+    const std::vector<Work> &GetWorks() const { return m_works; }
+
+    /**
+     * Return the approximate bytes used by the index.
+     */
+    size_t GetMemorySize() const;
+
+    /**
+     * Fill workData with the data of the work (1-based) surrounded by the header and the footer of the data, which
+     * have to be the ones indexed. Return false if there is no such work.
+     */
+    bool ExtractWork(const std::string &data, int n, std::string &workData) const;
+
+private:
+    /**
+     * Return the end of the line starting at pos (after the '\n', if any).
+     */
+    static size_t GetLineEnd(const std::string &data, size_t pos);
+
+    /**
+     * Return the value of a line from pos (e.g., after "X:") to lineEnd, without the surrounding spaces.
+     */
+    static std::string GetLineValue(const std::string &data, size_t pos, size_t lineEnd);
+
+    /**
+     * Return the value of an attribute of a start tag (empty if not found).
+     */
+    static std::string GetTagAttribute(const std::string &tag, const std::string &attribute);
+
+    /**
+     * Keep the size and the hash of the data indexed and whether all its works are indexed.
+     */
+    void SetIndexed(const std::string &data, int maxWorks);
+
+public:
+    //
+private:
+    /** The works in the order of the data */
+    std::vector<Work> m_works;
+    /** The end of the header before the first work */
+    size_t m_headerLength;
+    /** The beginning of the footer after the last work (the end of the data if there is none) */
+    size_t m_footerOffset;
+    /** The size and the hash of the data indexed */
+    size_t m_dataSize;
+    size_t m_dataHash;
+    /** True if the scan did not stop before the end of the data */
+    bool m_isComplete;
+};
+
+} // namespace vrv
+
+#endif // __VRV_WORK_INDEX_H__
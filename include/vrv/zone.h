@@ -37,7 +37,9 @@ public:
     virtual ~Zone();
     virtual Object *Clone() const { return new Zone(*this); }
     virtual void Reset();
+    virtual std::string GetClassName() const { return "Zone"; }
     ClassId GetClassId() const { return ZONE; }
+    virtual size_t GetMemorySize() const { return sizeof(*this); }
     ///@}
     void ShiftByXY(int xDiff, int yDiff);
     int GetLogicalUly();
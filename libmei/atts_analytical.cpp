@@ -473,7 +473,7 @@ bool AttSolfa::HasPsolfa() const
 bool Att::SetAnalytical(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_HARMANL)) {
-        AttHarmAnl *att = dynamic_cast<AttHarmAnl *>(element);
+        AttHarmAnl *att = element->GetAttClass<AttHarmAnl>(ATT_HARMANL);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToHarmAnlForm(attrValue));
@@ -481,7 +481,7 @@ bool Att::SetAnalytical(Object *element, const std::string &attrType, const std:
         }
     }
     if (element->HasAttClass(ATT_HARMONICFUNCTION)) {
-        AttHarmonicFunction *att = dynamic_cast<AttHarmonicFunction *>(element);
+        AttHarmonicFunction *att = element->GetAttClass<AttHarmonicFunction>(ATT_HARMONICFUNCTION);
         assert(att);
         if (attrType == "deg") {
             att->SetDeg(att->StrToStr(attrValue));
@@ -489,7 +489,7 @@ bool Att::SetAnalytical(Object *element, const std::string &attrType, const std:
         }
     }
     if (element->HasAttClass(ATT_INTERVALHARMONIC)) {
-        AttIntervalHarmonic *att = dynamic_cast<AttIntervalHarmonic *>(element);
+        AttIntervalHarmonic *att = element->GetAttClass<AttIntervalHarmonic>(ATT_INTERVALHARMONIC);
         assert(att);
         if (attrType == "inth") {
             att->SetInth(att->StrToStr(attrValue));
@@ -497,7 +497,7 @@ bool Att::SetAnalytical(Object *element, const std::string &attrType, const std:
         }
     }
     if (element->HasAttClass(ATT_INTERVALMELODIC)) {
-        AttIntervalMelodic *att = dynamic_cast<AttIntervalMelodic *>(element);
+        AttIntervalMelodic *att = element->GetAttClass<AttIntervalMelodic>(ATT_INTERVALMELODIC);
         assert(att);
         if (attrType == "intm") {
             att->SetIntm(att->StrToStr(attrValue));
@@ -505,7 +505,7 @@ bool Att::SetAnalytical(Object *element, const std::string &attrType, const std:
         }
     }
     if (element->HasAttClass(ATT_KEYSIGANL)) {
-        AttKeySigAnl *att = dynamic_cast<AttKeySigAnl *>(element);
+        AttKeySigAnl *att = element->GetAttClass<AttKeySigAnl>(ATT_KEYSIGANL);
         assert(att);
         if (attrType == "mode") {
             att->SetMode(att->StrToMode(attrValue));
@@ -513,7 +513,7 @@ bool Att::SetAnalytical(Object *element, const std::string &attrType, const std:
         }
     }
     if (element->HasAttClass(ATT_KEYSIGDEFAULTANL)) {
-        AttKeySigDefaultAnl *att = dynamic_cast<AttKeySigDefaultAnl *>(element);
+        AttKeySigDefaultAnl *att = element->GetAttClass<AttKeySigDefaultAnl>(ATT_KEYSIGDEFAULTANL);
         assert(att);
         if (attrType == "key.accid") {
             att->SetKeyAccid(att->StrToAccidentalGestural(attrValue));
@@ -529,7 +529,7 @@ bool Att::SetAnalytical(Object *element, const std::string &attrType, const std:
         }
     }
     if (element->HasAttClass(ATT_MELODICFUNCTION)) {
-        AttMelodicFunction *att = dynamic_cast<AttMelodicFunction *>(element);
+        AttMelodicFunction *att = element->GetAttClass<AttMelodicFunction>(ATT_MELODICFUNCTION);
         assert(att);
         if (attrType == "mfunc") {
             att->SetMfunc(att->StrToMelodicfunction(attrValue));
@@ -537,7 +537,7 @@ bool Att::SetAnalytical(Object *element, const std::string &attrType, const std:
         }
     }
     if (element->HasAttClass(ATT_PITCHCLASS)) {
-        AttPitchClass *att = dynamic_cast<AttPitchClass *>(element);
+        AttPitchClass *att = element->GetAttClass<AttPitchClass>(ATT_PITCHCLASS);
         assert(att);
         if (attrType == "pclass") {
             att->SetPclass(att->StrToInt(attrValue));
@@ -545,7 +545,7 @@ bool Att::SetAnalytical(Object *element, const std::string &attrType, const std:
         }
     }
     if (element->HasAttClass(ATT_SOLFA)) {
-        AttSolfa *att = dynamic_cast<AttSolfa *>(element);
+        AttSolfa *att = element->GetAttClass<AttSolfa>(ATT_SOLFA);
         assert(att);
         if (attrType == "psolfa") {
             att->SetPsolfa(att->StrToStr(attrValue));
@@ -559,42 +559,42 @@ bool Att::SetAnalytical(Object *element, const std::string &attrType, const std:
 void Att::GetAnalytical(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_HARMANL)) {
-        const AttHarmAnl *att = dynamic_cast<const AttHarmAnl *>(element);
+        const AttHarmAnl *att = element->GetAttClass<AttHarmAnl>(ATT_HARMANL);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back(std::make_pair("form", att->HarmAnlFormToStr(att->GetForm())));
         }
     }
     if (element->HasAttClass(ATT_HARMONICFUNCTION)) {
-        const AttHarmonicFunction *att = dynamic_cast<const AttHarmonicFunction *>(element);
+        const AttHarmonicFunction *att = element->GetAttClass<AttHarmonicFunction>(ATT_HARMONICFUNCTION);
         assert(att);
         if (att->HasDeg()) {
             attributes->push_back(std::make_pair("deg", att->StrToStr(att->GetDeg())));
         }
     }
     if (element->HasAttClass(ATT_INTERVALHARMONIC)) {
-        const AttIntervalHarmonic *att = dynamic_cast<const AttIntervalHarmonic *>(element);
+        const AttIntervalHarmonic *att = element->GetAttClass<AttIntervalHarmonic>(ATT_INTERVALHARMONIC);
         assert(att);
         if (att->HasInth()) {
             attributes->push_back(std::make_pair("inth", att->StrToStr(att->GetInth())));
         }
     }
     if (element->HasAttClass(ATT_INTERVALMELODIC)) {
-        const AttIntervalMelodic *att = dynamic_cast<const AttIntervalMelodic *>(element);
+        const AttIntervalMelodic *att = element->GetAttClass<AttIntervalMelodic>(ATT_INTERVALMELODIC);
         assert(att);
         if (att->HasIntm()) {
             attributes->push_back(std::make_pair("intm", att->StrToStr(att->GetIntm())));
         }
     }
     if (element->HasAttClass(ATT_KEYSIGANL)) {
-        const AttKeySigAnl *att = dynamic_cast<const AttKeySigAnl *>(element);
+        const AttKeySigAnl *att = element->GetAttClass<AttKeySigAnl>(ATT_KEYSIGANL);
         assert(att);
         if (att->HasMode()) {
             attributes->push_back(std::make_pair("mode", att->ModeToStr(att->GetMode())));
         }
     }
     if (element->HasAttClass(ATT_KEYSIGDEFAULTANL)) {
-        const AttKeySigDefaultAnl *att = dynamic_cast<const AttKeySigDefaultAnl *>(element);
+        const AttKeySigDefaultAnl *att = element->GetAttClass<AttKeySigDefaultAnl>(ATT_KEYSIGDEFAULTANL);
         assert(att);
         if (att->HasKeyAccid()) {
             attributes->push_back(std::make_pair("key.accid", att->AccidentalGesturalToStr(att->GetKeyAccid())));
@@ -607,21 +607,21 @@ void Att::GetAnalytical(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_MELODICFUNCTION)) {
-        const AttMelodicFunction *att = dynamic_cast<const AttMelodicFunction *>(element);
+        const AttMelodicFunction *att = element->GetAttClass<AttMelodicFunction>(ATT_MELODICFUNCTION);
         assert(att);
         if (att->HasMfunc()) {
             attributes->push_back(std::make_pair("mfunc", att->MelodicfunctionToStr(att->GetMfunc())));
         }
     }
     if (element->HasAttClass(ATT_PITCHCLASS)) {
-        const AttPitchClass *att = dynamic_cast<const AttPitchClass *>(element);
+        const AttPitchClass *att = element->GetAttClass<AttPitchClass>(ATT_PITCHCLASS);
         assert(att);
         if (att->HasPclass()) {
             attributes->push_back(std::make_pair("pclass", att->IntToStr(att->GetPclass())));
         }
     }
     if (element->HasAttClass(ATT_SOLFA)) {
-        const AttSolfa *att = dynamic_cast<const AttSolfa *>(element);
+        const AttSolfa *att = element->GetAttClass<AttSolfa>(ATT_SOLFA);
         assert(att);
         if (att->HasPsolfa()) {
             attributes->push_back(std::make_pair("psolfa", att->StrToStr(att->GetPsolfa())));
@@ -629,4 +629,17 @@ void Att::GetAnalytical(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::GetAnalyticalOffsets(const Object *element, std::vector<int> *offsets)
+{
+    offsets->at(ATT_HARMANL) = Att::GetOffset(element, dynamic_cast<const AttHarmAnl *>(element));
+    offsets->at(ATT_HARMONICFUNCTION) = Att::GetOffset(element, dynamic_cast<const AttHarmonicFunction *>(element));
+    offsets->at(ATT_INTERVALHARMONIC) = Att::GetOffset(element, dynamic_cast<const AttIntervalHarmonic *>(element));
+    offsets->at(ATT_INTERVALMELODIC) = Att::GetOffset(element, dynamic_cast<const AttIntervalMelodic *>(element));
+    offsets->at(ATT_KEYSIGANL) = Att::GetOffset(element, dynamic_cast<const AttKeySigAnl *>(element));
+    offsets->at(ATT_KEYSIGDEFAULTANL) = Att::GetOffset(element, dynamic_cast<const AttKeySigDefaultAnl *>(element));
+    offsets->at(ATT_MELODICFUNCTION) = Att::GetOffset(element, dynamic_cast<const AttMelodicFunction *>(element));
+    offsets->at(ATT_PITCHCLASS) = Att::GetOffset(element, dynamic_cast<const AttPitchClass *>(element));
+    offsets->at(ATT_SOLFA) = Att::GetOffset(element, dynamic_cast<const AttSolfa *>(element));
+}
+
 } // vrv namespace
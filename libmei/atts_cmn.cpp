@@ -1710,7 +1710,7 @@ bool AttTremMeasured::HasUnitdur() const
 bool Att::SetCmn(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_ARPEGLOG)) {
-        AttArpegLog *att = dynamic_cast<AttArpegLog *>(element);
+        AttArpegLog *att = element->GetAttClass<AttArpegLog>(ATT_ARPEGLOG);
         assert(att);
         if (attrType == "order") {
             att->SetOrder(att->StrToArpegLogOrder(attrValue));
@@ -1718,7 +1718,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_BTREMLOG)) {
-        AttBTremLog *att = dynamic_cast<AttBTremLog *>(element);
+        AttBTremLog *att = element->GetAttClass<AttBTremLog>(ATT_BTREMLOG);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToBTremLogForm(attrValue));
@@ -1726,7 +1726,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_BEAMPRESENT)) {
-        AttBeamPresent *att = dynamic_cast<AttBeamPresent *>(element);
+        AttBeamPresent *att = element->GetAttClass<AttBeamPresent>(ATT_BEAMPRESENT);
         assert(att);
         if (attrType == "beam") {
             att->SetBeam(att->StrToStr(attrValue));
@@ -1734,7 +1734,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_BEAMREND)) {
-        AttBeamRend *att = dynamic_cast<AttBeamRend *>(element);
+        AttBeamRend *att = element->GetAttClass<AttBeamRend>(ATT_BEAMREND);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToBeamRendForm(attrValue));
@@ -1754,7 +1754,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_BEAMSECONDARY)) {
-        AttBeamSecondary *att = dynamic_cast<AttBeamSecondary *>(element);
+        AttBeamSecondary *att = element->GetAttClass<AttBeamSecondary>(ATT_BEAMSECONDARY);
         assert(att);
         if (attrType == "breaksec") {
             att->SetBreaksec(att->StrToInt(attrValue));
@@ -1762,7 +1762,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_BEAMEDWITH)) {
-        AttBeamedWith *att = dynamic_cast<AttBeamedWith *>(element);
+        AttBeamedWith *att = element->GetAttClass<AttBeamedWith>(ATT_BEAMEDWITH);
         assert(att);
         if (attrType == "beam.with") {
             att->SetBeamWith(att->StrToOtherstaff(attrValue));
@@ -1770,7 +1770,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_BEAMINGLOG)) {
-        AttBeamingLog *att = dynamic_cast<AttBeamingLog *>(element);
+        AttBeamingLog *att = element->GetAttClass<AttBeamingLog>(ATT_BEAMINGLOG);
         assert(att);
         if (attrType == "beam.group") {
             att->SetBeamGroup(att->StrToStr(attrValue));
@@ -1782,7 +1782,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_BEATRPTLOG)) {
-        AttBeatRptLog *att = dynamic_cast<AttBeatRptLog *>(element);
+        AttBeatRptLog *att = element->GetAttClass<AttBeatRptLog>(ATT_BEATRPTLOG);
         assert(att);
         if (attrType == "beatdef") {
             att->SetBeatdef(att->StrToDbl(attrValue));
@@ -1790,7 +1790,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_BRACKETSPANLOG)) {
-        AttBracketSpanLog *att = dynamic_cast<AttBracketSpanLog *>(element);
+        AttBracketSpanLog *att = element->GetAttClass<AttBracketSpanLog>(ATT_BRACKETSPANLOG);
         assert(att);
         if (attrType == "func") {
             att->SetFunc(att->StrToStr(attrValue));
@@ -1798,7 +1798,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_CUTOUT)) {
-        AttCutout *att = dynamic_cast<AttCutout *>(element);
+        AttCutout *att = element->GetAttClass<AttCutout>(ATT_CUTOUT);
         assert(att);
         if (attrType == "cutout") {
             att->SetCutout(att->StrToCutoutCutout(attrValue));
@@ -1806,7 +1806,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_EXPANDABLE)) {
-        AttExpandable *att = dynamic_cast<AttExpandable *>(element);
+        AttExpandable *att = element->GetAttClass<AttExpandable>(ATT_EXPANDABLE);
         assert(att);
         if (attrType == "expand") {
             att->SetExpand(att->StrToBoolean(attrValue));
@@ -1814,7 +1814,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_FTREMLOG)) {
-        AttFTremLog *att = dynamic_cast<AttFTremLog *>(element);
+        AttFTremLog *att = element->GetAttClass<AttFTremLog>(ATT_FTREMLOG);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToFTremLogForm(attrValue));
@@ -1822,7 +1822,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_GLISSPRESENT)) {
-        AttGlissPresent *att = dynamic_cast<AttGlissPresent *>(element);
+        AttGlissPresent *att = element->GetAttClass<AttGlissPresent>(ATT_GLISSPRESENT);
         assert(att);
         if (attrType == "gliss") {
             att->SetGliss(att->StrToGlissando(attrValue));
@@ -1830,7 +1830,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_GRACEGRPLOG)) {
-        AttGraceGrpLog *att = dynamic_cast<AttGraceGrpLog *>(element);
+        AttGraceGrpLog *att = element->GetAttClass<AttGraceGrpLog>(ATT_GRACEGRPLOG);
         assert(att);
         if (attrType == "attach") {
             att->SetAttach(att->StrToGraceGrpLogAttach(attrValue));
@@ -1838,7 +1838,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_GRACED)) {
-        AttGraced *att = dynamic_cast<AttGraced *>(element);
+        AttGraced *att = element->GetAttClass<AttGraced>(ATT_GRACED);
         assert(att);
         if (attrType == "grace") {
             att->SetGrace(att->StrToGrace(attrValue));
@@ -1850,7 +1850,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_HAIRPINLOG)) {
-        AttHairpinLog *att = dynamic_cast<AttHairpinLog *>(element);
+        AttHairpinLog *att = element->GetAttClass<AttHairpinLog>(ATT_HAIRPINLOG);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToHairpinLogForm(attrValue));
@@ -1862,7 +1862,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_HARPPEDALLOG)) {
-        AttHarpPedalLog *att = dynamic_cast<AttHarpPedalLog *>(element);
+        AttHarpPedalLog *att = element->GetAttClass<AttHarpPedalLog>(ATT_HARPPEDALLOG);
         assert(att);
         if (attrType == "c") {
             att->SetC(att->StrToHarpPedalLogC(attrValue));
@@ -1894,7 +1894,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_LVPRESENT)) {
-        AttLvPresent *att = dynamic_cast<AttLvPresent *>(element);
+        AttLvPresent *att = element->GetAttClass<AttLvPresent>(ATT_LVPRESENT);
         assert(att);
         if (attrType == "lv") {
             att->SetLv(att->StrToBoolean(attrValue));
@@ -1902,7 +1902,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_MEASURELOG)) {
-        AttMeasureLog *att = dynamic_cast<AttMeasureLog *>(element);
+        AttMeasureLog *att = element->GetAttClass<AttMeasureLog>(ATT_MEASURELOG);
         assert(att);
         if (attrType == "left") {
             att->SetLeft(att->StrToBarrendition(attrValue));
@@ -1914,7 +1914,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_METERSIGGRPLOG)) {
-        AttMeterSigGrpLog *att = dynamic_cast<AttMeterSigGrpLog *>(element);
+        AttMeterSigGrpLog *att = element->GetAttClass<AttMeterSigGrpLog>(ATT_METERSIGGRPLOG);
         assert(att);
         if (attrType == "func") {
             att->SetFunc(att->StrToMeterSigGrpLogFunc(attrValue));
@@ -1922,7 +1922,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_NUMBERPLACEMENT)) {
-        AttNumberPlacement *att = dynamic_cast<AttNumberPlacement *>(element);
+        AttNumberPlacement *att = element->GetAttClass<AttNumberPlacement>(ATT_NUMBERPLACEMENT);
         assert(att);
         if (attrType == "num.place") {
             att->SetNumPlace(att->StrToStaffrelBasic(attrValue));
@@ -1934,7 +1934,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_NUMBERED)) {
-        AttNumbered *att = dynamic_cast<AttNumbered *>(element);
+        AttNumbered *att = element->GetAttClass<AttNumbered>(ATT_NUMBERED);
         assert(att);
         if (attrType == "num") {
             att->SetNum(att->StrToInt(attrValue));
@@ -1942,7 +1942,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_OCTAVELOG)) {
-        AttOctaveLog *att = dynamic_cast<AttOctaveLog *>(element);
+        AttOctaveLog *att = element->GetAttClass<AttOctaveLog>(ATT_OCTAVELOG);
         assert(att);
         if (attrType == "coll") {
             att->SetColl(att->StrToOctaveLogColl(attrValue));
@@ -1950,7 +1950,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_PEDALLOG)) {
-        AttPedalLog *att = dynamic_cast<AttPedalLog *>(element);
+        AttPedalLog *att = element->GetAttClass<AttPedalLog>(ATT_PEDALLOG);
         assert(att);
         if (attrType == "dir") {
             att->SetDir(att->StrToPedalLogDir(attrValue));
@@ -1962,7 +1962,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_PIANOPEDALS)) {
-        AttPianoPedals *att = dynamic_cast<AttPianoPedals *>(element);
+        AttPianoPedals *att = element->GetAttClass<AttPianoPedals>(ATT_PIANOPEDALS);
         assert(att);
         if (attrType == "pedal.style") {
             att->SetPedalStyle(att->StrToPianoPedalsPedalstyle(attrValue));
@@ -1970,7 +1970,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_REHEARSAL)) {
-        AttRehearsal *att = dynamic_cast<AttRehearsal *>(element);
+        AttRehearsal *att = element->GetAttClass<AttRehearsal>(ATT_REHEARSAL);
         assert(att);
         if (attrType == "reh.enclose") {
             att->SetRehEnclose(att->StrToRehearsalRehenclose(attrValue));
@@ -1978,7 +1978,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_SCOREDEFVISCMN)) {
-        AttScoreDefVisCmn *att = dynamic_cast<AttScoreDefVisCmn *>(element);
+        AttScoreDefVisCmn *att = element->GetAttClass<AttScoreDefVisCmn>(ATT_SCOREDEFVISCMN);
         assert(att);
         if (attrType == "grid.show") {
             att->SetGridShow(att->StrToBoolean(attrValue));
@@ -1986,7 +1986,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_SLURREND)) {
-        AttSlurRend *att = dynamic_cast<AttSlurRend *>(element);
+        AttSlurRend *att = element->GetAttClass<AttSlurRend>(ATT_SLURREND);
         assert(att);
         if (attrType == "slur.lform") {
             att->SetSlurLform(att->StrToLineform(attrValue));
@@ -1998,7 +1998,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_STEMSCMN)) {
-        AttStemsCmn *att = dynamic_cast<AttStemsCmn *>(element);
+        AttStemsCmn *att = element->GetAttClass<AttStemsCmn>(ATT_STEMSCMN);
         assert(att);
         if (attrType == "stem.with") {
             att->SetStemWith(att->StrToOtherstaff(attrValue));
@@ -2006,7 +2006,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_TIEREND)) {
-        AttTieRend *att = dynamic_cast<AttTieRend *>(element);
+        AttTieRend *att = element->GetAttClass<AttTieRend>(ATT_TIEREND);
         assert(att);
         if (attrType == "tie.lform") {
             att->SetTieLform(att->StrToLineform(attrValue));
@@ -2018,7 +2018,7 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
         }
     }
     if (element->HasAttClass(ATT_TREMMEASURED)) {
-        AttTremMeasured *att = dynamic_cast<AttTremMeasured *>(element);
+        AttTremMeasured *att = element->GetAttClass<AttTremMeasured>(ATT_TREMMEASURED);
         assert(att);
         if (attrType == "unitdur") {
             att->SetUnitdur(att->StrToDuration(attrValue));
@@ -2032,28 +2032,28 @@ bool Att::SetCmn(Object *element, const std::string &attrType, const std::string
 void Att::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_ARPEGLOG)) {
-        const AttArpegLog *att = dynamic_cast<const AttArpegLog *>(element);
+        const AttArpegLog *att = element->GetAttClass<AttArpegLog>(ATT_ARPEGLOG);
         assert(att);
         if (att->HasOrder()) {
             attributes->push_back(std::make_pair("order", att->ArpegLogOrderToStr(att->GetOrder())));
         }
     }
     if (element->HasAttClass(ATT_BTREMLOG)) {
-        const AttBTremLog *att = dynamic_cast<const AttBTremLog *>(element);
+        const AttBTremLog *att = element->GetAttClass<AttBTremLog>(ATT_BTREMLOG);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back(std::make_pair("form", att->BTremLogFormToStr(att->GetForm())));
         }
     }
     if (element->HasAttClass(ATT_BEAMPRESENT)) {
-        const AttBeamPresent *att = dynamic_cast<const AttBeamPresent *>(element);
+        const AttBeamPresent *att = element->GetAttClass<AttBeamPresent>(ATT_BEAMPRESENT);
         assert(att);
         if (att->HasBeam()) {
             attributes->push_back(std::make_pair("beam", att->StrToStr(att->GetBeam())));
         }
     }
     if (element->HasAttClass(ATT_BEAMREND)) {
-        const AttBeamRend *att = dynamic_cast<const AttBeamRend *>(element);
+        const AttBeamRend *att = element->GetAttClass<AttBeamRend>(ATT_BEAMREND);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back(std::make_pair("form", att->BeamRendFormToStr(att->GetForm())));
@@ -2069,21 +2069,21 @@ void Att::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_BEAMSECONDARY)) {
-        const AttBeamSecondary *att = dynamic_cast<const AttBeamSecondary *>(element);
+        const AttBeamSecondary *att = element->GetAttClass<AttBeamSecondary>(ATT_BEAMSECONDARY);
         assert(att);
         if (att->HasBreaksec()) {
             attributes->push_back(std::make_pair("breaksec", att->IntToStr(att->GetBreaksec())));
         }
     }
     if (element->HasAttClass(ATT_BEAMEDWITH)) {
-        const AttBeamedWith *att = dynamic_cast<const AttBeamedWith *>(element);
+        const AttBeamedWith *att = element->GetAttClass<AttBeamedWith>(ATT_BEAMEDWITH);
         assert(att);
         if (att->HasBeamWith()) {
             attributes->push_back(std::make_pair("beam.with", att->OtherstaffToStr(att->GetBeamWith())));
         }
     }
     if (element->HasAttClass(ATT_BEAMINGLOG)) {
-        const AttBeamingLog *att = dynamic_cast<const AttBeamingLog *>(element);
+        const AttBeamingLog *att = element->GetAttClass<AttBeamingLog>(ATT_BEAMINGLOG);
         assert(att);
         if (att->HasBeamGroup()) {
             attributes->push_back(std::make_pair("beam.group", att->StrToStr(att->GetBeamGroup())));
@@ -2093,56 +2093,56 @@ void Att::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_BEATRPTLOG)) {
-        const AttBeatRptLog *att = dynamic_cast<const AttBeatRptLog *>(element);
+        const AttBeatRptLog *att = element->GetAttClass<AttBeatRptLog>(ATT_BEATRPTLOG);
         assert(att);
         if (att->HasBeatdef()) {
             attributes->push_back(std::make_pair("beatdef", att->DblToStr(att->GetBeatdef())));
         }
     }
     if (element->HasAttClass(ATT_BRACKETSPANLOG)) {
-        const AttBracketSpanLog *att = dynamic_cast<const AttBracketSpanLog *>(element);
+        const AttBracketSpanLog *att = element->GetAttClass<AttBracketSpanLog>(ATT_BRACKETSPANLOG);
         assert(att);
         if (att->HasFunc()) {
             attributes->push_back(std::make_pair("func", att->StrToStr(att->GetFunc())));
         }
     }
     if (element->HasAttClass(ATT_CUTOUT)) {
-        const AttCutout *att = dynamic_cast<const AttCutout *>(element);
+        const AttCutout *att = element->GetAttClass<AttCutout>(ATT_CUTOUT);
         assert(att);
         if (att->HasCutout()) {
             attributes->push_back(std::make_pair("cutout", att->CutoutCutoutToStr(att->GetCutout())));
         }
     }
     if (element->HasAttClass(ATT_EXPANDABLE)) {
-        const AttExpandable *att = dynamic_cast<const AttExpandable *>(element);
+        const AttExpandable *att = element->GetAttClass<AttExpandable>(ATT_EXPANDABLE);
         assert(att);
         if (att->HasExpand()) {
             attributes->push_back(std::make_pair("expand", att->BooleanToStr(att->GetExpand())));
         }
     }
     if (element->HasAttClass(ATT_FTREMLOG)) {
-        const AttFTremLog *att = dynamic_cast<const AttFTremLog *>(element);
+        const AttFTremLog *att = element->GetAttClass<AttFTremLog>(ATT_FTREMLOG);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back(std::make_pair("form", att->FTremLogFormToStr(att->GetForm())));
         }
     }
     if (element->HasAttClass(ATT_GLISSPRESENT)) {
-        const AttGlissPresent *att = dynamic_cast<const AttGlissPresent *>(element);
+        const AttGlissPresent *att = element->GetAttClass<AttGlissPresent>(ATT_GLISSPRESENT);
         assert(att);
         if (att->HasGliss()) {
             attributes->push_back(std::make_pair("gliss", att->GlissandoToStr(att->GetGliss())));
         }
     }
     if (element->HasAttClass(ATT_GRACEGRPLOG)) {
-        const AttGraceGrpLog *att = dynamic_cast<const AttGraceGrpLog *>(element);
+        const AttGraceGrpLog *att = element->GetAttClass<AttGraceGrpLog>(ATT_GRACEGRPLOG);
         assert(att);
         if (att->HasAttach()) {
             attributes->push_back(std::make_pair("attach", att->GraceGrpLogAttachToStr(att->GetAttach())));
         }
     }
     if (element->HasAttClass(ATT_GRACED)) {
-        const AttGraced *att = dynamic_cast<const AttGraced *>(element);
+        const AttGraced *att = element->GetAttClass<AttGraced>(ATT_GRACED);
         assert(att);
         if (att->HasGrace()) {
             attributes->push_back(std::make_pair("grace", att->GraceToStr(att->GetGrace())));
@@ -2152,7 +2152,7 @@ void Att::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_HAIRPINLOG)) {
-        const AttHairpinLog *att = dynamic_cast<const AttHairpinLog *>(element);
+        const AttHairpinLog *att = element->GetAttClass<AttHairpinLog>(ATT_HAIRPINLOG);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back(std::make_pair("form", att->HairpinLogFormToStr(att->GetForm())));
@@ -2162,7 +2162,7 @@ void Att::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_HARPPEDALLOG)) {
-        const AttHarpPedalLog *att = dynamic_cast<const AttHarpPedalLog *>(element);
+        const AttHarpPedalLog *att = element->GetAttClass<AttHarpPedalLog>(ATT_HARPPEDALLOG);
         assert(att);
         if (att->HasC()) {
             attributes->push_back(std::make_pair("c", att->HarpPedalLogCToStr(att->GetC())));
@@ -2187,14 +2187,14 @@ void Att::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_LVPRESENT)) {
-        const AttLvPresent *att = dynamic_cast<const AttLvPresent *>(element);
+        const AttLvPresent *att = element->GetAttClass<AttLvPresent>(ATT_LVPRESENT);
         assert(att);
         if (att->HasLv()) {
             attributes->push_back(std::make_pair("lv", att->BooleanToStr(att->GetLv())));
         }
     }
     if (element->HasAttClass(ATT_MEASURELOG)) {
-        const AttMeasureLog *att = dynamic_cast<const AttMeasureLog *>(element);
+        const AttMeasureLog *att = element->GetAttClass<AttMeasureLog>(ATT_MEASURELOG);
         assert(att);
         if (att->HasLeft()) {
             attributes->push_back(std::make_pair("left", att->BarrenditionToStr(att->GetLeft())));
@@ -2204,14 +2204,14 @@ void Att::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_METERSIGGRPLOG)) {
-        const AttMeterSigGrpLog *att = dynamic_cast<const AttMeterSigGrpLog *>(element);
+        const AttMeterSigGrpLog *att = element->GetAttClass<AttMeterSigGrpLog>(ATT_METERSIGGRPLOG);
         assert(att);
         if (att->HasFunc()) {
             attributes->push_back(std::make_pair("func", att->MeterSigGrpLogFuncToStr(att->GetFunc())));
         }
     }
     if (element->HasAttClass(ATT_NUMBERPLACEMENT)) {
-        const AttNumberPlacement *att = dynamic_cast<const AttNumberPlacement *>(element);
+        const AttNumberPlacement *att = element->GetAttClass<AttNumberPlacement>(ATT_NUMBERPLACEMENT);
         assert(att);
         if (att->HasNumPlace()) {
             attributes->push_back(std::make_pair("num.place", att->StaffrelBasicToStr(att->GetNumPlace())));
@@ -2221,21 +2221,21 @@ void Att::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_NUMBERED)) {
-        const AttNumbered *att = dynamic_cast<const AttNumbered *>(element);
+        const AttNumbered *att = element->GetAttClass<AttNumbered>(ATT_NUMBERED);
         assert(att);
         if (att->HasNum()) {
             attributes->push_back(std::make_pair("num", att->IntToStr(att->GetNum())));
         }
     }
     if (element->HasAttClass(ATT_OCTAVELOG)) {
-        const AttOctaveLog *att = dynamic_cast<const AttOctaveLog *>(element);
+        const AttOctaveLog *att = element->GetAttClass<AttOctaveLog>(ATT_OCTAVELOG);
         assert(att);
         if (att->HasColl()) {
             attributes->push_back(std::make_pair("coll", att->OctaveLogCollToStr(att->GetColl())));
         }
     }
     if (element->HasAttClass(ATT_PEDALLOG)) {
-        const AttPedalLog *att = dynamic_cast<const AttPedalLog *>(element);
+        const AttPedalLog *att = element->GetAttClass<AttPedalLog>(ATT_PEDALLOG);
         assert(att);
         if (att->HasDir()) {
             attributes->push_back(std::make_pair("dir", att->PedalLogDirToStr(att->GetDir())));
@@ -2245,28 +2245,28 @@ void Att::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_PIANOPEDALS)) {
-        const AttPianoPedals *att = dynamic_cast<const AttPianoPedals *>(element);
+        const AttPianoPedals *att = element->GetAttClass<AttPianoPedals>(ATT_PIANOPEDALS);
         assert(att);
         if (att->HasPedalStyle()) {
             attributes->push_back(std::make_pair("pedal.style", att->PianoPedalsPedalstyleToStr(att->GetPedalStyle())));
         }
     }
     if (element->HasAttClass(ATT_REHEARSAL)) {
-        const AttRehearsal *att = dynamic_cast<const AttRehearsal *>(element);
+        const AttRehearsal *att = element->GetAttClass<AttRehearsal>(ATT_REHEARSAL);
         assert(att);
         if (att->HasRehEnclose()) {
             attributes->push_back(std::make_pair("reh.enclose", att->RehearsalRehencloseToStr(att->GetRehEnclose())));
         }
     }
     if (element->HasAttClass(ATT_SCOREDEFVISCMN)) {
-        const AttScoreDefVisCmn *att = dynamic_cast<const AttScoreDefVisCmn *>(element);
+        const AttScoreDefVisCmn *att = element->GetAttClass<AttScoreDefVisCmn>(ATT_SCOREDEFVISCMN);
         assert(att);
         if (att->HasGridShow()) {
             attributes->push_back(std::make_pair("grid.show", att->BooleanToStr(att->GetGridShow())));
         }
     }
     if (element->HasAttClass(ATT_SLURREND)) {
-        const AttSlurRend *att = dynamic_cast<const AttSlurRend *>(element);
+        const AttSlurRend *att = element->GetAttClass<AttSlurRend>(ATT_SLURREND);
         assert(att);
         if (att->HasSlurLform()) {
             attributes->push_back(std::make_pair("slur.lform", att->LineformToStr(att->GetSlurLform())));
@@ -2276,14 +2276,14 @@ void Att::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_STEMSCMN)) {
-        const AttStemsCmn *att = dynamic_cast<const AttStemsCmn *>(element);
+        const AttStemsCmn *att = element->GetAttClass<AttStemsCmn>(ATT_STEMSCMN);
         assert(att);
         if (att->HasStemWith()) {
             attributes->push_back(std::make_pair("stem.with", att->OtherstaffToStr(att->GetStemWith())));
         }
     }
     if (element->HasAttClass(ATT_TIEREND)) {
-        const AttTieRend *att = dynamic_cast<const AttTieRend *>(element);
+        const AttTieRend *att = element->GetAttClass<AttTieRend>(ATT_TIEREND);
         assert(att);
         if (att->HasTieLform()) {
             attributes->push_back(std::make_pair("tie.lform", att->LineformToStr(att->GetTieLform())));
@@ -2293,7 +2293,7 @@ void Att::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_TREMMEASURED)) {
-        const AttTremMeasured *att = dynamic_cast<const AttTremMeasured *>(element);
+        const AttTremMeasured *att = element->GetAttClass<AttTremMeasured>(ATT_TREMMEASURED);
         assert(att);
         if (att->HasUnitdur()) {
             attributes->push_back(std::make_pair("unitdur", att->DurationToStr(att->GetUnitdur())));
@@ -2301,4 +2301,39 @@ void Att::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::GetCmnOffsets(const Object *element, std::vector<int> *offsets)
+{
+    offsets->at(ATT_ARPEGLOG) = Att::GetOffset(element, dynamic_cast<const AttArpegLog *>(element));
+    offsets->at(ATT_BTREMLOG) = Att::GetOffset(element, dynamic_cast<const AttBTremLog *>(element));
+    offsets->at(ATT_BEAMPRESENT) = Att::GetOffset(element, dynamic_cast<const AttBeamPresent *>(element));
+    offsets->at(ATT_BEAMREND) = Att::GetOffset(element, dynamic_cast<const AttBeamRend *>(element));
+    offsets->at(ATT_BEAMSECONDARY) = Att::GetOffset(element, dynamic_cast<const AttBeamSecondary *>(element));
+    offsets->at(ATT_BEAMEDWITH) = Att::GetOffset(element, dynamic_cast<const AttBeamedWith *>(element));
+    offsets->at(ATT_BEAMINGLOG) = Att::GetOffset(element, dynamic_cast<const AttBeamingLog *>(element));
+    offsets->at(ATT_BEATRPTLOG) = Att::GetOffset(element, dynamic_cast<const AttBeatRptLog *>(element));
+    offsets->at(ATT_BRACKETSPANLOG) = Att::GetOffset(element, dynamic_cast<const AttBracketSpanLog *>(element));
+    offsets->at(ATT_CUTOUT) = Att::GetOffset(element, dynamic_cast<const AttCutout *>(element));
+    offsets->at(ATT_EXPANDABLE) = Att::GetOffset(element, dynamic_cast<const AttExpandable *>(element));
+    offsets->at(ATT_FTREMLOG) = Att::GetOffset(element, dynamic_cast<const AttFTremLog *>(element));
+    offsets->at(ATT_GLISSPRESENT) = Att::GetOffset(element, dynamic_cast<const AttGlissPresent *>(element));
+    offsets->at(ATT_GRACEGRPLOG) = Att::GetOffset(element, dynamic_cast<const AttGraceGrpLog *>(element));
+    offsets->at(ATT_GRACED) = Att::GetOffset(element, dynamic_cast<const AttGraced *>(element));
+    offsets->at(ATT_HAIRPINLOG) = Att::GetOffset(element, dynamic_cast<const AttHairpinLog *>(element));
+    offsets->at(ATT_HARPPEDALLOG) = Att::GetOffset(element, dynamic_cast<const AttHarpPedalLog *>(element));
+    offsets->at(ATT_LVPRESENT) = Att::GetOffset(element, dynamic_cast<const AttLvPresent *>(element));
+    offsets->at(ATT_MEASURELOG) = Att::GetOffset(element, dynamic_cast<const AttMeasureLog *>(element));
+    offsets->at(ATT_METERSIGGRPLOG) = Att::GetOffset(element, dynamic_cast<const AttMeterSigGrpLog *>(element));
+    offsets->at(ATT_NUMBERPLACEMENT) = Att::GetOffset(element, dynamic_cast<const AttNumberPlacement *>(element));
+    offsets->at(ATT_NUMBERED) = Att::GetOffset(element, dynamic_cast<const AttNumbered *>(element));
+    offsets->at(ATT_OCTAVELOG) = Att::GetOffset(element, dynamic_cast<const AttOctaveLog *>(element));
+    offsets->at(ATT_PEDALLOG) = Att::GetOffset(element, dynamic_cast<const AttPedalLog *>(element));
+    offsets->at(ATT_PIANOPEDALS) = Att::GetOffset(element, dynamic_cast<const AttPianoPedals *>(element));
+    offsets->at(ATT_REHEARSAL) = Att::GetOffset(element, dynamic_cast<const AttRehearsal *>(element));
+    offsets->at(ATT_SCOREDEFVISCMN) = Att::GetOffset(element, dynamic_cast<const AttScoreDefVisCmn *>(element));
+    offsets->at(ATT_SLURREND) = Att::GetOffset(element, dynamic_cast<const AttSlurRend *>(element));
+    offsets->at(ATT_STEMSCMN) = Att::GetOffset(element, dynamic_cast<const AttStemsCmn *>(element));
+    offsets->at(ATT_TIEREND) = Att::GetOffset(element, dynamic_cast<const AttTieRend *>(element));
+    offsets->at(ATT_TREMMEASURED) = Att::GetOffset(element, dynamic_cast<const AttTremMeasured *>(element));
+}
+
 } // vrv namespace
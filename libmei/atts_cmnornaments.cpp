@@ -258,7 +258,7 @@ bool AttTurnLog::HasForm() const
 bool Att::SetCmnornaments(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_MORDENTLOG)) {
-        AttMordentLog *att = dynamic_cast<AttMordentLog *>(element);
+        AttMordentLog *att = element->GetAttClass<AttMordentLog>(ATT_MORDENTLOG);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToMordentLogForm(attrValue));
@@ -270,7 +270,7 @@ bool Att::SetCmnornaments(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_ORNAMPRESENT)) {
-        AttOrnamPresent *att = dynamic_cast<AttOrnamPresent *>(element);
+        AttOrnamPresent *att = element->GetAttClass<AttOrnamPresent>(ATT_ORNAMPRESENT);
         assert(att);
         if (attrType == "ornam") {
             att->SetOrnam(att->StrToStr(attrValue));
@@ -278,7 +278,7 @@ bool Att::SetCmnornaments(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_ORNAMENTACCID)) {
-        AttOrnamentAccid *att = dynamic_cast<AttOrnamentAccid *>(element);
+        AttOrnamentAccid *att = element->GetAttClass<AttOrnamentAccid>(ATT_ORNAMENTACCID);
         assert(att);
         if (attrType == "accidupper") {
             att->SetAccidupper(att->StrToAccidentalWritten(attrValue));
@@ -290,7 +290,7 @@ bool Att::SetCmnornaments(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_TURNLOG)) {
-        AttTurnLog *att = dynamic_cast<AttTurnLog *>(element);
+        AttTurnLog *att = element->GetAttClass<AttTurnLog>(ATT_TURNLOG);
         assert(att);
         if (attrType == "delayed") {
             att->SetDelayed(att->StrToBoolean(attrValue));
@@ -308,7 +308,7 @@ bool Att::SetCmnornaments(Object *element, const std::string &attrType, const st
 void Att::GetCmnornaments(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_MORDENTLOG)) {
-        const AttMordentLog *att = dynamic_cast<const AttMordentLog *>(element);
+        const AttMordentLog *att = element->GetAttClass<AttMordentLog>(ATT_MORDENTLOG);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back(std::make_pair("form", att->MordentLogFormToStr(att->GetForm())));
@@ -318,14 +318,14 @@ void Att::GetCmnornaments(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_ORNAMPRESENT)) {
-        const AttOrnamPresent *att = dynamic_cast<const AttOrnamPresent *>(element);
+        const AttOrnamPresent *att = element->GetAttClass<AttOrnamPresent>(ATT_ORNAMPRESENT);
         assert(att);
         if (att->HasOrnam()) {
             attributes->push_back(std::make_pair("ornam", att->StrToStr(att->GetOrnam())));
         }
     }
     if (element->HasAttClass(ATT_ORNAMENTACCID)) {
-        const AttOrnamentAccid *att = dynamic_cast<const AttOrnamentAccid *>(element);
+        const AttOrnamentAccid *att = element->GetAttClass<AttOrnamentAccid>(ATT_ORNAMENTACCID);
         assert(att);
         if (att->HasAccidupper()) {
             attributes->push_back(std::make_pair("accidupper", att->AccidentalWrittenToStr(att->GetAccidupper())));
@@ -335,7 +335,7 @@ void Att::GetCmnornaments(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_TURNLOG)) {
-        const AttTurnLog *att = dynamic_cast<const AttTurnLog *>(element);
+        const AttTurnLog *att = element->GetAttClass<AttTurnLog>(ATT_TURNLOG);
         assert(att);
         if (att->HasDelayed()) {
             attributes->push_back(std::make_pair("delayed", att->BooleanToStr(att->GetDelayed())));
@@ -346,4 +346,12 @@ void Att::GetCmnornaments(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::GetCmnornamentsOffsets(const Object *element, std::vector<int> *offsets)
+{
+    offsets->at(ATT_MORDENTLOG) = Att::GetOffset(element, dynamic_cast<const AttMordentLog *>(element));
+    offsets->at(ATT_ORNAMPRESENT) = Att::GetOffset(element, dynamic_cast<const AttOrnamPresent *>(element));
+    offsets->at(ATT_ORNAMENTACCID) = Att::GetOffset(element, dynamic_cast<const AttOrnamentAccid *>(element));
+    offsets->at(ATT_TURNLOG) = Att::GetOffset(element, dynamic_cast<const AttTurnLog *>(element));
+}
+
 } // vrv namespace
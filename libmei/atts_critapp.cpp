@@ -75,7 +75,7 @@ bool AttCrit::HasCause() const
 bool Att::SetCritapp(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_CRIT)) {
-        AttCrit *att = dynamic_cast<AttCrit *>(element);
+        AttCrit *att = element->GetAttClass<AttCrit>(ATT_CRIT);
         assert(att);
         if (attrType == "cause") {
             att->SetCause(att->StrToStr(attrValue));
@@ -89,7 +89,7 @@ bool Att::SetCritapp(Object *element, const std::string &attrType, const std::st
 void Att::GetCritapp(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_CRIT)) {
-        const AttCrit *att = dynamic_cast<const AttCrit *>(element);
+        const AttCrit *att = element->GetAttClass<AttCrit>(ATT_CRIT);
         assert(att);
         if (att->HasCause()) {
             attributes->push_back(std::make_pair("cause", att->StrToStr(att->GetCause())));
@@ -97,4 +97,9 @@ void Att::GetCritapp(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::GetCritappOffsets(const Object *element, std::vector<int> *offsets)
+{
+    offsets->at(ATT_CRIT) = Att::GetOffset(element, dynamic_cast<const AttCrit *>(element));
+}
+
 } // vrv namespace
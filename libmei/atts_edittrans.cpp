@@ -121,7 +121,7 @@ bool AttReasonIdent::HasReason() const
 bool Att::SetEdittrans(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_AGENTIDENT)) {
-        AttAgentIdent *att = dynamic_cast<AttAgentIdent *>(element);
+        AttAgentIdent *att = element->GetAttClass<AttAgentIdent>(ATT_AGENTIDENT);
         assert(att);
         if (attrType == "agent") {
             att->SetAgent(att->StrToStr(attrValue));
@@ -129,7 +129,7 @@ bool Att::SetEdittrans(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_REASONIDENT)) {
-        AttReasonIdent *att = dynamic_cast<AttReasonIdent *>(element);
+        AttReasonIdent *att = element->GetAttClass<AttReasonIdent>(ATT_REASONIDENT);
         assert(att);
         if (attrType == "reason") {
             att->SetReason(att->StrToStr(attrValue));
@@ -143,14 +143,14 @@ bool Att::SetEdittrans(Object *element, const std::string &attrType, const std::
 void Att::GetEdittrans(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_AGENTIDENT)) {
-        const AttAgentIdent *att = dynamic_cast<const AttAgentIdent *>(element);
+        const AttAgentIdent *att = element->GetAttClass<AttAgentIdent>(ATT_AGENTIDENT);
         assert(att);
         if (att->HasAgent()) {
             attributes->push_back(std::make_pair("agent", att->StrToStr(att->GetAgent())));
         }
     }
     if (element->HasAttClass(ATT_REASONIDENT)) {
-        const AttReasonIdent *att = dynamic_cast<const AttReasonIdent *>(element);
+        const AttReasonIdent *att = element->GetAttClass<AttReasonIdent>(ATT_REASONIDENT);
         assert(att);
         if (att->HasReason()) {
             attributes->push_back(std::make_pair("reason", att->StrToStr(att->GetReason())));
@@ -158,4 +158,10 @@ void Att::GetEdittrans(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::GetEdittransOffsets(const Object *element, std::vector<int> *offsets)
+{
+    offsets->at(ATT_AGENTIDENT) = Att::GetOffset(element, dynamic_cast<const AttAgentIdent *>(element));
+    offsets->at(ATT_REASONIDENT) = Att::GetOffset(element, dynamic_cast<const AttReasonIdent *>(element));
+}
+
 } // vrv namespace
@@ -120,7 +120,7 @@ bool AttExtSym::HasGlyphUri() const
 bool Att::SetExternalsymbols(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_EXTSYM)) {
-        AttExtSym *att = dynamic_cast<AttExtSym *>(element);
+        AttExtSym *att = element->GetAttClass<AttExtSym>(ATT_EXTSYM);
         assert(att);
         if (attrType == "glyph.auth") {
             att->SetGlyphAuth(att->StrToStr(attrValue));
@@ -146,7 +146,7 @@ bool Att::SetExternalsymbols(Object *element, const std::string &attrType, const
 void Att::GetExternalsymbols(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_EXTSYM)) {
-        const AttExtSym *att = dynamic_cast<const AttExtSym *>(element);
+        const AttExtSym *att = element->GetAttClass<AttExtSym>(ATT_EXTSYM);
         assert(att);
         if (att->HasGlyphAuth()) {
             attributes->push_back(std::make_pair("glyph.auth", att->StrToStr(att->GetGlyphAuth())));
@@ -163,4 +163,9 @@ void Att::GetExternalsymbols(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::GetExternalsymbolsOffsets(const Object *element, std::vector<int> *offsets)
+{
+    offsets->at(ATT_EXTSYM) = Att::GetOffset(element, dynamic_cast<const AttExtSym *>(element));
+}
+
 } // vrv namespace
@@ -75,7 +75,7 @@ bool AttFacsimile::HasFacs() const
 bool Att::SetFacsimile(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_FACSIMILE)) {
-        AttFacsimile *att = dynamic_cast<AttFacsimile *>(element);
+        AttFacsimile *att = element->GetAttClass<AttFacsimile>(ATT_FACSIMILE);
         assert(att);
         if (attrType == "facs") {
             att->SetFacs(att->StrToStr(attrValue));
@@ -89,7 +89,7 @@ bool Att::SetFacsimile(Object *element, const std::string &attrType, const std::
 void Att::GetFacsimile(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_FACSIMILE)) {
-        const AttFacsimile *att = dynamic_cast<const AttFacsimile *>(element);
+        const AttFacsimile *att = element->GetAttClass<AttFacsimile>(ATT_FACSIMILE);
         assert(att);
         if (att->HasFacs()) {
             attributes->push_back(std::make_pair("facs", att->StrToStr(att->GetFacs())));
@@ -97,4 +97,9 @@ void Att::GetFacsimile(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::GetFacsimileOffsets(const Object *element, std::vector<int> *offsets)
+{
+    offsets->at(ATT_FACSIMILE) = Att::GetOffset(element, dynamic_cast<const AttFacsimile *>(element));
+}
+
 } // vrv namespace
@@ -90,7 +90,7 @@ bool AttTabular::HasRowspan() const
 bool Att::SetFigtable(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_TABULAR)) {
-        AttTabular *att = dynamic_cast<AttTabular *>(element);
+        AttTabular *att = element->GetAttClass<AttTabular>(ATT_TABULAR);
         assert(att);
         if (attrType == "colspan") {
             att->SetColspan(att->StrToInt(attrValue));
@@ -108,7 +108,7 @@ bool Att::SetFigtable(Object *element, const std::string &attrType, const std::s
 void Att::GetFigtable(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_TABULAR)) {
-        const AttTabular *att = dynamic_cast<const AttTabular *>(element);
+        const AttTabular *att = element->GetAttClass<AttTabular>(ATT_TABULAR);
         assert(att);
         if (att->HasColspan()) {
             attributes->push_back(std::make_pair("colspan", att->IntToStr(att->GetColspan())));
@@ -119,4 +119,9 @@ void Att::GetFigtable(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::GetFigtableOffsets(const Object *element, std::vector<int> *offsets)
+{
+    offsets->at(ATT_TABULAR) = Att::GetOffset(element, dynamic_cast<const AttTabular *>(element));
+}
+
 } // vrv namespace
@@ -75,7 +75,7 @@ bool AttFingGrpLog::HasForm() const
 bool Att::SetFingering(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_FINGGRPLOG)) {
-        AttFingGrpLog *att = dynamic_cast<AttFingGrpLog *>(element);
+        AttFingGrpLog *att = element->GetAttClass<AttFingGrpLog>(ATT_FINGGRPLOG);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToFingGrpLogForm(attrValue));
@@ -89,7 +89,7 @@ bool Att::SetFingering(Object *element, const std::string &attrType, const std::
 void Att::GetFingering(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_FINGGRPLOG)) {
-        const AttFingGrpLog *att = dynamic_cast<const AttFingGrpLog *>(element);
+        const AttFingGrpLog *att = element->GetAttClass<AttFingGrpLog>(ATT_FINGGRPLOG);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back(std::make_pair("form", att->FingGrpLogFormToStr(att->GetForm())));
@@ -97,4 +97,9 @@ void Att::GetFingering(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::GetFingeringOffsets(const Object *element, std::vector<int> *offsets)
+{
+    offsets->at(ATT_FINGGRPLOG) = Att::GetOffset(element, dynamic_cast<const AttFingGrpLog *>(element));
+}
+
 } // vrv namespace
@@ -760,7 +760,7 @@ bool AttTimestamp2Gestural::HasTstamp2Real() const
 bool Att::SetGestural(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_ACCIDENTALGESTURAL)) {
-        AttAccidentalGestural *att = dynamic_cast<AttAccidentalGestural *>(element);
+        AttAccidentalGestural *att = element->GetAttClass<AttAccidentalGestural>(ATT_ACCIDENTALGESTURAL);
         assert(att);
         if (attrType == "accid.ges") {
             att->SetAccidGes(att->StrToAccidentalGestural(attrValue));
@@ -768,7 +768,7 @@ bool Att::SetGestural(Object *element, const std::string &attrType, const std::s
         }
     }
     if (element->HasAttClass(ATT_ARTICULATIONGESTURAL)) {
-        AttArticulationGestural *att = dynamic_cast<AttArticulationGestural *>(element);
+        AttArticulationGestural *att = element->GetAttClass<AttArticulationGestural>(ATT_ARTICULATIONGESTURAL);
         assert(att);
         if (attrType == "artic.ges") {
             att->SetArticGes(att->StrToArticulation(attrValue));
@@ -776,7 +776,7 @@ bool Att::SetGestural(Object *element, const std::string &attrType, const std::s
         }
     }
     if (element->HasAttClass(ATT_BENDGES)) {
-        AttBendGes *att = dynamic_cast<AttBendGes *>(element);
+        AttBendGes *att = element->GetAttClass<AttBendGes>(ATT_BENDGES);
         assert(att);
         if (attrType == "amount") {
             att->SetAmount(att->StrToDbl(attrValue));
@@ -784,7 +784,7 @@ bool Att::SetGestural(Object *element, const std::string &attrType, const std::s
         }
     }
     if (element->HasAttClass(ATT_DURATIONGESTURAL)) {
-        AttDurationGestural *att = dynamic_cast<AttDurationGestural *>(element);
+        AttDurationGestural *att = element->GetAttClass<AttDurationGestural>(ATT_DURATIONGESTURAL);
         assert(att);
         if (attrType == "dur.ges") {
             att->SetDurGes(att->StrToDuration(attrValue));
@@ -812,7 +812,7 @@ bool Att::SetGestural(Object *element, const std::string &attrType, const std::s
         }
     }
     if (element->HasAttClass(ATT_NCGES)) {
-        AttNcGes *att = dynamic_cast<AttNcGes *>(element);
+        AttNcGes *att = element->GetAttClass<AttNcGes>(ATT_NCGES);
         assert(att);
         if (attrType == "oct.ges") {
             att->SetOctGes(att->StrToOctave(attrValue));
@@ -828,7 +828,7 @@ bool Att::SetGestural(Object *element, const std::string &attrType, const std::s
         }
     }
     if (element->HasAttClass(ATT_NOTEGES)) {
-        AttNoteGes *att = dynamic_cast<AttNoteGes *>(element);
+        AttNoteGes *att = element->GetAttClass<AttNoteGes>(ATT_NOTEGES);
         assert(att);
         if (attrType == "extremis") {
             att->SetExtremis(att->StrToNoteGesExtremis(attrValue));
@@ -848,7 +848,7 @@ bool Att::SetGestural(Object *element, const std::string &attrType, const std::s
         }
     }
     if (element->HasAttClass(ATT_SCOREDEFGES)) {
-        AttScoreDefGes *att = dynamic_cast<AttScoreDefGes *>(element);
+        AttScoreDefGes *att = element->GetAttClass<AttScoreDefGes>(ATT_SCOREDEFGES);
         assert(att);
         if (attrType == "tune.pname") {
             att->SetTunePname(att->StrToPitchname(attrValue));
@@ -864,7 +864,7 @@ bool Att::SetGestural(Object *element, const std::string &attrType, const std::s
         }
     }
     if (element->HasAttClass(ATT_SECTIONGES)) {
-        AttSectionGes *att = dynamic_cast<AttSectionGes *>(element);
+        AttSectionGes *att = element->GetAttClass<AttSectionGes>(ATT_SECTIONGES);
         assert(att);
         if (attrType == "attacca") {
             att->SetAttacca(att->StrToBoolean(attrValue));
@@ -872,7 +872,7 @@ bool Att::SetGestural(Object *element, const std::string &attrType, const std::s
         }
     }
     if (element->HasAttClass(ATT_SOUNDLOCATION)) {
-        AttSoundLocation *att = dynamic_cast<AttSoundLocation *>(element);
+        AttSoundLocation *att = element->GetAttClass<AttSoundLocation>(ATT_SOUNDLOCATION);
         assert(att);
         if (attrType == "azimuth") {
             att->SetAzimuth(att->StrToDbl(attrValue));
@@ -884,7 +884,7 @@ bool Att::SetGestural(Object *element, const std::string &attrType, const std::s
         }
     }
     if (element->HasAttClass(ATT_TIMESTAMPGESTURAL)) {
-        AttTimestampGestural *att = dynamic_cast<AttTimestampGestural *>(element);
+        AttTimestampGestural *att = element->GetAttClass<AttTimestampGestural>(ATT_TIMESTAMPGESTURAL);
         assert(att);
         if (attrType == "tstamp.ges") {
             att->SetTstampGes(att->StrToDbl(attrValue));
@@ -896,7 +896,7 @@ bool Att::SetGestural(Object *element, const std::string &attrType, const std::s
         }
     }
     if (element->HasAttClass(ATT_TIMESTAMP2GESTURAL)) {
-        AttTimestamp2Gestural *att = dynamic_cast<AttTimestamp2Gestural *>(element);
+        AttTimestamp2Gestural *att = element->GetAttClass<AttTimestamp2Gestural>(ATT_TIMESTAMP2GESTURAL);
         assert(att);
         if (attrType == "tstamp2.ges") {
             att->SetTstamp2Ges(att->StrToMeasurebeat(attrValue));
@@ -914,28 +914,28 @@ bool Att::SetGestural(Object *element, const std::string &attrType, const std::s
 void Att::GetGestural(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_ACCIDENTALGESTURAL)) {
-        const AttAccidentalGestural *att = dynamic_cast<const AttAccidentalGestural *>(element);
+        const AttAccidentalGestural *att = element->GetAttClass<AttAccidentalGestural>(ATT_ACCIDENTALGESTURAL);
         assert(att);
         if (att->HasAccidGes()) {
             attributes->push_back(std::make_pair("accid.ges", att->AccidentalGesturalToStr(att->GetAccidGes())));
         }
     }
     if (element->HasAttClass(ATT_ARTICULATIONGESTURAL)) {
-        const AttArticulationGestural *att = dynamic_cast<const AttArticulationGestural *>(element);
+        const AttArticulationGestural *att = element->GetAttClass<AttArticulationGestural>(ATT_ARTICULATIONGESTURAL);
         assert(att);
         if (att->HasArticGes()) {
             attributes->push_back(std::make_pair("artic.ges", att->ArticulationToStr(att->GetArticGes())));
         }
     }
     if (element->HasAttClass(ATT_BENDGES)) {
-        const AttBendGes *att = dynamic_cast<const AttBendGes *>(element);
+        const AttBendGes *att = element->GetAttClass<AttBendGes>(ATT_BENDGES);
         assert(att);
         if (att->HasAmount()) {
             attributes->push_back(std::make_pair("amount", att->DblToStr(att->GetAmount())));
         }
     }
     if (element->HasAttClass(ATT_DURATIONGESTURAL)) {
-        const AttDurationGestural *att = dynamic_cast<const AttDurationGestural *>(element);
+        const AttDurationGestural *att = element->GetAttClass<AttDurationGestural>(ATT_DURATIONGESTURAL);
         assert(att);
         if (att->HasDurGes()) {
             attributes->push_back(std::make_pair("dur.ges", att->DurationToStr(att->GetDurGes())));
@@ -957,7 +957,7 @@ void Att::GetGestural(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_NCGES)) {
-        const AttNcGes *att = dynamic_cast<const AttNcGes *>(element);
+        const AttNcGes *att = element->GetAttClass<AttNcGes>(ATT_NCGES);
         assert(att);
         if (att->HasOctGes()) {
             attributes->push_back(std::make_pair("oct.ges", att->OctaveToStr(att->GetOctGes())));
@@ -970,7 +970,7 @@ void Att::GetGestural(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_NOTEGES)) {
-        const AttNoteGes *att = dynamic_cast<const AttNoteGes *>(element);
+        const AttNoteGes *att = element->GetAttClass<AttNoteGes>(ATT_NOTEGES);
         assert(att);
         if (att->HasExtremis()) {
             attributes->push_back(std::make_pair("extremis", att->NoteGesExtremisToStr(att->GetExtremis())));
@@ -986,7 +986,7 @@ void Att::GetGestural(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_SCOREDEFGES)) {
-        const AttScoreDefGes *att = dynamic_cast<const AttScoreDefGes *>(element);
+        const AttScoreDefGes *att = element->GetAttClass<AttScoreDefGes>(ATT_SCOREDEFGES);
         assert(att);
         if (att->HasTunePname()) {
             attributes->push_back(std::make_pair("tune.pname", att->PitchnameToStr(att->GetTunePname())));
@@ -999,14 +999,14 @@ void Att::GetGestural(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_SECTIONGES)) {
-        const AttSectionGes *att = dynamic_cast<const AttSectionGes *>(element);
+        const AttSectionGes *att = element->GetAttClass<AttSectionGes>(ATT_SECTIONGES);
         assert(att);
         if (att->HasAttacca()) {
             attributes->push_back(std::make_pair("attacca", att->BooleanToStr(att->GetAttacca())));
         }
     }
     if (element->HasAttClass(ATT_SOUNDLOCATION)) {
-        const AttSoundLocation *att = dynamic_cast<const AttSoundLocation *>(element);
+        const AttSoundLocation *att = element->GetAttClass<AttSoundLocation>(ATT_SOUNDLOCATION);
         assert(att);
         if (att->HasAzimuth()) {
             attributes->push_back(std::make_pair("azimuth", att->DblToStr(att->GetAzimuth())));
@@ -1016,7 +1016,7 @@ void Att::GetGestural(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_TIMESTAMPGESTURAL)) {
-        const AttTimestampGestural *att = dynamic_cast<const AttTimestampGestural *>(element);
+        const AttTimestampGestural *att = element->GetAttClass<AttTimestampGestural>(ATT_TIMESTAMPGESTURAL);
         assert(att);
         if (att->HasTstampGes()) {
             attributes->push_back(std::make_pair("tstamp.ges", att->DblToStr(att->GetTstampGes())));
@@ -1026,7 +1026,7 @@ void Att::GetGestural(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_TIMESTAMP2GESTURAL)) {
-        const AttTimestamp2Gestural *att = dynamic_cast<const AttTimestamp2Gestural *>(element);
+        const AttTimestamp2Gestural *att = element->GetAttClass<AttTimestamp2Gestural>(ATT_TIMESTAMP2GESTURAL);
         assert(att);
         if (att->HasTstamp2Ges()) {
             attributes->push_back(std::make_pair("tstamp2.ges", att->MeasurebeatToStr(att->GetTstamp2Ges())));
@@ -1037,4 +1037,20 @@ void Att::GetGestural(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::GetGesturalOffsets(const Object *element, std::vector<int> *offsets)
+{
+    offsets->at(ATT_ACCIDENTALGESTURAL) = Att::GetOffset(element, dynamic_cast<const AttAccidentalGestural *>(element));
+    offsets->at(ATT_ARTICULATIONGESTURAL)
+        = Att::GetOffset(element, dynamic_cast<const AttArticulationGestural *>(element));
+    offsets->at(ATT_BENDGES) = Att::GetOffset(element, dynamic_cast<const AttBendGes *>(element));
+    offsets->at(ATT_DURATIONGESTURAL) = Att::GetOffset(element, dynamic_cast<const AttDurationGestural *>(element));
+    offsets->at(ATT_NCGES) = Att::GetOffset(element, dynamic_cast<const AttNcGes *>(element));
+    offsets->at(ATT_NOTEGES) = Att::GetOffset(element, dynamic_cast<const AttNoteGes *>(element));
+    offsets->at(ATT_SCOREDEFGES) = Att::GetOffset(element, dynamic_cast<const AttScoreDefGes *>(element));
+    offsets->at(ATT_SECTIONGES) = Att::GetOffset(element, dynamic_cast<const AttSectionGes *>(element));
+    offsets->at(ATT_SOUNDLOCATION) = Att::GetOffset(element, dynamic_cast<const AttSoundLocation *>(element));
+    offsets->at(ATT_TIMESTAMPGESTURAL) = Att::GetOffset(element, dynamic_cast<const AttTimestampGestural *>(element));
+    offsets->at(ATT_TIMESTAMP2GESTURAL) = Att::GetOffset(element, dynamic_cast<const AttTimestamp2Gestural *>(element));
+}
+
 } // vrv namespace
@@ -75,7 +75,7 @@ bool AttHarmLog::HasChordref() const
 bool Att::SetHarmony(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_HARMLOG)) {
-        AttHarmLog *att = dynamic_cast<AttHarmLog *>(element);
+        AttHarmLog *att = element->GetAttClass<AttHarmLog>(ATT_HARMLOG);
         assert(att);
         if (attrType == "chordref") {
             att->SetChordref(att->StrToStr(attrValue));
@@ -89,7 +89,7 @@ bool Att::SetHarmony(Object *element, const std::string &attrType, const std::st
 void Att::GetHarmony(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_HARMLOG)) {
-        const AttHarmLog *att = dynamic_cast<const AttHarmLog *>(element);
+        const AttHarmLog *att = element->GetAttClass<AttHarmLog>(ATT_HARMLOG);
         assert(att);
         if (att->HasChordref()) {
             attributes->push_back(std::make_pair("chordref", att->StrToStr(att->GetChordref())));
@@ -97,4 +97,9 @@ void Att::GetHarmony(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::GetHarmonyOffsets(const Object *element, std::vector<int> *offsets)
+{
+    offsets->at(ATT_HARMLOG) = Att::GetOffset(element, dynamic_cast<const AttHarmLog *>(element));
+}
+
 } // vrv namespace
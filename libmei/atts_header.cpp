@@ -273,7 +273,7 @@ bool AttRegularMethod::HasMethod() const
 bool Att::SetHeader(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_BIFOLIUMSURFACES)) {
-        AttBifoliumSurfaces *att = dynamic_cast<AttBifoliumSurfaces *>(element);
+        AttBifoliumSurfaces *att = element->GetAttClass<AttBifoliumSurfaces>(ATT_BIFOLIUMSURFACES);
         assert(att);
         if (attrType == "outer.recto") {
             att->SetOuterRecto(att->StrToStr(attrValue));
@@ -293,7 +293,7 @@ bool Att::SetHeader(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_FOLIUMSURFACES)) {
-        AttFoliumSurfaces *att = dynamic_cast<AttFoliumSurfaces *>(element);
+        AttFoliumSurfaces *att = element->GetAttClass<AttFoliumSurfaces>(ATT_FOLIUMSURFACES);
         assert(att);
         if (attrType == "recto") {
             att->SetRecto(att->StrToStr(attrValue));
@@ -305,7 +305,7 @@ bool Att::SetHeader(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_RECORDTYPE)) {
-        AttRecordType *att = dynamic_cast<AttRecordType *>(element);
+        AttRecordType *att = element->GetAttClass<AttRecordType>(ATT_RECORDTYPE);
         assert(att);
         if (attrType == "recordtype") {
             att->SetRecordtype(att->StrToRecordTypeRecordtype(attrValue));
@@ -313,7 +313,7 @@ bool Att::SetHeader(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_REGULARMETHOD)) {
-        AttRegularMethod *att = dynamic_cast<AttRegularMethod *>(element);
+        AttRegularMethod *att = element->GetAttClass<AttRegularMethod>(ATT_REGULARMETHOD);
         assert(att);
         if (attrType == "method") {
             att->SetMethod(att->StrToRegularMethodMethod(attrValue));
@@ -327,7 +327,7 @@ bool Att::SetHeader(Object *element, const std::string &attrType, const std::str
 void Att::GetHeader(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_BIFOLIUMSURFACES)) {
-        const AttBifoliumSurfaces *att = dynamic_cast<const AttBifoliumSurfaces *>(element);
+        const AttBifoliumSurfaces *att = element->GetAttClass<AttBifoliumSurfaces>(ATT_BIFOLIUMSURFACES);
         assert(att);
         if (att->HasOuterRecto()) {
             attributes->push_back(std::make_pair("outer.recto", att->StrToStr(att->GetOuterRecto())));
@@ -343,7 +343,7 @@ void Att::GetHeader(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_FOLIUMSURFACES)) {
-        const AttFoliumSurfaces *att = dynamic_cast<const AttFoliumSurfaces *>(element);
+        const AttFoliumSurfaces *att = element->GetAttClass<AttFoliumSurfaces>(ATT_FOLIUMSURFACES);
         assert(att);
         if (att->HasRecto()) {
             attributes->push_back(std::make_pair("recto", att->StrToStr(att->GetRecto())));
@@ -353,14 +353,14 @@ void Att::GetHeader(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_RECORDTYPE)) {
-        const AttRecordType *att = dynamic_cast<const AttRecordType *>(element);
+        const AttRecordType *att = element->GetAttClass<AttRecordType>(ATT_RECORDTYPE);
         assert(att);
         if (att->HasRecordtype()) {
             attributes->push_back(std::make_pair("recordtype", att->RecordTypeRecordtypeToStr(att->GetRecordtype())));
         }
     }
     if (element->HasAttClass(ATT_REGULARMETHOD)) {
-        const AttRegularMethod *att = dynamic_cast<const AttRegularMethod *>(element);
+        const AttRegularMethod *att = element->GetAttClass<AttRegularMethod>(ATT_REGULARMETHOD);
         assert(att);
         if (att->HasMethod()) {
             attributes->push_back(std::make_pair("method", att->RegularMethodMethodToStr(att->GetMethod())));
@@ -368,4 +368,12 @@ void Att::GetHeader(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::GetHeaderOffsets(const Object *element, std::vector<int> *offsets)
+{
+    offsets->at(ATT_BIFOLIUMSURFACES) = Att::GetOffset(element, dynamic_cast<const AttBifoliumSurfaces *>(element));
+    offsets->at(ATT_FOLIUMSURFACES) = Att::GetOffset(element, dynamic_cast<const AttFoliumSurfaces *>(element));
+    offsets->at(ATT_RECORDTYPE) = Att::GetOffset(element, dynamic_cast<const AttRecordType *>(element));
+    offsets->at(ATT_REGULARMETHOD) = Att::GetOffset(element, dynamic_cast<const AttRegularMethod *>(element));
+}
+
 } // vrv namespace
@@ -90,7 +90,7 @@ bool AttNotationType::HasNotationsubtype() const
 bool Att::SetMei(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_NOTATIONTYPE)) {
-        AttNotationType *att = dynamic_cast<AttNotationType *>(element);
+        AttNotationType *att = element->GetAttClass<AttNotationType>(ATT_NOTATIONTYPE);
         assert(att);
         if (attrType == "notationtype") {
             att->SetNotationtype(att->StrToNotationtype(attrValue));
@@ -108,7 +108,7 @@ bool Att::SetMei(Object *element, const std::string &attrType, const std::string
 void Att::GetMei(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_NOTATIONTYPE)) {
-        const AttNotationType *att = dynamic_cast<const AttNotationType *>(element);
+        const AttNotationType *att = element->GetAttClass<AttNotationType>(ATT_NOTATIONTYPE);
         assert(att);
         if (att->HasNotationtype()) {
             attributes->push_back(std::make_pair("notationtype", att->NotationtypeToStr(att->GetNotationtype())));
@@ -119,4 +119,9 @@ void Att::GetMei(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::GetMeiOffsets(const Object *element, std::vector<int> *offsets)
+{
+    offsets->at(ATT_NOTATIONTYPE) = Att::GetOffset(element, dynamic_cast<const AttNotationType *>(element));
+}
+
 } // vrv namespace
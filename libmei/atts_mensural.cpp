@@ -562,7 +562,7 @@ bool AttStemsMensural::HasStemForm() const
 bool Att::SetMensural(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_DURATIONQUALITY)) {
-        AttDurationQuality *att = dynamic_cast<AttDurationQuality *>(element);
+        AttDurationQuality *att = element->GetAttClass<AttDurationQuality>(ATT_DURATIONQUALITY);
         assert(att);
         if (attrType == "dur.quality") {
             att->SetDurQuality(att->StrToDurqualityMensural(attrValue));
@@ -570,7 +570,7 @@ bool Att::SetMensural(Object *element, const std::string &attrType, const std::s
         }
     }
     if (element->HasAttClass(ATT_MENSURALLOG)) {
-        AttMensuralLog *att = dynamic_cast<AttMensuralLog *>(element);
+        AttMensuralLog *att = element->GetAttClass<AttMensuralLog>(ATT_MENSURALLOG);
         assert(att);
         if (attrType == "proport.num") {
             att->SetProportNum(att->StrToInt(attrValue));
@@ -582,7 +582,7 @@ bool Att::SetMensural(Object *element, const std::string &attrType, const std::s
         }
     }
     if (element->HasAttClass(ATT_MENSURALSHARED)) {
-        AttMensuralShared *att = dynamic_cast<AttMensuralShared *>(element);
+        AttMensuralShared *att = element->GetAttClass<AttMensuralShared>(ATT_MENSURALSHARED);
         assert(att);
         if (attrType == "modusmaior") {
             att->SetModusmaior(att->StrToModusmaior(attrValue));
@@ -606,7 +606,7 @@ bool Att::SetMensural(Object *element, const std::string &attrType, const std::s
         }
     }
     if (element->HasAttClass(ATT_NOTEVISMENSURAL)) {
-        AttNoteVisMensural *att = dynamic_cast<AttNoteVisMensural *>(element);
+        AttNoteVisMensural *att = element->GetAttClass<AttNoteVisMensural>(ATT_NOTEVISMENSURAL);
         assert(att);
         if (attrType == "lig") {
             att->SetLig(att->StrToLigatureform(attrValue));
@@ -614,7 +614,7 @@ bool Att::SetMensural(Object *element, const std::string &attrType, const std::s
         }
     }
     if (element->HasAttClass(ATT_PLICAVIS)) {
-        AttPlicaVis *att = dynamic_cast<AttPlicaVis *>(element);
+        AttPlicaVis *att = element->GetAttClass<AttPlicaVis>(ATT_PLICAVIS);
         assert(att);
         if (attrType == "dir") {
             att->SetDir(att->StrToStemdirectionBasic(attrValue));
@@ -626,7 +626,7 @@ bool Att::SetMensural(Object *element, const std::string &attrType, const std::s
         }
     }
     if (element->HasAttClass(ATT_RESTVISMENSURAL)) {
-        AttRestVisMensural *att = dynamic_cast<AttRestVisMensural *>(element);
+        AttRestVisMensural *att = element->GetAttClass<AttRestVisMensural>(ATT_RESTVISMENSURAL);
         assert(att);
         if (attrType == "spaces") {
             att->SetSpaces(att->StrToInt(attrValue));
@@ -634,7 +634,7 @@ bool Att::SetMensural(Object *element, const std::string &attrType, const std::s
         }
     }
     if (element->HasAttClass(ATT_STEMVIS)) {
-        AttStemVis *att = dynamic_cast<AttStemVis *>(element);
+        AttStemVis *att = element->GetAttClass<AttStemVis>(ATT_STEMVIS);
         assert(att);
         if (attrType == "pos") {
             att->SetPos(att->StrToStemposition(attrValue));
@@ -662,7 +662,7 @@ bool Att::SetMensural(Object *element, const std::string &attrType, const std::s
         }
     }
     if (element->HasAttClass(ATT_STEMSMENSURAL)) {
-        AttStemsMensural *att = dynamic_cast<AttStemsMensural *>(element);
+        AttStemsMensural *att = element->GetAttClass<AttStemsMensural>(ATT_STEMSMENSURAL);
         assert(att);
         if (attrType == "stem.form") {
             att->SetStemForm(att->StrToStemformMensural(attrValue));
@@ -676,14 +676,14 @@ bool Att::SetMensural(Object *element, const std::string &attrType, const std::s
 void Att::GetMensural(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_DURATIONQUALITY)) {
-        const AttDurationQuality *att = dynamic_cast<const AttDurationQuality *>(element);
+        const AttDurationQuality *att = element->GetAttClass<AttDurationQuality>(ATT_DURATIONQUALITY);
         assert(att);
         if (att->HasDurQuality()) {
             attributes->push_back(std::make_pair("dur.quality", att->DurqualityMensuralToStr(att->GetDurQuality())));
         }
     }
     if (element->HasAttClass(ATT_MENSURALLOG)) {
-        const AttMensuralLog *att = dynamic_cast<const AttMensuralLog *>(element);
+        const AttMensuralLog *att = element->GetAttClass<AttMensuralLog>(ATT_MENSURALLOG);
         assert(att);
         if (att->HasProportNum()) {
             attributes->push_back(std::make_pair("proport.num", att->IntToStr(att->GetProportNum())));
@@ -693,7 +693,7 @@ void Att::GetMensural(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_MENSURALSHARED)) {
-        const AttMensuralShared *att = dynamic_cast<const AttMensuralShared *>(element);
+        const AttMensuralShared *att = element->GetAttClass<AttMensuralShared>(ATT_MENSURALSHARED);
         assert(att);
         if (att->HasModusmaior()) {
             attributes->push_back(std::make_pair("modusmaior", att->ModusmaiorToStr(att->GetModusmaior())));
@@ -712,14 +712,14 @@ void Att::GetMensural(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_NOTEVISMENSURAL)) {
-        const AttNoteVisMensural *att = dynamic_cast<const AttNoteVisMensural *>(element);
+        const AttNoteVisMensural *att = element->GetAttClass<AttNoteVisMensural>(ATT_NOTEVISMENSURAL);
         assert(att);
         if (att->HasLig()) {
             attributes->push_back(std::make_pair("lig", att->LigatureformToStr(att->GetLig())));
         }
     }
     if (element->HasAttClass(ATT_PLICAVIS)) {
-        const AttPlicaVis *att = dynamic_cast<const AttPlicaVis *>(element);
+        const AttPlicaVis *att = element->GetAttClass<AttPlicaVis>(ATT_PLICAVIS);
         assert(att);
         if (att->HasDir()) {
             attributes->push_back(std::make_pair("dir", att->StemdirectionBasicToStr(att->GetDir())));
@@ -729,14 +729,14 @@ void Att::GetMensural(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_RESTVISMENSURAL)) {
-        const AttRestVisMensural *att = dynamic_cast<const AttRestVisMensural *>(element);
+        const AttRestVisMensural *att = element->GetAttClass<AttRestVisMensural>(ATT_RESTVISMENSURAL);
         assert(att);
         if (att->HasSpaces()) {
             attributes->push_back(std::make_pair("spaces", att->IntToStr(att->GetSpaces())));
         }
     }
     if (element->HasAttClass(ATT_STEMVIS)) {
-        const AttStemVis *att = dynamic_cast<const AttStemVis *>(element);
+        const AttStemVis *att = element->GetAttClass<AttStemVis>(ATT_STEMVIS);
         assert(att);
         if (att->HasPos()) {
             attributes->push_back(std::make_pair("pos", att->StempositionToStr(att->GetPos())));
@@ -758,7 +758,7 @@ void Att::GetMensural(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_STEMSMENSURAL)) {
-        const AttStemsMensural *att = dynamic_cast<const AttStemsMensural *>(element);
+        const AttStemsMensural *att = element->GetAttClass<AttStemsMensural>(ATT_STEMSMENSURAL);
         assert(att);
         if (att->HasStemForm()) {
             attributes->push_back(std::make_pair("stem.form", att->StemformMensuralToStr(att->GetStemForm())));
@@ -766,4 +766,16 @@ void Att::GetMensural(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::GetMensuralOffsets(const Object *element, std::vector<int> *offsets)
+{
+    offsets->at(ATT_DURATIONQUALITY) = Att::GetOffset(element, dynamic_cast<const AttDurationQuality *>(element));
+    offsets->at(ATT_MENSURALLOG) = Att::GetOffset(element, dynamic_cast<const AttMensuralLog *>(element));
+    offsets->at(ATT_MENSURALSHARED) = Att::GetOffset(element, dynamic_cast<const AttMensuralShared *>(element));
+    offsets->at(ATT_NOTEVISMENSURAL) = Att::GetOffset(element, dynamic_cast<const AttNoteVisMensural *>(element));
+    offsets->at(ATT_PLICAVIS) = Att::GetOffset(element, dynamic_cast<const AttPlicaVis *>(element));
+    offsets->at(ATT_RESTVISMENSURAL) = Att::GetOffset(element, dynamic_cast<const AttRestVisMensural *>(element));
+    offsets->at(ATT_STEMVIS) = Att::GetOffset(element, dynamic_cast<const AttStemVis *>(element));
+    offsets->at(ATT_STEMSMENSURAL) = Att::GetOffset(element, dynamic_cast<const AttStemsMensural *>(element));
+}
+
 } // vrv namespace
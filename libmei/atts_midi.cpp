@@ -578,7 +578,7 @@ bool AttTimeBase::HasPpq() const
 bool Att::SetMidi(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_CHANNELIZED)) {
-        AttChannelized *att = dynamic_cast<AttChannelized *>(element);
+        AttChannelized *att = element->GetAttClass<AttChannelized>(ATT_CHANNELIZED);
         assert(att);
         if (attrType == "midi.channel") {
             att->SetMidiChannel(att->StrToMidichannel(attrValue));
@@ -598,7 +598,7 @@ bool Att::SetMidi(Object *element, const std::string &attrType, const std::strin
         }
     }
     if (element->HasAttClass(ATT_INSTRUMENTIDENT)) {
-        AttInstrumentIdent *att = dynamic_cast<AttInstrumentIdent *>(element);
+        AttInstrumentIdent *att = element->GetAttClass<AttInstrumentIdent>(ATT_INSTRUMENTIDENT);
         assert(att);
         if (attrType == "instr") {
             att->SetInstr(att->StrToStr(attrValue));
@@ -606,7 +606,7 @@ bool Att::SetMidi(Object *element, const std::string &attrType, const std::strin
         }
     }
     if (element->HasAttClass(ATT_MIDIINSTRUMENT)) {
-        AttMidiInstrument *att = dynamic_cast<AttMidiInstrument *>(element);
+        AttMidiInstrument *att = element->GetAttClass<AttMidiInstrument>(ATT_MIDIINSTRUMENT);
         assert(att);
         if (attrType == "midi.instrnum") {
             att->SetMidiInstrnum(att->StrToMidivalue(attrValue));
@@ -634,7 +634,7 @@ bool Att::SetMidi(Object *element, const std::string &attrType, const std::strin
         }
     }
     if (element->HasAttClass(ATT_MIDINUMBER)) {
-        AttMidiNumber *att = dynamic_cast<AttMidiNumber *>(element);
+        AttMidiNumber *att = element->GetAttClass<AttMidiNumber>(ATT_MIDINUMBER);
         assert(att);
         if (attrType == "num") {
             att->SetNum(att->StrToInt(attrValue));
@@ -642,7 +642,7 @@ bool Att::SetMidi(Object *element, const std::string &attrType, const std::strin
         }
     }
     if (element->HasAttClass(ATT_MIDITEMPO)) {
-        AttMidiTempo *att = dynamic_cast<AttMidiTempo *>(element);
+        AttMidiTempo *att = element->GetAttClass<AttMidiTempo>(ATT_MIDITEMPO);
         assert(att);
         if (attrType == "midi.bpm") {
             att->SetMidiBpm(att->StrToMidibpm(attrValue));
@@ -654,7 +654,7 @@ bool Att::SetMidi(Object *element, const std::string &attrType, const std::strin
         }
     }
     if (element->HasAttClass(ATT_MIDIVALUE)) {
-        AttMidiValue *att = dynamic_cast<AttMidiValue *>(element);
+        AttMidiValue *att = element->GetAttClass<AttMidiValue>(ATT_MIDIVALUE);
         assert(att);
         if (attrType == "val") {
             att->SetVal(att->StrToMidivalue(attrValue));
@@ -662,7 +662,7 @@ bool Att::SetMidi(Object *element, const std::string &attrType, const std::strin
         }
     }
     if (element->HasAttClass(ATT_MIDIVALUE2)) {
-        AttMidiValue2 *att = dynamic_cast<AttMidiValue2 *>(element);
+        AttMidiValue2 *att = element->GetAttClass<AttMidiValue2>(ATT_MIDIVALUE2);
         assert(att);
         if (attrType == "val2") {
             att->SetVal2(att->StrToMidivalue(attrValue));
@@ -670,7 +670,7 @@ bool Att::SetMidi(Object *element, const std::string &attrType, const std::strin
         }
     }
     if (element->HasAttClass(ATT_MIDIVELOCITY)) {
-        AttMidiVelocity *att = dynamic_cast<AttMidiVelocity *>(element);
+        AttMidiVelocity *att = element->GetAttClass<AttMidiVelocity>(ATT_MIDIVELOCITY);
         assert(att);
         if (attrType == "vel") {
             att->SetVel(att->StrToMidivalue(attrValue));
@@ -678,7 +678,7 @@ bool Att::SetMidi(Object *element, const std::string &attrType, const std::strin
         }
     }
     if (element->HasAttClass(ATT_TIMEBASE)) {
-        AttTimeBase *att = dynamic_cast<AttTimeBase *>(element);
+        AttTimeBase *att = element->GetAttClass<AttTimeBase>(ATT_TIMEBASE);
         assert(att);
         if (attrType == "ppq") {
             att->SetPpq(att->StrToInt(attrValue));
@@ -692,7 +692,7 @@ bool Att::SetMidi(Object *element, const std::string &attrType, const std::strin
 void Att::GetMidi(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_CHANNELIZED)) {
-        const AttChannelized *att = dynamic_cast<const AttChannelized *>(element);
+        const AttChannelized *att = element->GetAttClass<AttChannelized>(ATT_CHANNELIZED);
         assert(att);
         if (att->HasMidiChannel()) {
             attributes->push_back(std::make_pair("midi.channel", att->MidichannelToStr(att->GetMidiChannel())));
@@ -708,14 +708,14 @@ void Att::GetMidi(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_INSTRUMENTIDENT)) {
-        const AttInstrumentIdent *att = dynamic_cast<const AttInstrumentIdent *>(element);
+        const AttInstrumentIdent *att = element->GetAttClass<AttInstrumentIdent>(ATT_INSTRUMENTIDENT);
         assert(att);
         if (att->HasInstr()) {
             attributes->push_back(std::make_pair("instr", att->StrToStr(att->GetInstr())));
         }
     }
     if (element->HasAttClass(ATT_MIDIINSTRUMENT)) {
-        const AttMidiInstrument *att = dynamic_cast<const AttMidiInstrument *>(element);
+        const AttMidiInstrument *att = element->GetAttClass<AttMidiInstrument>(ATT_MIDIINSTRUMENT);
         assert(att);
         if (att->HasMidiInstrnum()) {
             attributes->push_back(std::make_pair("midi.instrnum", att->MidivalueToStr(att->GetMidiInstrnum())));
@@ -737,14 +737,14 @@ void Att::GetMidi(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_MIDINUMBER)) {
-        const AttMidiNumber *att = dynamic_cast<const AttMidiNumber *>(element);
+        const AttMidiNumber *att = element->GetAttClass<AttMidiNumber>(ATT_MIDINUMBER);
         assert(att);
         if (att->HasNum()) {
             attributes->push_back(std::make_pair("num", att->IntToStr(att->GetNum())));
         }
     }
     if (element->HasAttClass(ATT_MIDITEMPO)) {
-        const AttMidiTempo *att = dynamic_cast<const AttMidiTempo *>(element);
+        const AttMidiTempo *att = element->GetAttClass<AttMidiTempo>(ATT_MIDITEMPO);
         assert(att);
         if (att->HasMidiBpm()) {
             attributes->push_back(std::make_pair("midi.bpm", att->MidibpmToStr(att->GetMidiBpm())));
@@ -754,28 +754,28 @@ void Att::GetMidi(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_MIDIVALUE)) {
-        const AttMidiValue *att = dynamic_cast<const AttMidiValue *>(element);
+        const AttMidiValue *att = element->GetAttClass<AttMidiValue>(ATT_MIDIVALUE);
         assert(att);
         if (att->HasVal()) {
             attributes->push_back(std::make_pair("val", att->MidivalueToStr(att->GetVal())));
         }
     }
     if (element->HasAttClass(ATT_MIDIVALUE2)) {
-        const AttMidiValue2 *att = dynamic_cast<const AttMidiValue2 *>(element);
+        const AttMidiValue2 *att = element->GetAttClass<AttMidiValue2>(ATT_MIDIVALUE2);
         assert(att);
         if (att->HasVal2()) {
             attributes->push_back(std::make_pair("val2", att->MidivalueToStr(att->GetVal2())));
         }
     }
     if (element->HasAttClass(ATT_MIDIVELOCITY)) {
-        const AttMidiVelocity *att = dynamic_cast<const AttMidiVelocity *>(element);
+        const AttMidiVelocity *att = element->GetAttClass<AttMidiVelocity>(ATT_MIDIVELOCITY);
         assert(att);
         if (att->HasVel()) {
             attributes->push_back(std::make_pair("vel", att->MidivalueToStr(att->GetVel())));
         }
     }
     if (element->HasAttClass(ATT_TIMEBASE)) {
-        const AttTimeBase *att = dynamic_cast<const AttTimeBase *>(element);
+        const AttTimeBase *att = element->GetAttClass<AttTimeBase>(ATT_TIMEBASE);
         assert(att);
         if (att->HasPpq()) {
             attributes->push_back(std::make_pair("ppq", att->IntToStr(att->GetPpq())));
@@ -783,4 +783,17 @@ void Att::GetMidi(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::GetMidiOffsets(const Object *element, std::vector<int> *offsets)
+{
+    offsets->at(ATT_CHANNELIZED) = Att::GetOffset(element, dynamic_cast<const AttChannelized *>(element));
+    offsets->at(ATT_INSTRUMENTIDENT) = Att::GetOffset(element, dynamic_cast<const AttInstrumentIdent *>(element));
+    offsets->at(ATT_MIDIINSTRUMENT) = Att::GetOffset(element, dynamic_cast<const AttMidiInstrument *>(element));
+    offsets->at(ATT_MIDINUMBER) = Att::GetOffset(element, dynamic_cast<const AttMidiNumber *>(element));
+    offsets->at(ATT_MIDITEMPO) = Att::GetOffset(element, dynamic_cast<const AttMidiTempo *>(element));
+    offsets->at(ATT_MIDIVALUE) = Att::GetOffset(element, dynamic_cast<const AttMidiValue *>(element));
+    offsets->at(ATT_MIDIVALUE2) = Att::GetOffset(element, dynamic_cast<const AttMidiValue2 *>(element));
+    offsets->at(ATT_MIDIVELOCITY) = Att::GetOffset(element, dynamic_cast<const AttMidiVelocity *>(element));
+    offsets->at(ATT_TIMEBASE) = Att::GetOffset(element, dynamic_cast<const AttTimeBase *>(element));
+}
+
 } // vrv namespace
@@ -241,7 +241,7 @@ bool AttNcForm::HasTilt() const
 bool Att::SetNeumes(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_NCLOG)) {
-        AttNcLog *att = dynamic_cast<AttNcLog *>(element);
+        AttNcLog *att = element->GetAttClass<AttNcLog>(ATT_NCLOG);
         assert(att);
         if (attrType == "oct") {
             att->SetOct(att->StrToStr(attrValue));
@@ -253,7 +253,7 @@ bool Att::SetNeumes(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_NCFORM)) {
-        AttNcForm *att = dynamic_cast<AttNcForm *>(element);
+        AttNcForm *att = element->GetAttClass<AttNcForm>(ATT_NCFORM);
         assert(att);
         if (attrType == "angled") {
             att->SetAngled(att->StrToBoolean(attrValue));
@@ -295,7 +295,7 @@ bool Att::SetNeumes(Object *element, const std::string &attrType, const std::str
 void Att::GetNeumes(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_NCLOG)) {
-        const AttNcLog *att = dynamic_cast<const AttNcLog *>(element);
+        const AttNcLog *att = element->GetAttClass<AttNcLog>(ATT_NCLOG);
         assert(att);
         if (att->HasOct()) {
             attributes->push_back(std::make_pair("oct", att->StrToStr(att->GetOct())));
@@ -305,7 +305,7 @@ void Att::GetNeumes(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_NCFORM)) {
-        const AttNcForm *att = dynamic_cast<const AttNcForm *>(element);
+        const AttNcForm *att = element->GetAttClass<AttNcForm>(ATT_NCFORM);
         assert(att);
         if (att->HasAngled()) {
             attributes->push_back(std::make_pair("angled", att->BooleanToStr(att->GetAngled())));
@@ -334,4 +334,10 @@ void Att::GetNeumes(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::GetNeumesOffsets(const Object *element, std::vector<int> *offsets)
+{
+    offsets->at(ATT_NCLOG) = Att::GetOffset(element, dynamic_cast<const AttNcLog *>(element));
+    offsets->at(ATT_NCFORM) = Att::GetOffset(element, dynamic_cast<const AttNcForm *>(element));
+}
+
 } // vrv namespace
@@ -75,7 +75,7 @@ bool AttSurface::HasSurface() const
 bool Att::SetPagebased(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_SURFACE)) {
-        AttSurface *att = dynamic_cast<AttSurface *>(element);
+        AttSurface *att = element->GetAttClass<AttSurface>(ATT_SURFACE);
         assert(att);
         if (attrType == "surface") {
             att->SetSurface(att->StrToStr(attrValue));
@@ -89,7 +89,7 @@ bool Att::SetPagebased(Object *element, const std::string &attrType, const std::
 void Att::GetPagebased(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_SURFACE)) {
-        const AttSurface *att = dynamic_cast<const AttSurface *>(element);
+        const AttSurface *att = element->GetAttClass<AttSurface>(ATT_SURFACE);
         assert(att);
         if (att->HasSurface()) {
             attributes->push_back(std::make_pair("surface", att->StrToStr(att->GetSurface())));
@@ -97,4 +97,9 @@ void Att::GetPagebased(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::GetPagebasedOffsets(const Object *element, std::vector<int> *offsets)
+{
+    offsets->at(ATT_SURFACE) = Att::GetOffset(element, dynamic_cast<const AttSurface *>(element));
+}
+
 } // vrv namespace
@@ -75,7 +75,7 @@ bool AttAlignment::HasWhen() const
 bool Att::SetPerformance(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_ALIGNMENT)) {
-        AttAlignment *att = dynamic_cast<AttAlignment *>(element);
+        AttAlignment *att = element->GetAttClass<AttAlignment>(ATT_ALIGNMENT);
         assert(att);
         if (attrType == "when") {
             att->SetWhen(att->StrToStr(attrValue));
@@ -89,7 +89,7 @@ bool Att::SetPerformance(Object *element, const std::string &attrType, const std
 void Att::GetPerformance(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_ALIGNMENT)) {
-        const AttAlignment *att = dynamic_cast<const AttAlignment *>(element);
+        const AttAlignment *att = element->GetAttClass<AttAlignment>(ATT_ALIGNMENT);
         assert(att);
         if (att->HasWhen()) {
             attributes->push_back(std::make_pair("when", att->StrToStr(att->GetWhen())));
@@ -97,4 +97,9 @@ void Att::GetPerformance(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::GetPerformanceOffsets(const Object *element, std::vector<int> *offsets)
+{
+    offsets->at(ATT_ALIGNMENT) = Att::GetOffset(element, dynamic_cast<const AttAlignment *>(element));
+}
+
 } // vrv namespace
@@ -7950,7 +7950,7 @@ bool AttXy2::HasY2() const
 bool Att::SetShared(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_ACCIDLOG)) {
-        AttAccidLog *att = dynamic_cast<AttAccidLog *>(element);
+        AttAccidLog *att = element->GetAttClass<AttAccidLog>(ATT_ACCIDLOG);
         assert(att);
         if (attrType == "func") {
             att->SetFunc(att->StrToAccidLogFunc(attrValue));
@@ -7958,7 +7958,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_ACCIDENTAL)) {
-        AttAccidental *att = dynamic_cast<AttAccidental *>(element);
+        AttAccidental *att = element->GetAttClass<AttAccidental>(ATT_ACCIDENTAL);
         assert(att);
         if (attrType == "accid") {
             att->SetAccid(att->StrToAccidentalWritten(attrValue));
@@ -7966,7 +7966,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_ARTICULATION)) {
-        AttArticulation *att = dynamic_cast<AttArticulation *>(element);
+        AttArticulation *att = element->GetAttClass<AttArticulation>(ATT_ARTICULATION);
         assert(att);
         if (attrType == "artic") {
             att->SetArtic(att->StrToArticulationList(attrValue));
@@ -7974,7 +7974,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_ATTACCALOG)) {
-        AttAttaccaLog *att = dynamic_cast<AttAttaccaLog *>(element);
+        AttAttaccaLog *att = element->GetAttClass<AttAttaccaLog>(ATT_ATTACCALOG);
         assert(att);
         if (attrType == "target") {
             att->SetTarget(att->StrToStr(attrValue));
@@ -7982,7 +7982,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_AUDIENCE)) {
-        AttAudience *att = dynamic_cast<AttAudience *>(element);
+        AttAudience *att = element->GetAttClass<AttAudience>(ATT_AUDIENCE);
         assert(att);
         if (attrType == "audience") {
             att->SetAudience(att->StrToAudienceAudience(attrValue));
@@ -7990,7 +7990,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_AUGMENTDOTS)) {
-        AttAugmentDots *att = dynamic_cast<AttAugmentDots *>(element);
+        AttAugmentDots *att = element->GetAttClass<AttAugmentDots>(ATT_AUGMENTDOTS);
         assert(att);
         if (attrType == "dots") {
             att->SetDots(att->StrToInt(attrValue));
@@ -7998,7 +7998,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_AUTHORIZED)) {
-        AttAuthorized *att = dynamic_cast<AttAuthorized *>(element);
+        AttAuthorized *att = element->GetAttClass<AttAuthorized>(ATT_AUTHORIZED);
         assert(att);
         if (attrType == "auth") {
             att->SetAuth(att->StrToStr(attrValue));
@@ -8010,7 +8010,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_BARLINELOG)) {
-        AttBarLineLog *att = dynamic_cast<AttBarLineLog *>(element);
+        AttBarLineLog *att = element->GetAttClass<AttBarLineLog>(ATT_BARLINELOG);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToBarrendition(attrValue));
@@ -8018,7 +8018,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_BARRING)) {
-        AttBarring *att = dynamic_cast<AttBarring *>(element);
+        AttBarring *att = element->GetAttClass<AttBarring>(ATT_BARRING);
         assert(att);
         if (attrType == "bar.len") {
             att->SetBarLen(att->StrToDbl(attrValue));
@@ -8034,7 +8034,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_BASIC)) {
-        AttBasic *att = dynamic_cast<AttBasic *>(element);
+        AttBasic *att = element->GetAttClass<AttBasic>(ATT_BASIC);
         assert(att);
         if (attrType == "xml:base") {
             att->SetBase(att->StrToStr(attrValue));
@@ -8042,7 +8042,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_BIBL)) {
-        AttBibl *att = dynamic_cast<AttBibl *>(element);
+        AttBibl *att = element->GetAttClass<AttBibl>(ATT_BIBL);
         assert(att);
         if (attrType == "analog") {
             att->SetAnalog(att->StrToStr(attrValue));
@@ -8050,7 +8050,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_CALENDARED)) {
-        AttCalendared *att = dynamic_cast<AttCalendared *>(element);
+        AttCalendared *att = element->GetAttClass<AttCalendared>(ATT_CALENDARED);
         assert(att);
         if (attrType == "calendar") {
             att->SetCalendar(att->StrToStr(attrValue));
@@ -8058,7 +8058,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_CANONICAL)) {
-        AttCanonical *att = dynamic_cast<AttCanonical *>(element);
+        AttCanonical *att = element->GetAttClass<AttCanonical>(ATT_CANONICAL);
         assert(att);
         if (attrType == "codedval") {
             att->SetCodedval(att->StrToStr(attrValue));
@@ -8066,7 +8066,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_CLASSED)) {
-        AttClassed *att = dynamic_cast<AttClassed *>(element);
+        AttClassed *att = element->GetAttClass<AttClassed>(ATT_CLASSED);
         assert(att);
         if (attrType == "class") {
             att->SetClass(att->StrToStr(attrValue));
@@ -8074,7 +8074,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_CLEFLOG)) {
-        AttClefLog *att = dynamic_cast<AttClefLog *>(element);
+        AttClefLog *att = element->GetAttClass<AttClefLog>(ATT_CLEFLOG);
         assert(att);
         if (attrType == "cautionary") {
             att->SetCautionary(att->StrToBoolean(attrValue));
@@ -8082,7 +8082,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_CLEFSHAPE)) {
-        AttClefShape *att = dynamic_cast<AttClefShape *>(element);
+        AttClefShape *att = element->GetAttClass<AttClefShape>(ATT_CLEFSHAPE);
         assert(att);
         if (attrType == "shape") {
             att->SetShape(att->StrToClefshape(attrValue));
@@ -8090,7 +8090,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_CLEFFINGLOG)) {
-        AttCleffingLog *att = dynamic_cast<AttCleffingLog *>(element);
+        AttCleffingLog *att = element->GetAttClass<AttCleffingLog>(ATT_CLEFFINGLOG);
         assert(att);
         if (attrType == "clef.shape") {
             att->SetClefShape(att->StrToClefshape(attrValue));
@@ -8110,7 +8110,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_COLOR)) {
-        AttColor *att = dynamic_cast<AttColor *>(element);
+        AttColor *att = element->GetAttClass<AttColor>(ATT_COLOR);
         assert(att);
         if (attrType == "color") {
             att->SetColor(att->StrToStr(attrValue));
@@ -8118,7 +8118,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_COLORATION)) {
-        AttColoration *att = dynamic_cast<AttColoration *>(element);
+        AttColoration *att = element->GetAttClass<AttColoration>(ATT_COLORATION);
         assert(att);
         if (attrType == "colored") {
             att->SetColored(att->StrToBoolean(attrValue));
@@ -8126,7 +8126,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_COORDINATED)) {
-        AttCoordinated *att = dynamic_cast<AttCoordinated *>(element);
+        AttCoordinated *att = element->GetAttClass<AttCoordinated>(ATT_COORDINATED);
         assert(att);
         if (attrType == "ulx") {
             att->SetUlx(att->StrToInt(attrValue));
@@ -8150,7 +8150,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_CUE)) {
-        AttCue *att = dynamic_cast<AttCue *>(element);
+        AttCue *att = element->GetAttClass<AttCue>(ATT_CUE);
         assert(att);
         if (attrType == "cue") {
             att->SetCue(att->StrToBoolean(attrValue));
@@ -8158,7 +8158,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_CURVATURE)) {
-        AttCurvature *att = dynamic_cast<AttCurvature *>(element);
+        AttCurvature *att = element->GetAttClass<AttCurvature>(ATT_CURVATURE);
         assert(att);
         if (attrType == "bezier") {
             att->SetBezier(att->StrToStr(attrValue));
@@ -8174,7 +8174,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_CURVEREND)) {
-        AttCurveRend *att = dynamic_cast<AttCurveRend *>(element);
+        AttCurveRend *att = element->GetAttClass<AttCurveRend>(ATT_CURVEREND);
         assert(att);
         if (attrType == "lform") {
             att->SetLform(att->StrToLineform(attrValue));
@@ -8186,7 +8186,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_CUSTOSLOG)) {
-        AttCustosLog *att = dynamic_cast<AttCustosLog *>(element);
+        AttCustosLog *att = element->GetAttClass<AttCustosLog>(ATT_CUSTOSLOG);
         assert(att);
         if (attrType == "target") {
             att->SetTarget(att->StrToStr(attrValue));
@@ -8194,7 +8194,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_DATAPOINTING)) {
-        AttDataPointing *att = dynamic_cast<AttDataPointing *>(element);
+        AttDataPointing *att = element->GetAttClass<AttDataPointing>(ATT_DATAPOINTING);
         assert(att);
         if (attrType == "data") {
             att->SetData(att->StrToStr(attrValue));
@@ -8202,7 +8202,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_DATABLE)) {
-        AttDatable *att = dynamic_cast<AttDatable *>(element);
+        AttDatable *att = element->GetAttClass<AttDatable>(ATT_DATABLE);
         assert(att);
         if (attrType == "enddate") {
             att->SetEnddate(att->StrToStr(attrValue));
@@ -8226,7 +8226,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_DISTANCES)) {
-        AttDistances *att = dynamic_cast<AttDistances *>(element);
+        AttDistances *att = element->GetAttClass<AttDistances>(ATT_DISTANCES);
         assert(att);
         if (attrType == "dynam.dist") {
             att->SetDynamDist(att->StrToMeasurementrel(attrValue));
@@ -8242,7 +8242,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_DOTLOG)) {
-        AttDotLog *att = dynamic_cast<AttDotLog *>(element);
+        AttDotLog *att = element->GetAttClass<AttDotLog>(ATT_DOTLOG);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToDotLogForm(attrValue));
@@ -8250,7 +8250,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_DURATIONADDITIVE)) {
-        AttDurationAdditive *att = dynamic_cast<AttDurationAdditive *>(element);
+        AttDurationAdditive *att = element->GetAttClass<AttDurationAdditive>(ATT_DURATIONADDITIVE);
         assert(att);
         if (attrType == "dur") {
             att->SetDur(att->StrToDuration(attrValue));
@@ -8258,7 +8258,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_DURATIONDEFAULT)) {
-        AttDurationDefault *att = dynamic_cast<AttDurationDefault *>(element);
+        AttDurationDefault *att = element->GetAttClass<AttDurationDefault>(ATT_DURATIONDEFAULT);
         assert(att);
         if (attrType == "dur.default") {
             att->SetDurDefault(att->StrToDuration(attrValue));
@@ -8274,7 +8274,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_DURATIONLOGICAL)) {
-        AttDurationLogical *att = dynamic_cast<AttDurationLogical *>(element);
+        AttDurationLogical *att = element->GetAttClass<AttDurationLogical>(ATT_DURATIONLOGICAL);
         assert(att);
         if (attrType == "dur") {
             att->SetDur(att->StrToDuration(attrValue));
@@ -8282,7 +8282,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_DURATIONRATIO)) {
-        AttDurationRatio *att = dynamic_cast<AttDurationRatio *>(element);
+        AttDurationRatio *att = element->GetAttClass<AttDurationRatio>(ATT_DURATIONRATIO);
         assert(att);
         if (attrType == "num") {
             att->SetNum(att->StrToInt(attrValue));
@@ -8294,7 +8294,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_ENCLOSINGCHARS)) {
-        AttEnclosingChars *att = dynamic_cast<AttEnclosingChars *>(element);
+        AttEnclosingChars *att = element->GetAttClass<AttEnclosingChars>(ATT_ENCLOSINGCHARS);
         assert(att);
         if (attrType == "enclose") {
             att->SetEnclose(att->StrToEnclosure(attrValue));
@@ -8302,7 +8302,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_ENDINGS)) {
-        AttEndings *att = dynamic_cast<AttEndings *>(element);
+        AttEndings *att = element->GetAttClass<AttEndings>(ATT_ENDINGS);
         assert(att);
         if (attrType == "ending.rend") {
             att->SetEndingRend(att->StrToEndingsEndingrend(attrValue));
@@ -8310,7 +8310,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_EVIDENCE)) {
-        AttEvidence *att = dynamic_cast<AttEvidence *>(element);
+        AttEvidence *att = element->GetAttClass<AttEvidence>(ATT_EVIDENCE);
         assert(att);
         if (attrType == "cert") {
             att->SetCert(att->StrToCertainty(attrValue));
@@ -8322,7 +8322,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_EXTENDER)) {
-        AttExtender *att = dynamic_cast<AttExtender *>(element);
+        AttExtender *att = element->GetAttClass<AttExtender>(ATT_EXTENDER);
         assert(att);
         if (attrType == "extender") {
             att->SetExtender(att->StrToBoolean(attrValue));
@@ -8330,7 +8330,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_EXTENT)) {
-        AttExtent *att = dynamic_cast<AttExtent *>(element);
+        AttExtent *att = element->GetAttClass<AttExtent>(ATT_EXTENT);
         assert(att);
         if (attrType == "extent") {
             att->SetExtent(att->StrToStr(attrValue));
@@ -8338,7 +8338,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_FERMATAPRESENT)) {
-        AttFermataPresent *att = dynamic_cast<AttFermataPresent *>(element);
+        AttFermataPresent *att = element->GetAttClass<AttFermataPresent>(ATT_FERMATAPRESENT);
         assert(att);
         if (attrType == "fermata") {
             att->SetFermata(att->StrToStaffrelBasic(attrValue));
@@ -8346,7 +8346,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_FILING)) {
-        AttFiling *att = dynamic_cast<AttFiling *>(element);
+        AttFiling *att = element->GetAttClass<AttFiling>(ATT_FILING);
         assert(att);
         if (attrType == "nonfiling") {
             att->SetNonfiling(att->StrToInt(attrValue));
@@ -8354,7 +8354,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_GRPSYMLOG)) {
-        AttGrpSymLog *att = dynamic_cast<AttGrpSymLog *>(element);
+        AttGrpSymLog *att = element->GetAttClass<AttGrpSymLog>(ATT_GRPSYMLOG);
         assert(att);
         if (attrType == "level") {
             att->SetLevel(att->StrToInt(attrValue));
@@ -8362,7 +8362,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_HANDIDENT)) {
-        AttHandIdent *att = dynamic_cast<AttHandIdent *>(element);
+        AttHandIdent *att = element->GetAttClass<AttHandIdent>(ATT_HANDIDENT);
         assert(att);
         if (attrType == "hand") {
             att->SetHand(att->StrToStr(attrValue));
@@ -8370,7 +8370,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_HEIGHT)) {
-        AttHeight *att = dynamic_cast<AttHeight *>(element);
+        AttHeight *att = element->GetAttClass<AttHeight>(ATT_HEIGHT);
         assert(att);
         if (attrType == "height") {
             att->SetHeight(att->StrToMeasurementabs(attrValue));
@@ -8378,7 +8378,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_HORIZONTALALIGN)) {
-        AttHorizontalAlign *att = dynamic_cast<AttHorizontalAlign *>(element);
+        AttHorizontalAlign *att = element->GetAttClass<AttHorizontalAlign>(ATT_HORIZONTALALIGN);
         assert(att);
         if (attrType == "halign") {
             att->SetHalign(att->StrToHorizontalalignment(attrValue));
@@ -8386,7 +8386,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_INTERNETMEDIA)) {
-        AttInternetMedia *att = dynamic_cast<AttInternetMedia *>(element);
+        AttInternetMedia *att = element->GetAttClass<AttInternetMedia>(ATT_INTERNETMEDIA);
         assert(att);
         if (attrType == "mimetype") {
             att->SetMimetype(att->StrToStr(attrValue));
@@ -8394,7 +8394,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_JOINED)) {
-        AttJoined *att = dynamic_cast<AttJoined *>(element);
+        AttJoined *att = element->GetAttClass<AttJoined>(ATT_JOINED);
         assert(att);
         if (attrType == "join") {
             att->SetJoin(att->StrToStr(attrValue));
@@ -8402,7 +8402,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_KEYSIGLOG)) {
-        AttKeySigLog *att = dynamic_cast<AttKeySigLog *>(element);
+        AttKeySigLog *att = element->GetAttClass<AttKeySigLog>(ATT_KEYSIGLOG);
         assert(att);
         if (attrType == "sig") {
             att->SetSig(att->StrToKeysignature(attrValue));
@@ -8410,7 +8410,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_KEYSIGDEFAULTLOG)) {
-        AttKeySigDefaultLog *att = dynamic_cast<AttKeySigDefaultLog *>(element);
+        AttKeySigDefaultLog *att = element->GetAttClass<AttKeySigDefaultLog>(ATT_KEYSIGDEFAULTLOG);
         assert(att);
         if (attrType == "key.sig") {
             att->SetKeySig(att->StrToKeysignature(attrValue));
@@ -8418,7 +8418,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_LABELLED)) {
-        AttLabelled *att = dynamic_cast<AttLabelled *>(element);
+        AttLabelled *att = element->GetAttClass<AttLabelled>(ATT_LABELLED);
         assert(att);
         if (attrType == "label") {
             att->SetLabel(att->StrToStr(attrValue));
@@ -8426,7 +8426,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_LANG)) {
-        AttLang *att = dynamic_cast<AttLang *>(element);
+        AttLang *att = element->GetAttClass<AttLang>(ATT_LANG);
         assert(att);
         if (attrType == "xml:lang") {
             att->SetLang(att->StrToStr(attrValue));
@@ -8438,7 +8438,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_LAYERLOG)) {
-        AttLayerLog *att = dynamic_cast<AttLayerLog *>(element);
+        AttLayerLog *att = element->GetAttClass<AttLayerLog>(ATT_LAYERLOG);
         assert(att);
         if (attrType == "def") {
             att->SetDef(att->StrToStr(attrValue));
@@ -8446,7 +8446,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_LAYERIDENT)) {
-        AttLayerIdent *att = dynamic_cast<AttLayerIdent *>(element);
+        AttLayerIdent *att = element->GetAttClass<AttLayerIdent>(ATT_LAYERIDENT);
         assert(att);
         if (attrType == "layer") {
             att->SetLayer(att->StrToInt(attrValue));
@@ -8454,7 +8454,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_LINELOC)) {
-        AttLineLoc *att = dynamic_cast<AttLineLoc *>(element);
+        AttLineLoc *att = element->GetAttClass<AttLineLoc>(ATT_LINELOC);
         assert(att);
         if (attrType == "line") {
             att->SetLine(att->StrToInt(attrValue));
@@ -8462,7 +8462,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_LINEREND)) {
-        AttLineRend *att = dynamic_cast<AttLineRend *>(element);
+        AttLineRend *att = element->GetAttClass<AttLineRend>(ATT_LINEREND);
         assert(att);
         if (attrType == "lendsym") {
             att->SetLendsym(att->StrToLinestartendsymbol(attrValue));
@@ -8482,7 +8482,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_LINERENDBASE)) {
-        AttLineRendBase *att = dynamic_cast<AttLineRendBase *>(element);
+        AttLineRendBase *att = element->GetAttClass<AttLineRendBase>(ATT_LINERENDBASE);
         assert(att);
         if (attrType == "lform") {
             att->SetLform(att->StrToLineform(attrValue));
@@ -8498,7 +8498,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_LINKING)) {
-        AttLinking *att = dynamic_cast<AttLinking *>(element);
+        AttLinking *att = element->GetAttClass<AttLinking>(ATT_LINKING);
         assert(att);
         if (attrType == "copyof") {
             att->SetCopyof(att->StrToStr(attrValue));
@@ -8534,7 +8534,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_LYRICSTYLE)) {
-        AttLyricStyle *att = dynamic_cast<AttLyricStyle *>(element);
+        AttLyricStyle *att = element->GetAttClass<AttLyricStyle>(ATT_LYRICSTYLE);
         assert(att);
         if (attrType == "lyric.align") {
             att->SetLyricAlign(att->StrToMeasurementrel(attrValue));
@@ -8562,7 +8562,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_MEASURENUMBERS)) {
-        AttMeasureNumbers *att = dynamic_cast<AttMeasureNumbers *>(element);
+        AttMeasureNumbers *att = element->GetAttClass<AttMeasureNumbers>(ATT_MEASURENUMBERS);
         assert(att);
         if (attrType == "mnum.visible") {
             att->SetMnumVisible(att->StrToBoolean(attrValue));
@@ -8570,7 +8570,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_MEASUREMENT)) {
-        AttMeasurement *att = dynamic_cast<AttMeasurement *>(element);
+        AttMeasurement *att = element->GetAttClass<AttMeasurement>(ATT_MEASUREMENT);
         assert(att);
         if (attrType == "unit") {
             att->SetUnit(att->StrToStr(attrValue));
@@ -8578,7 +8578,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_MEDIABOUNDS)) {
-        AttMediaBounds *att = dynamic_cast<AttMediaBounds *>(element);
+        AttMediaBounds *att = element->GetAttClass<AttMediaBounds>(ATT_MEDIABOUNDS);
         assert(att);
         if (attrType == "begin") {
             att->SetBegin(att->StrToStr(attrValue));
@@ -8594,7 +8594,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_MEDIUM)) {
-        AttMedium *att = dynamic_cast<AttMedium *>(element);
+        AttMedium *att = element->GetAttClass<AttMedium>(ATT_MEDIUM);
         assert(att);
         if (attrType == "medium") {
             att->SetMedium(att->StrToStr(attrValue));
@@ -8602,7 +8602,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_MEIVERSION)) {
-        AttMeiVersion *att = dynamic_cast<AttMeiVersion *>(element);
+        AttMeiVersion *att = element->GetAttClass<AttMeiVersion>(ATT_MEIVERSION);
         assert(att);
         if (attrType == "meiversion") {
             att->SetMeiversion(att->StrToMeiVersionMeiversion(attrValue));
@@ -8610,7 +8610,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_METADATAPOINTING)) {
-        AttMetadataPointing *att = dynamic_cast<AttMetadataPointing *>(element);
+        AttMetadataPointing *att = element->GetAttClass<AttMetadataPointing>(ATT_METADATAPOINTING);
         assert(att);
         if (attrType == "decls") {
             att->SetDecls(att->StrToStr(attrValue));
@@ -8618,7 +8618,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_METERCONFORMANCE)) {
-        AttMeterConformance *att = dynamic_cast<AttMeterConformance *>(element);
+        AttMeterConformance *att = element->GetAttClass<AttMeterConformance>(ATT_METERCONFORMANCE);
         assert(att);
         if (attrType == "metcon") {
             att->SetMetcon(att->StrToMeterConformanceMetcon(attrValue));
@@ -8626,7 +8626,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_METERCONFORMANCEBAR)) {
-        AttMeterConformanceBar *att = dynamic_cast<AttMeterConformanceBar *>(element);
+        AttMeterConformanceBar *att = element->GetAttClass<AttMeterConformanceBar>(ATT_METERCONFORMANCEBAR);
         assert(att);
         if (attrType == "metcon") {
             att->SetMetcon(att->StrToBoolean(attrValue));
@@ -8638,7 +8638,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_METERSIGLOG)) {
-        AttMeterSigLog *att = dynamic_cast<AttMeterSigLog *>(element);
+        AttMeterSigLog *att = element->GetAttClass<AttMeterSigLog>(ATT_METERSIGLOG);
         assert(att);
         if (attrType == "count") {
             att->SetCount(att->StrToInt(attrValue));
@@ -8654,7 +8654,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_METERSIGDEFAULTLOG)) {
-        AttMeterSigDefaultLog *att = dynamic_cast<AttMeterSigDefaultLog *>(element);
+        AttMeterSigDefaultLog *att = element->GetAttClass<AttMeterSigDefaultLog>(ATT_METERSIGDEFAULTLOG);
         assert(att);
         if (attrType == "meter.count") {
             att->SetMeterCount(att->StrToInt(attrValue));
@@ -8670,7 +8670,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_MMTEMPO)) {
-        AttMmTempo *att = dynamic_cast<AttMmTempo *>(element);
+        AttMmTempo *att = element->GetAttClass<AttMmTempo>(ATT_MMTEMPO);
         assert(att);
         if (attrType == "mm") {
             att->SetMm(att->StrToInt(attrValue));
@@ -8686,7 +8686,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_MULTINUMMEASURES)) {
-        AttMultinumMeasures *att = dynamic_cast<AttMultinumMeasures *>(element);
+        AttMultinumMeasures *att = element->GetAttClass<AttMultinumMeasures>(ATT_MULTINUMMEASURES);
         assert(att);
         if (attrType == "multi.number") {
             att->SetMultiNumber(att->StrToBoolean(attrValue));
@@ -8694,7 +8694,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_NINTEGER)) {
-        AttNInteger *att = dynamic_cast<AttNInteger *>(element);
+        AttNInteger *att = element->GetAttClass<AttNInteger>(ATT_NINTEGER);
         assert(att);
         if (attrType == "n") {
             att->SetN(att->StrToInt(attrValue));
@@ -8702,7 +8702,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_NNUMBERLIKE)) {
-        AttNNumberLike *att = dynamic_cast<AttNNumberLike *>(element);
+        AttNNumberLike *att = element->GetAttClass<AttNNumberLike>(ATT_NNUMBERLIKE);
         assert(att);
         if (attrType == "n") {
             att->SetN(att->StrToStr(attrValue));
@@ -8710,7 +8710,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_NAME)) {
-        AttName *att = dynamic_cast<AttName *>(element);
+        AttName *att = element->GetAttClass<AttName>(ATT_NAME);
         assert(att);
         if (attrType == "nymref") {
             att->SetNymref(att->StrToStr(attrValue));
@@ -8722,7 +8722,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_NOTATIONSTYLE)) {
-        AttNotationStyle *att = dynamic_cast<AttNotationStyle *>(element);
+        AttNotationStyle *att = element->GetAttClass<AttNotationStyle>(ATT_NOTATIONSTYLE);
         assert(att);
         if (attrType == "music.name") {
             att->SetMusicName(att->StrToStr(attrValue));
@@ -8734,7 +8734,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_NOTEHEADS)) {
-        AttNoteHeads *att = dynamic_cast<AttNoteHeads *>(element);
+        AttNoteHeads *att = element->GetAttClass<AttNoteHeads>(ATT_NOTEHEADS);
         assert(att);
         if (attrType == "head.altsym") {
             att->SetHeadAltsym(att->StrToStr(attrValue));
@@ -8774,7 +8774,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_OCTAVE)) {
-        AttOctave *att = dynamic_cast<AttOctave *>(element);
+        AttOctave *att = element->GetAttClass<AttOctave>(ATT_OCTAVE);
         assert(att);
         if (attrType == "oct") {
             att->SetOct(att->StrToOctave(attrValue));
@@ -8782,7 +8782,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_OCTAVEDEFAULT)) {
-        AttOctaveDefault *att = dynamic_cast<AttOctaveDefault *>(element);
+        AttOctaveDefault *att = element->GetAttClass<AttOctaveDefault>(ATT_OCTAVEDEFAULT);
         assert(att);
         if (attrType == "oct.default") {
             att->SetOctDefault(att->StrToOctave(attrValue));
@@ -8790,7 +8790,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_OCTAVEDISPLACEMENT)) {
-        AttOctaveDisplacement *att = dynamic_cast<AttOctaveDisplacement *>(element);
+        AttOctaveDisplacement *att = element->GetAttClass<AttOctaveDisplacement>(ATT_OCTAVEDISPLACEMENT);
         assert(att);
         if (attrType == "dis") {
             att->SetDis(att->StrToOctaveDis(attrValue));
@@ -8802,7 +8802,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_ONELINESTAFF)) {
-        AttOneLineStaff *att = dynamic_cast<AttOneLineStaff *>(element);
+        AttOneLineStaff *att = element->GetAttClass<AttOneLineStaff>(ATT_ONELINESTAFF);
         assert(att);
         if (attrType == "ontheline") {
             att->SetOntheline(att->StrToBoolean(attrValue));
@@ -8810,7 +8810,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_OPTIMIZATION)) {
-        AttOptimization *att = dynamic_cast<AttOptimization *>(element);
+        AttOptimization *att = element->GetAttClass<AttOptimization>(ATT_OPTIMIZATION);
         assert(att);
         if (attrType == "optimize") {
             att->SetOptimize(att->StrToBoolean(attrValue));
@@ -8818,7 +8818,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_ORIGINLAYERIDENT)) {
-        AttOriginLayerIdent *att = dynamic_cast<AttOriginLayerIdent *>(element);
+        AttOriginLayerIdent *att = element->GetAttClass<AttOriginLayerIdent>(ATT_ORIGINLAYERIDENT);
         assert(att);
         if (attrType == "origin.layer") {
             att->SetOriginLayer(att->StrToStr(attrValue));
@@ -8826,7 +8826,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_ORIGINSTAFFIDENT)) {
-        AttOriginStaffIdent *att = dynamic_cast<AttOriginStaffIdent *>(element);
+        AttOriginStaffIdent *att = element->GetAttClass<AttOriginStaffIdent>(ATT_ORIGINSTAFFIDENT);
         assert(att);
         if (attrType == "origin.staff") {
             att->SetOriginStaff(att->StrToStr(attrValue));
@@ -8834,7 +8834,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_ORIGINSTARTENDID)) {
-        AttOriginStartEndId *att = dynamic_cast<AttOriginStartEndId *>(element);
+        AttOriginStartEndId *att = element->GetAttClass<AttOriginStartEndId>(ATT_ORIGINSTARTENDID);
         assert(att);
         if (attrType == "origin.startid") {
             att->SetOriginStartid(att->StrToStr(attrValue));
@@ -8846,7 +8846,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_ORIGINTIMESTAMPLOGICAL)) {
-        AttOriginTimestampLogical *att = dynamic_cast<AttOriginTimestampLogical *>(element);
+        AttOriginTimestampLogical *att = element->GetAttClass<AttOriginTimestampLogical>(ATT_ORIGINTIMESTAMPLOGICAL);
         assert(att);
         if (attrType == "origin.tstamp") {
             att->SetOriginTstamp(att->StrToMeasurebeat(attrValue));
@@ -8858,7 +8858,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_PAGES)) {
-        AttPages *att = dynamic_cast<AttPages *>(element);
+        AttPages *att = element->GetAttClass<AttPages>(ATT_PAGES);
         assert(att);
         if (attrType == "page.height") {
             att->SetPageHeight(att->StrToMeasurementabs(attrValue));
@@ -8894,7 +8894,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_PARTIDENT)) {
-        AttPartIdent *att = dynamic_cast<AttPartIdent *>(element);
+        AttPartIdent *att = element->GetAttClass<AttPartIdent>(ATT_PARTIDENT);
         assert(att);
         if (attrType == "part") {
             att->SetPart(att->StrToStr(attrValue));
@@ -8906,7 +8906,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_PITCH)) {
-        AttPitch *att = dynamic_cast<AttPitch *>(element);
+        AttPitch *att = element->GetAttClass<AttPitch>(ATT_PITCH);
         assert(att);
         if (attrType == "pname") {
             att->SetPname(att->StrToPitchname(attrValue));
@@ -8914,7 +8914,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_PLACEMENT)) {
-        AttPlacement *att = dynamic_cast<AttPlacement *>(element);
+        AttPlacement *att = element->GetAttClass<AttPlacement>(ATT_PLACEMENT);
         assert(att);
         if (attrType == "place") {
             att->SetPlace(att->StrToStaffrel(attrValue));
@@ -8922,7 +8922,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_PLIST)) {
-        AttPlist *att = dynamic_cast<AttPlist *>(element);
+        AttPlist *att = element->GetAttClass<AttPlist>(ATT_PLIST);
         assert(att);
         if (attrType == "plist") {
             att->SetPlist(att->StrToXsdAnyURIList(attrValue));
@@ -8930,7 +8930,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_POINTING)) {
-        AttPointing *att = dynamic_cast<AttPointing *>(element);
+        AttPointing *att = element->GetAttClass<AttPointing>(ATT_POINTING);
         assert(att);
         if (attrType == "xlink:actuate") {
             att->SetActuate(att->StrToStr(attrValue));
@@ -8954,7 +8954,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_QUANTITY)) {
-        AttQuantity *att = dynamic_cast<AttQuantity *>(element);
+        AttQuantity *att = element->GetAttClass<AttQuantity>(ATT_QUANTITY);
         assert(att);
         if (attrType == "quantity") {
             att->SetQuantity(att->StrToDbl(attrValue));
@@ -8962,7 +8962,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_RANGING)) {
-        AttRanging *att = dynamic_cast<AttRanging *>(element);
+        AttRanging *att = element->GetAttClass<AttRanging>(ATT_RANGING);
         assert(att);
         if (attrType == "atleast") {
             att->SetAtleast(att->StrToDbl(attrValue));
@@ -8986,7 +8986,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_RESPONSIBILITY)) {
-        AttResponsibility *att = dynamic_cast<AttResponsibility *>(element);
+        AttResponsibility *att = element->GetAttClass<AttResponsibility>(ATT_RESPONSIBILITY);
         assert(att);
         if (attrType == "resp") {
             att->SetResp(att->StrToStr(attrValue));
@@ -8994,7 +8994,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_RESTDURATIONLOGICAL)) {
-        AttRestdurationLogical *att = dynamic_cast<AttRestdurationLogical *>(element);
+        AttRestdurationLogical *att = element->GetAttClass<AttRestdurationLogical>(ATT_RESTDURATIONLOGICAL);
         assert(att);
         if (attrType == "dur") {
             att->SetDur(att->StrToDurationrests(attrValue));
@@ -9002,7 +9002,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_SCALABLE)) {
-        AttScalable *att = dynamic_cast<AttScalable *>(element);
+        AttScalable *att = element->GetAttClass<AttScalable>(ATT_SCALABLE);
         assert(att);
         if (attrType == "scale") {
             att->SetScale(att->StrToPercent(attrValue));
@@ -9010,7 +9010,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_SEQUENCE)) {
-        AttSequence *att = dynamic_cast<AttSequence *>(element);
+        AttSequence *att = element->GetAttClass<AttSequence>(ATT_SEQUENCE);
         assert(att);
         if (attrType == "seq") {
             att->SetSeq(att->StrToInt(attrValue));
@@ -9018,7 +9018,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_SLASHCOUNT)) {
-        AttSlashCount *att = dynamic_cast<AttSlashCount *>(element);
+        AttSlashCount *att = element->GetAttClass<AttSlashCount>(ATT_SLASHCOUNT);
         assert(att);
         if (attrType == "slash") {
             att->SetSlash(att->StrToInt(attrValue));
@@ -9026,7 +9026,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_SLURPRESENT)) {
-        AttSlurPresent *att = dynamic_cast<AttSlurPresent *>(element);
+        AttSlurPresent *att = element->GetAttClass<AttSlurPresent>(ATT_SLURPRESENT);
         assert(att);
         if (attrType == "slur") {
             att->SetSlur(att->StrToStr(attrValue));
@@ -9034,7 +9034,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_SOURCE)) {
-        AttSource *att = dynamic_cast<AttSource *>(element);
+        AttSource *att = element->GetAttClass<AttSource>(ATT_SOURCE);
         assert(att);
         if (attrType == "source") {
             att->SetSource(att->StrToStr(attrValue));
@@ -9042,7 +9042,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_SPACING)) {
-        AttSpacing *att = dynamic_cast<AttSpacing *>(element);
+        AttSpacing *att = element->GetAttClass<AttSpacing>(ATT_SPACING);
         assert(att);
         if (attrType == "spacing.packexp") {
             att->SetSpacingPackexp(att->StrToDbl(attrValue));
@@ -9062,7 +9062,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_STAFFLOG)) {
-        AttStaffLog *att = dynamic_cast<AttStaffLog *>(element);
+        AttStaffLog *att = element->GetAttClass<AttStaffLog>(ATT_STAFFLOG);
         assert(att);
         if (attrType == "def") {
             att->SetDef(att->StrToStr(attrValue));
@@ -9070,7 +9070,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_STAFFDEFLOG)) {
-        AttStaffDefLog *att = dynamic_cast<AttStaffDefLog *>(element);
+        AttStaffDefLog *att = element->GetAttClass<AttStaffDefLog>(ATT_STAFFDEFLOG);
         assert(att);
         if (attrType == "lines") {
             att->SetLines(att->StrToInt(attrValue));
@@ -9078,7 +9078,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_STAFFGROUPINGSYM)) {
-        AttStaffGroupingSym *att = dynamic_cast<AttStaffGroupingSym *>(element);
+        AttStaffGroupingSym *att = element->GetAttClass<AttStaffGroupingSym>(ATT_STAFFGROUPINGSYM);
         assert(att);
         if (attrType == "symbol") {
             att->SetSymbol(att->StrToStaffGroupingSymSymbol(attrValue));
@@ -9086,7 +9086,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_STAFFIDENT)) {
-        AttStaffIdent *att = dynamic_cast<AttStaffIdent *>(element);
+        AttStaffIdent *att = element->GetAttClass<AttStaffIdent>(ATT_STAFFIDENT);
         assert(att);
         if (attrType == "staff") {
             att->SetStaff(att->StrToXsdPositiveIntegerList(attrValue));
@@ -9094,7 +9094,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_STAFFITEMS)) {
-        AttStaffItems *att = dynamic_cast<AttStaffItems *>(element);
+        AttStaffItems *att = element->GetAttClass<AttStaffItems>(ATT_STAFFITEMS);
         assert(att);
         if (attrType == "aboveorder") {
             att->SetAboveorder(att->StrToStaffitem(attrValue));
@@ -9110,7 +9110,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_STAFFLOC)) {
-        AttStaffLoc *att = dynamic_cast<AttStaffLoc *>(element);
+        AttStaffLoc *att = element->GetAttClass<AttStaffLoc>(ATT_STAFFLOC);
         assert(att);
         if (attrType == "loc") {
             att->SetLoc(att->StrToInt(attrValue));
@@ -9118,7 +9118,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_STAFFLOCPITCHED)) {
-        AttStaffLocPitched *att = dynamic_cast<AttStaffLocPitched *>(element);
+        AttStaffLocPitched *att = element->GetAttClass<AttStaffLocPitched>(ATT_STAFFLOCPITCHED);
         assert(att);
         if (attrType == "ploc") {
             att->SetPloc(att->StrToPitchname(attrValue));
@@ -9130,7 +9130,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_STARTENDID)) {
-        AttStartEndId *att = dynamic_cast<AttStartEndId *>(element);
+        AttStartEndId *att = element->GetAttClass<AttStartEndId>(ATT_STARTENDID);
         assert(att);
         if (attrType == "endid") {
             att->SetEndid(att->StrToStr(attrValue));
@@ -9138,7 +9138,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_STARTID)) {
-        AttStartId *att = dynamic_cast<AttStartId *>(element);
+        AttStartId *att = element->GetAttClass<AttStartId>(ATT_STARTID);
         assert(att);
         if (attrType == "startid") {
             att->SetStartid(att->StrToStr(attrValue));
@@ -9146,7 +9146,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_STEMS)) {
-        AttStems *att = dynamic_cast<AttStems *>(element);
+        AttStems *att = element->GetAttClass<AttStems>(ATT_STEMS);
         assert(att);
         if (attrType == "stem.dir") {
             att->SetStemDir(att->StrToStemdirection(attrValue));
@@ -9182,7 +9182,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_SYLLOG)) {
-        AttSylLog *att = dynamic_cast<AttSylLog *>(element);
+        AttSylLog *att = element->GetAttClass<AttSylLog>(ATT_SYLLOG);
         assert(att);
         if (attrType == "con") {
             att->SetCon(att->StrToSylLogCon(attrValue));
@@ -9194,7 +9194,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_SYLTEXT)) {
-        AttSylText *att = dynamic_cast<AttSylText *>(element);
+        AttSylText *att = element->GetAttClass<AttSylText>(ATT_SYLTEXT);
         assert(att);
         if (attrType == "syl") {
             att->SetSyl(att->StrToStr(attrValue));
@@ -9202,7 +9202,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_SYSTEMS)) {
-        AttSystems *att = dynamic_cast<AttSystems *>(element);
+        AttSystems *att = element->GetAttClass<AttSystems>(ATT_SYSTEMS);
         assert(att);
         if (attrType == "system.leftline") {
             att->SetSystemLeftline(att->StrToBoolean(attrValue));
@@ -9222,7 +9222,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_TARGETEVAL)) {
-        AttTargetEval *att = dynamic_cast<AttTargetEval *>(element);
+        AttTargetEval *att = element->GetAttClass<AttTargetEval>(ATT_TARGETEVAL);
         assert(att);
         if (attrType == "evaluate") {
             att->SetEvaluate(att->StrToTargetEvalEvaluate(attrValue));
@@ -9230,7 +9230,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_TEMPOLOG)) {
-        AttTempoLog *att = dynamic_cast<AttTempoLog *>(element);
+        AttTempoLog *att = element->GetAttClass<AttTempoLog>(ATT_TEMPOLOG);
         assert(att);
         if (attrType == "func") {
             att->SetFunc(att->StrToTempoLogFunc(attrValue));
@@ -9238,7 +9238,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_TEXTRENDITION)) {
-        AttTextRendition *att = dynamic_cast<AttTextRendition *>(element);
+        AttTextRendition *att = element->GetAttClass<AttTextRendition>(ATT_TEXTRENDITION);
         assert(att);
         if (attrType == "altrend") {
             att->SetAltrend(att->StrToStr(attrValue));
@@ -9250,7 +9250,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_TEXTSTYLE)) {
-        AttTextStyle *att = dynamic_cast<AttTextStyle *>(element);
+        AttTextStyle *att = element->GetAttClass<AttTextStyle>(ATT_TEXTSTYLE);
         assert(att);
         if (attrType == "text.fam") {
             att->SetTextFam(att->StrToStr(attrValue));
@@ -9274,7 +9274,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_TIEPRESENT)) {
-        AttTiePresent *att = dynamic_cast<AttTiePresent *>(element);
+        AttTiePresent *att = element->GetAttClass<AttTiePresent>(ATT_TIEPRESENT);
         assert(att);
         if (attrType == "tie") {
             att->SetTie(att->StrToTie(attrValue));
@@ -9282,7 +9282,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_TIMESTAMPLOGICAL)) {
-        AttTimestampLogical *att = dynamic_cast<AttTimestampLogical *>(element);
+        AttTimestampLogical *att = element->GetAttClass<AttTimestampLogical>(ATT_TIMESTAMPLOGICAL);
         assert(att);
         if (attrType == "tstamp") {
             att->SetTstamp(att->StrToDbl(attrValue));
@@ -9290,7 +9290,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_TIMESTAMP2LOGICAL)) {
-        AttTimestamp2Logical *att = dynamic_cast<AttTimestamp2Logical *>(element);
+        AttTimestamp2Logical *att = element->GetAttClass<AttTimestamp2Logical>(ATT_TIMESTAMP2LOGICAL);
         assert(att);
         if (attrType == "tstamp2") {
             att->SetTstamp2(att->StrToMeasurebeat(attrValue));
@@ -9298,7 +9298,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_TRANSPOSITION)) {
-        AttTransposition *att = dynamic_cast<AttTransposition *>(element);
+        AttTransposition *att = element->GetAttClass<AttTransposition>(ATT_TRANSPOSITION);
         assert(att);
         if (attrType == "trans.diat") {
             att->SetTransDiat(att->StrToDbl(attrValue));
@@ -9310,7 +9310,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_TUPLETPRESENT)) {
-        AttTupletPresent *att = dynamic_cast<AttTupletPresent *>(element);
+        AttTupletPresent *att = element->GetAttClass<AttTupletPresent>(ATT_TUPLETPRESENT);
         assert(att);
         if (attrType == "tuplet") {
             att->SetTuplet(att->StrToStr(attrValue));
@@ -9318,7 +9318,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_TYPED)) {
-        AttTyped *att = dynamic_cast<AttTyped *>(element);
+        AttTyped *att = element->GetAttClass<AttTyped>(ATT_TYPED);
         assert(att);
         if (attrType == "type") {
             att->SetType(att->StrToStr(attrValue));
@@ -9326,7 +9326,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_TYPOGRAPHY)) {
-        AttTypography *att = dynamic_cast<AttTypography *>(element);
+        AttTypography *att = element->GetAttClass<AttTypography>(ATT_TYPOGRAPHY);
         assert(att);
         if (attrType == "fontfam") {
             att->SetFontfam(att->StrToStr(attrValue));
@@ -9350,7 +9350,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_VERTICALALIGN)) {
-        AttVerticalAlign *att = dynamic_cast<AttVerticalAlign *>(element);
+        AttVerticalAlign *att = element->GetAttClass<AttVerticalAlign>(ATT_VERTICALALIGN);
         assert(att);
         if (attrType == "valign") {
             att->SetValign(att->StrToVerticalalignment(attrValue));
@@ -9358,7 +9358,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_VERTICALGROUP)) {
-        AttVerticalGroup *att = dynamic_cast<AttVerticalGroup *>(element);
+        AttVerticalGroup *att = element->GetAttClass<AttVerticalGroup>(ATT_VERTICALGROUP);
         assert(att);
         if (attrType == "vgrp") {
             att->SetVgrp(att->StrToInt(attrValue));
@@ -9366,7 +9366,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_VISIBILITY)) {
-        AttVisibility *att = dynamic_cast<AttVisibility *>(element);
+        AttVisibility *att = element->GetAttClass<AttVisibility>(ATT_VISIBILITY);
         assert(att);
         if (attrType == "visible") {
             att->SetVisible(att->StrToBoolean(attrValue));
@@ -9374,7 +9374,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSETHO)) {
-        AttVisualOffsetHo *att = dynamic_cast<AttVisualOffsetHo *>(element);
+        AttVisualOffsetHo *att = element->GetAttClass<AttVisualOffsetHo>(ATT_VISUALOFFSETHO);
         assert(att);
         if (attrType == "ho") {
             att->SetHo(att->StrToMeasurementrel(attrValue));
@@ -9382,7 +9382,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSETTO)) {
-        AttVisualOffsetTo *att = dynamic_cast<AttVisualOffsetTo *>(element);
+        AttVisualOffsetTo *att = element->GetAttClass<AttVisualOffsetTo>(ATT_VISUALOFFSETTO);
         assert(att);
         if (attrType == "to") {
             att->SetTo(att->StrToDbl(attrValue));
@@ -9390,7 +9390,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSETVO)) {
-        AttVisualOffsetVo *att = dynamic_cast<AttVisualOffsetVo *>(element);
+        AttVisualOffsetVo *att = element->GetAttClass<AttVisualOffsetVo>(ATT_VISUALOFFSETVO);
         assert(att);
         if (attrType == "vo") {
             att->SetVo(att->StrToMeasurementrel(attrValue));
@@ -9398,7 +9398,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSET2HO)) {
-        AttVisualOffset2Ho *att = dynamic_cast<AttVisualOffset2Ho *>(element);
+        AttVisualOffset2Ho *att = element->GetAttClass<AttVisualOffset2Ho>(ATT_VISUALOFFSET2HO);
         assert(att);
         if (attrType == "startho") {
             att->SetStartho(att->StrToMeasurementrel(attrValue));
@@ -9410,7 +9410,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSET2TO)) {
-        AttVisualOffset2To *att = dynamic_cast<AttVisualOffset2To *>(element);
+        AttVisualOffset2To *att = element->GetAttClass<AttVisualOffset2To>(ATT_VISUALOFFSET2TO);
         assert(att);
         if (attrType == "startto") {
             att->SetStartto(att->StrToDbl(attrValue));
@@ -9422,7 +9422,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSET2VO)) {
-        AttVisualOffset2Vo *att = dynamic_cast<AttVisualOffset2Vo *>(element);
+        AttVisualOffset2Vo *att = element->GetAttClass<AttVisualOffset2Vo>(ATT_VISUALOFFSET2VO);
         assert(att);
         if (attrType == "startvo") {
             att->SetStartvo(att->StrToMeasurementrel(attrValue));
@@ -9434,7 +9434,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_VOLTAGROUPINGSYM)) {
-        AttVoltaGroupingSym *att = dynamic_cast<AttVoltaGroupingSym *>(element);
+        AttVoltaGroupingSym *att = element->GetAttClass<AttVoltaGroupingSym>(ATT_VOLTAGROUPINGSYM);
         assert(att);
         if (attrType == "voltasym") {
             att->SetVoltasym(att->StrToVoltaGroupingSymVoltasym(attrValue));
@@ -9442,7 +9442,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_WHITESPACE)) {
-        AttWhitespace *att = dynamic_cast<AttWhitespace *>(element);
+        AttWhitespace *att = element->GetAttClass<AttWhitespace>(ATT_WHITESPACE);
         assert(att);
         if (attrType == "xml:space") {
             att->SetSpace(att->StrToStr(attrValue));
@@ -9450,7 +9450,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_WIDTH)) {
-        AttWidth *att = dynamic_cast<AttWidth *>(element);
+        AttWidth *att = element->GetAttClass<AttWidth>(ATT_WIDTH);
         assert(att);
         if (attrType == "width") {
             att->SetWidth(att->StrToMeasurementabs(attrValue));
@@ -9458,7 +9458,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_XY)) {
-        AttXy *att = dynamic_cast<AttXy *>(element);
+        AttXy *att = element->GetAttClass<AttXy>(ATT_XY);
         assert(att);
         if (attrType == "x") {
             att->SetX(att->StrToDbl(attrValue));
@@ -9470,7 +9470,7 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_XY2)) {
-        AttXy2 *att = dynamic_cast<AttXy2 *>(element);
+        AttXy2 *att = element->GetAttClass<AttXy2>(ATT_XY2);
         assert(att);
         if (attrType == "x2") {
             att->SetX2(att->StrToDbl(attrValue));
@@ -9488,49 +9488,49 @@ bool Att::SetShared(Object *element, const std::string &attrType, const std::str
 void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_ACCIDLOG)) {
-        const AttAccidLog *att = dynamic_cast<const AttAccidLog *>(element);
+        const AttAccidLog *att = element->GetAttClass<AttAccidLog>(ATT_ACCIDLOG);
         assert(att);
         if (att->HasFunc()) {
             attributes->push_back(std::make_pair("func", att->AccidLogFuncToStr(att->GetFunc())));
         }
     }
     if (element->HasAttClass(ATT_ACCIDENTAL)) {
-        const AttAccidental *att = dynamic_cast<const AttAccidental *>(element);
+        const AttAccidental *att = element->GetAttClass<AttAccidental>(ATT_ACCIDENTAL);
         assert(att);
         if (att->HasAccid()) {
             attributes->push_back(std::make_pair("accid", att->AccidentalWrittenToStr(att->GetAccid())));
         }
     }
     if (element->HasAttClass(ATT_ARTICULATION)) {
-        const AttArticulation *att = dynamic_cast<const AttArticulation *>(element);
+        const AttArticulation *att = element->GetAttClass<AttArticulation>(ATT_ARTICULATION);
         assert(att);
         if (att->HasArtic()) {
             attributes->push_back(std::make_pair("artic", att->ArticulationListToStr(att->GetArtic())));
         }
     }
     if (element->HasAttClass(ATT_ATTACCALOG)) {
-        const AttAttaccaLog *att = dynamic_cast<const AttAttaccaLog *>(element);
+        const AttAttaccaLog *att = element->GetAttClass<AttAttaccaLog>(ATT_ATTACCALOG);
         assert(att);
         if (att->HasTarget()) {
             attributes->push_back(std::make_pair("target", att->StrToStr(att->GetTarget())));
         }
     }
     if (element->HasAttClass(ATT_AUDIENCE)) {
-        const AttAudience *att = dynamic_cast<const AttAudience *>(element);
+        const AttAudience *att = element->GetAttClass<AttAudience>(ATT_AUDIENCE);
         assert(att);
         if (att->HasAudience()) {
             attributes->push_back(std::make_pair("audience", att->AudienceAudienceToStr(att->GetAudience())));
         }
     }
     if (element->HasAttClass(ATT_AUGMENTDOTS)) {
-        const AttAugmentDots *att = dynamic_cast<const AttAugmentDots *>(element);
+        const AttAugmentDots *att = element->GetAttClass<AttAugmentDots>(ATT_AUGMENTDOTS);
         assert(att);
         if (att->HasDots()) {
             attributes->push_back(std::make_pair("dots", att->IntToStr(att->GetDots())));
         }
     }
     if (element->HasAttClass(ATT_AUTHORIZED)) {
-        const AttAuthorized *att = dynamic_cast<const AttAuthorized *>(element);
+        const AttAuthorized *att = element->GetAttClass<AttAuthorized>(ATT_AUTHORIZED);
         assert(att);
         if (att->HasAuth()) {
             attributes->push_back(std::make_pair("auth", att->StrToStr(att->GetAuth())));
@@ -9540,14 +9540,14 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_BARLINELOG)) {
-        const AttBarLineLog *att = dynamic_cast<const AttBarLineLog *>(element);
+        const AttBarLineLog *att = element->GetAttClass<AttBarLineLog>(ATT_BARLINELOG);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back(std::make_pair("form", att->BarrenditionToStr(att->GetForm())));
         }
     }
     if (element->HasAttClass(ATT_BARRING)) {
-        const AttBarring *att = dynamic_cast<const AttBarring *>(element);
+        const AttBarring *att = element->GetAttClass<AttBarring>(ATT_BARRING);
         assert(att);
         if (att->HasBarLen()) {
             attributes->push_back(std::make_pair("bar.len", att->DblToStr(att->GetBarLen())));
@@ -9560,56 +9560,56 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_BASIC)) {
-        const AttBasic *att = dynamic_cast<const AttBasic *>(element);
+        const AttBasic *att = element->GetAttClass<AttBasic>(ATT_BASIC);
         assert(att);
         if (att->HasBase()) {
             attributes->push_back(std::make_pair("xml:base", att->StrToStr(att->GetBase())));
         }
     }
     if (element->HasAttClass(ATT_BIBL)) {
-        const AttBibl *att = dynamic_cast<const AttBibl *>(element);
+        const AttBibl *att = element->GetAttClass<AttBibl>(ATT_BIBL);
         assert(att);
         if (att->HasAnalog()) {
             attributes->push_back(std::make_pair("analog", att->StrToStr(att->GetAnalog())));
         }
     }
     if (element->HasAttClass(ATT_CALENDARED)) {
-        const AttCalendared *att = dynamic_cast<const AttCalendared *>(element);
+        const AttCalendared *att = element->GetAttClass<AttCalendared>(ATT_CALENDARED);
         assert(att);
         if (att->HasCalendar()) {
             attributes->push_back(std::make_pair("calendar", att->StrToStr(att->GetCalendar())));
         }
     }
     if (element->HasAttClass(ATT_CANONICAL)) {
-        const AttCanonical *att = dynamic_cast<const AttCanonical *>(element);
+        const AttCanonical *att = element->GetAttClass<AttCanonical>(ATT_CANONICAL);
         assert(att);
         if (att->HasCodedval()) {
             attributes->push_back(std::make_pair("codedval", att->StrToStr(att->GetCodedval())));
         }
     }
     if (element->HasAttClass(ATT_CLASSED)) {
-        const AttClassed *att = dynamic_cast<const AttClassed *>(element);
+        const AttClassed *att = element->GetAttClass<AttClassed>(ATT_CLASSED);
         assert(att);
         if (att->HasClass()) {
             attributes->push_back(std::make_pair("class", att->StrToStr(att->GetClass())));
         }
     }
     if (element->HasAttClass(ATT_CLEFLOG)) {
-        const AttClefLog *att = dynamic_cast<const AttClefLog *>(element);
+        const AttClefLog *att = element->GetAttClass<AttClefLog>(ATT_CLEFLOG);
         assert(att);
         if (att->HasCautionary()) {
             attributes->push_back(std::make_pair("cautionary", att->BooleanToStr(att->GetCautionary())));
         }
     }
     if (element->HasAttClass(ATT_CLEFSHAPE)) {
-        const AttClefShape *att = dynamic_cast<const AttClefShape *>(element);
+        const AttClefShape *att = element->GetAttClass<AttClefShape>(ATT_CLEFSHAPE);
         assert(att);
         if (att->HasShape()) {
             attributes->push_back(std::make_pair("shape", att->ClefshapeToStr(att->GetShape())));
         }
     }
     if (element->HasAttClass(ATT_CLEFFINGLOG)) {
-        const AttCleffingLog *att = dynamic_cast<const AttCleffingLog *>(element);
+        const AttCleffingLog *att = element->GetAttClass<AttCleffingLog>(ATT_CLEFFINGLOG);
         assert(att);
         if (att->HasClefShape()) {
             attributes->push_back(std::make_pair("clef.shape", att->ClefshapeToStr(att->GetClefShape())));
@@ -9625,21 +9625,21 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_COLOR)) {
-        const AttColor *att = dynamic_cast<const AttColor *>(element);
+        const AttColor *att = element->GetAttClass<AttColor>(ATT_COLOR);
         assert(att);
         if (att->HasColor()) {
             attributes->push_back(std::make_pair("color", att->StrToStr(att->GetColor())));
         }
     }
     if (element->HasAttClass(ATT_COLORATION)) {
-        const AttColoration *att = dynamic_cast<const AttColoration *>(element);
+        const AttColoration *att = element->GetAttClass<AttColoration>(ATT_COLORATION);
         assert(att);
         if (att->HasColored()) {
             attributes->push_back(std::make_pair("colored", att->BooleanToStr(att->GetColored())));
         }
     }
     if (element->HasAttClass(ATT_COORDINATED)) {
-        const AttCoordinated *att = dynamic_cast<const AttCoordinated *>(element);
+        const AttCoordinated *att = element->GetAttClass<AttCoordinated>(ATT_COORDINATED);
         assert(att);
         if (att->HasUlx()) {
             attributes->push_back(std::make_pair("ulx", att->IntToStr(att->GetUlx())));
@@ -9658,14 +9658,14 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_CUE)) {
-        const AttCue *att = dynamic_cast<const AttCue *>(element);
+        const AttCue *att = element->GetAttClass<AttCue>(ATT_CUE);
         assert(att);
         if (att->HasCue()) {
             attributes->push_back(std::make_pair("cue", att->BooleanToStr(att->GetCue())));
         }
     }
     if (element->HasAttClass(ATT_CURVATURE)) {
-        const AttCurvature *att = dynamic_cast<const AttCurvature *>(element);
+        const AttCurvature *att = element->GetAttClass<AttCurvature>(ATT_CURVATURE);
         assert(att);
         if (att->HasBezier()) {
             attributes->push_back(std::make_pair("bezier", att->StrToStr(att->GetBezier())));
@@ -9678,7 +9678,7 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_CURVEREND)) {
-        const AttCurveRend *att = dynamic_cast<const AttCurveRend *>(element);
+        const AttCurveRend *att = element->GetAttClass<AttCurveRend>(ATT_CURVEREND);
         assert(att);
         if (att->HasLform()) {
             attributes->push_back(std::make_pair("lform", att->LineformToStr(att->GetLform())));
@@ -9688,21 +9688,21 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_CUSTOSLOG)) {
-        const AttCustosLog *att = dynamic_cast<const AttCustosLog *>(element);
+        const AttCustosLog *att = element->GetAttClass<AttCustosLog>(ATT_CUSTOSLOG);
         assert(att);
         if (att->HasTarget()) {
             attributes->push_back(std::make_pair("target", att->StrToStr(att->GetTarget())));
         }
     }
     if (element->HasAttClass(ATT_DATAPOINTING)) {
-        const AttDataPointing *att = dynamic_cast<const AttDataPointing *>(element);
+        const AttDataPointing *att = element->GetAttClass<AttDataPointing>(ATT_DATAPOINTING);
         assert(att);
         if (att->HasData()) {
             attributes->push_back(std::make_pair("data", att->StrToStr(att->GetData())));
         }
     }
     if (element->HasAttClass(ATT_DATABLE)) {
-        const AttDatable *att = dynamic_cast<const AttDatable *>(element);
+        const AttDatable *att = element->GetAttClass<AttDatable>(ATT_DATABLE);
         assert(att);
         if (att->HasEnddate()) {
             attributes->push_back(std::make_pair("enddate", att->StrToStr(att->GetEnddate())));
@@ -9721,7 +9721,7 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_DISTANCES)) {
-        const AttDistances *att = dynamic_cast<const AttDistances *>(element);
+        const AttDistances *att = element->GetAttClass<AttDistances>(ATT_DISTANCES);
         assert(att);
         if (att->HasDynamDist()) {
             attributes->push_back(std::make_pair("dynam.dist", att->MeasurementrelToStr(att->GetDynamDist())));
@@ -9734,21 +9734,21 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_DOTLOG)) {
-        const AttDotLog *att = dynamic_cast<const AttDotLog *>(element);
+        const AttDotLog *att = element->GetAttClass<AttDotLog>(ATT_DOTLOG);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back(std::make_pair("form", att->DotLogFormToStr(att->GetForm())));
         }
     }
     if (element->HasAttClass(ATT_DURATIONADDITIVE)) {
-        const AttDurationAdditive *att = dynamic_cast<const AttDurationAdditive *>(element);
+        const AttDurationAdditive *att = element->GetAttClass<AttDurationAdditive>(ATT_DURATIONADDITIVE);
         assert(att);
         if (att->HasDur()) {
             attributes->push_back(std::make_pair("dur", att->DurationToStr(att->GetDur())));
         }
     }
     if (element->HasAttClass(ATT_DURATIONDEFAULT)) {
-        const AttDurationDefault *att = dynamic_cast<const AttDurationDefault *>(element);
+        const AttDurationDefault *att = element->GetAttClass<AttDurationDefault>(ATT_DURATIONDEFAULT);
         assert(att);
         if (att->HasDurDefault()) {
             attributes->push_back(std::make_pair("dur.default", att->DurationToStr(att->GetDurDefault())));
@@ -9761,14 +9761,14 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_DURATIONLOGICAL)) {
-        const AttDurationLogical *att = dynamic_cast<const AttDurationLogical *>(element);
+        const AttDurationLogical *att = element->GetAttClass<AttDurationLogical>(ATT_DURATIONLOGICAL);
         assert(att);
         if (att->HasDur()) {
             attributes->push_back(std::make_pair("dur", att->DurationToStr(att->GetDur())));
         }
     }
     if (element->HasAttClass(ATT_DURATIONRATIO)) {
-        const AttDurationRatio *att = dynamic_cast<const AttDurationRatio *>(element);
+        const AttDurationRatio *att = element->GetAttClass<AttDurationRatio>(ATT_DURATIONRATIO);
         assert(att);
         if (att->HasNum()) {
             attributes->push_back(std::make_pair("num", att->IntToStr(att->GetNum())));
@@ -9778,21 +9778,21 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_ENCLOSINGCHARS)) {
-        const AttEnclosingChars *att = dynamic_cast<const AttEnclosingChars *>(element);
+        const AttEnclosingChars *att = element->GetAttClass<AttEnclosingChars>(ATT_ENCLOSINGCHARS);
         assert(att);
         if (att->HasEnclose()) {
             attributes->push_back(std::make_pair("enclose", att->EnclosureToStr(att->GetEnclose())));
         }
     }
     if (element->HasAttClass(ATT_ENDINGS)) {
-        const AttEndings *att = dynamic_cast<const AttEndings *>(element);
+        const AttEndings *att = element->GetAttClass<AttEndings>(ATT_ENDINGS);
         assert(att);
         if (att->HasEndingRend()) {
             attributes->push_back(std::make_pair("ending.rend", att->EndingsEndingrendToStr(att->GetEndingRend())));
         }
     }
     if (element->HasAttClass(ATT_EVIDENCE)) {
-        const AttEvidence *att = dynamic_cast<const AttEvidence *>(element);
+        const AttEvidence *att = element->GetAttClass<AttEvidence>(ATT_EVIDENCE);
         assert(att);
         if (att->HasCert()) {
             attributes->push_back(std::make_pair("cert", att->CertaintyToStr(att->GetCert())));
@@ -9802,98 +9802,98 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_EXTENDER)) {
-        const AttExtender *att = dynamic_cast<const AttExtender *>(element);
+        const AttExtender *att = element->GetAttClass<AttExtender>(ATT_EXTENDER);
         assert(att);
         if (att->HasExtender()) {
             attributes->push_back(std::make_pair("extender", att->BooleanToStr(att->GetExtender())));
         }
     }
     if (element->HasAttClass(ATT_EXTENT)) {
-        const AttExtent *att = dynamic_cast<const AttExtent *>(element);
+        const AttExtent *att = element->GetAttClass<AttExtent>(ATT_EXTENT);
         assert(att);
         if (att->HasExtent()) {
             attributes->push_back(std::make_pair("extent", att->StrToStr(att->GetExtent())));
         }
     }
     if (element->HasAttClass(ATT_FERMATAPRESENT)) {
-        const AttFermataPresent *att = dynamic_cast<const AttFermataPresent *>(element);
+        const AttFermataPresent *att = element->GetAttClass<AttFermataPresent>(ATT_FERMATAPRESENT);
         assert(att);
         if (att->HasFermata()) {
             attributes->push_back(std::make_pair("fermata", att->StaffrelBasicToStr(att->GetFermata())));
         }
     }
     if (element->HasAttClass(ATT_FILING)) {
-        const AttFiling *att = dynamic_cast<const AttFiling *>(element);
+        const AttFiling *att = element->GetAttClass<AttFiling>(ATT_FILING);
         assert(att);
         if (att->HasNonfiling()) {
             attributes->push_back(std::make_pair("nonfiling", att->IntToStr(att->GetNonfiling())));
         }
     }
     if (element->HasAttClass(ATT_GRPSYMLOG)) {
-        const AttGrpSymLog *att = dynamic_cast<const AttGrpSymLog *>(element);
+        const AttGrpSymLog *att = element->GetAttClass<AttGrpSymLog>(ATT_GRPSYMLOG);
         assert(att);
         if (att->HasLevel()) {
             attributes->push_back(std::make_pair("level", att->IntToStr(att->GetLevel())));
         }
     }
     if (element->HasAttClass(ATT_HANDIDENT)) {
-        const AttHandIdent *att = dynamic_cast<const AttHandIdent *>(element);
+        const AttHandIdent *att = element->GetAttClass<AttHandIdent>(ATT_HANDIDENT);
         assert(att);
         if (att->HasHand()) {
             attributes->push_back(std::make_pair("hand", att->StrToStr(att->GetHand())));
         }
     }
     if (element->HasAttClass(ATT_HEIGHT)) {
-        const AttHeight *att = dynamic_cast<const AttHeight *>(element);
+        const AttHeight *att = element->GetAttClass<AttHeight>(ATT_HEIGHT);
         assert(att);
         if (att->HasHeight()) {
             attributes->push_back(std::make_pair("height", att->MeasurementabsToStr(att->GetHeight())));
         }
     }
     if (element->HasAttClass(ATT_HORIZONTALALIGN)) {
-        const AttHorizontalAlign *att = dynamic_cast<const AttHorizontalAlign *>(element);
+        const AttHorizontalAlign *att = element->GetAttClass<AttHorizontalAlign>(ATT_HORIZONTALALIGN);
         assert(att);
         if (att->HasHalign()) {
             attributes->push_back(std::make_pair("halign", att->HorizontalalignmentToStr(att->GetHalign())));
         }
     }
     if (element->HasAttClass(ATT_INTERNETMEDIA)) {
-        const AttInternetMedia *att = dynamic_cast<const AttInternetMedia *>(element);
+        const AttInternetMedia *att = element->GetAttClass<AttInternetMedia>(ATT_INTERNETMEDIA);
         assert(att);
         if (att->HasMimetype()) {
             attributes->push_back(std::make_pair("mimetype", att->StrToStr(att->GetMimetype())));
         }
     }
     if (element->HasAttClass(ATT_JOINED)) {
-        const AttJoined *att = dynamic_cast<const AttJoined *>(element);
+        const AttJoined *att = element->GetAttClass<AttJoined>(ATT_JOINED);
         assert(att);
         if (att->HasJoin()) {
             attributes->push_back(std::make_pair("join", att->StrToStr(att->GetJoin())));
         }
     }
     if (element->HasAttClass(ATT_KEYSIGLOG)) {
-        const AttKeySigLog *att = dynamic_cast<const AttKeySigLog *>(element);
+        const AttKeySigLog *att = element->GetAttClass<AttKeySigLog>(ATT_KEYSIGLOG);
         assert(att);
         if (att->HasSig()) {
             attributes->push_back(std::make_pair("sig", att->KeysignatureToStr(att->GetSig())));
         }
     }
     if (element->HasAttClass(ATT_KEYSIGDEFAULTLOG)) {
-        const AttKeySigDefaultLog *att = dynamic_cast<const AttKeySigDefaultLog *>(element);
+        const AttKeySigDefaultLog *att = element->GetAttClass<AttKeySigDefaultLog>(ATT_KEYSIGDEFAULTLOG);
         assert(att);
         if (att->HasKeySig()) {
             attributes->push_back(std::make_pair("key.sig", att->KeysignatureToStr(att->GetKeySig())));
         }
     }
     if (element->HasAttClass(ATT_LABELLED)) {
-        const AttLabelled *att = dynamic_cast<const AttLabelled *>(element);
+        const AttLabelled *att = element->GetAttClass<AttLabelled>(ATT_LABELLED);
         assert(att);
         if (att->HasLabel()) {
             attributes->push_back(std::make_pair("label", att->StrToStr(att->GetLabel())));
         }
     }
     if (element->HasAttClass(ATT_LANG)) {
-        const AttLang *att = dynamic_cast<const AttLang *>(element);
+        const AttLang *att = element->GetAttClass<AttLang>(ATT_LANG);
         assert(att);
         if (att->HasLang()) {
             attributes->push_back(std::make_pair("xml:lang", att->StrToStr(att->GetLang())));
@@ -9903,28 +9903,28 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_LAYERLOG)) {
-        const AttLayerLog *att = dynamic_cast<const AttLayerLog *>(element);
+        const AttLayerLog *att = element->GetAttClass<AttLayerLog>(ATT_LAYERLOG);
         assert(att);
         if (att->HasDef()) {
             attributes->push_back(std::make_pair("def", att->StrToStr(att->GetDef())));
         }
     }
     if (element->HasAttClass(ATT_LAYERIDENT)) {
-        const AttLayerIdent *att = dynamic_cast<const AttLayerIdent *>(element);
+        const AttLayerIdent *att = element->GetAttClass<AttLayerIdent>(ATT_LAYERIDENT);
         assert(att);
         if (att->HasLayer()) {
             attributes->push_back(std::make_pair("layer", att->IntToStr(att->GetLayer())));
         }
     }
     if (element->HasAttClass(ATT_LINELOC)) {
-        const AttLineLoc *att = dynamic_cast<const AttLineLoc *>(element);
+        const AttLineLoc *att = element->GetAttClass<AttLineLoc>(ATT_LINELOC);
         assert(att);
         if (att->HasLine()) {
             attributes->push_back(std::make_pair("line", att->IntToStr(att->GetLine())));
         }
     }
     if (element->HasAttClass(ATT_LINEREND)) {
-        const AttLineRend *att = dynamic_cast<const AttLineRend *>(element);
+        const AttLineRend *att = element->GetAttClass<AttLineRend>(ATT_LINEREND);
         assert(att);
         if (att->HasLendsym()) {
             attributes->push_back(std::make_pair("lendsym", att->LinestartendsymbolToStr(att->GetLendsym())));
@@ -9940,7 +9940,7 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_LINERENDBASE)) {
-        const AttLineRendBase *att = dynamic_cast<const AttLineRendBase *>(element);
+        const AttLineRendBase *att = element->GetAttClass<AttLineRendBase>(ATT_LINERENDBASE);
         assert(att);
         if (att->HasLform()) {
             attributes->push_back(std::make_pair("lform", att->LineformToStr(att->GetLform())));
@@ -9953,7 +9953,7 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_LINKING)) {
-        const AttLinking *att = dynamic_cast<const AttLinking *>(element);
+        const AttLinking *att = element->GetAttClass<AttLinking>(ATT_LINKING);
         assert(att);
         if (att->HasCopyof()) {
             attributes->push_back(std::make_pair("copyof", att->StrToStr(att->GetCopyof())));
@@ -9981,7 +9981,7 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_LYRICSTYLE)) {
-        const AttLyricStyle *att = dynamic_cast<const AttLyricStyle *>(element);
+        const AttLyricStyle *att = element->GetAttClass<AttLyricStyle>(ATT_LYRICSTYLE);
         assert(att);
         if (att->HasLyricAlign()) {
             attributes->push_back(std::make_pair("lyric.align", att->MeasurementrelToStr(att->GetLyricAlign())));
@@ -10003,21 +10003,21 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_MEASURENUMBERS)) {
-        const AttMeasureNumbers *att = dynamic_cast<const AttMeasureNumbers *>(element);
+        const AttMeasureNumbers *att = element->GetAttClass<AttMeasureNumbers>(ATT_MEASURENUMBERS);
         assert(att);
         if (att->HasMnumVisible()) {
             attributes->push_back(std::make_pair("mnum.visible", att->BooleanToStr(att->GetMnumVisible())));
         }
     }
     if (element->HasAttClass(ATT_MEASUREMENT)) {
-        const AttMeasurement *att = dynamic_cast<const AttMeasurement *>(element);
+        const AttMeasurement *att = element->GetAttClass<AttMeasurement>(ATT_MEASUREMENT);
         assert(att);
         if (att->HasUnit()) {
             attributes->push_back(std::make_pair("unit", att->StrToStr(att->GetUnit())));
         }
     }
     if (element->HasAttClass(ATT_MEDIABOUNDS)) {
-        const AttMediaBounds *att = dynamic_cast<const AttMediaBounds *>(element);
+        const AttMediaBounds *att = element->GetAttClass<AttMediaBounds>(ATT_MEDIABOUNDS);
         assert(att);
         if (att->HasBegin()) {
             attributes->push_back(std::make_pair("begin", att->StrToStr(att->GetBegin())));
@@ -10030,35 +10030,35 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_MEDIUM)) {
-        const AttMedium *att = dynamic_cast<const AttMedium *>(element);
+        const AttMedium *att = element->GetAttClass<AttMedium>(ATT_MEDIUM);
         assert(att);
         if (att->HasMedium()) {
             attributes->push_back(std::make_pair("medium", att->StrToStr(att->GetMedium())));
         }
     }
     if (element->HasAttClass(ATT_MEIVERSION)) {
-        const AttMeiVersion *att = dynamic_cast<const AttMeiVersion *>(element);
+        const AttMeiVersion *att = element->GetAttClass<AttMeiVersion>(ATT_MEIVERSION);
         assert(att);
         if (att->HasMeiversion()) {
             attributes->push_back(std::make_pair("meiversion", att->MeiVersionMeiversionToStr(att->GetMeiversion())));
         }
     }
     if (element->HasAttClass(ATT_METADATAPOINTING)) {
-        const AttMetadataPointing *att = dynamic_cast<const AttMetadataPointing *>(element);
+        const AttMetadataPointing *att = element->GetAttClass<AttMetadataPointing>(ATT_METADATAPOINTING);
         assert(att);
         if (att->HasDecls()) {
             attributes->push_back(std::make_pair("decls", att->StrToStr(att->GetDecls())));
         }
     }
     if (element->HasAttClass(ATT_METERCONFORMANCE)) {
-        const AttMeterConformance *att = dynamic_cast<const AttMeterConformance *>(element);
+        const AttMeterConformance *att = element->GetAttClass<AttMeterConformance>(ATT_METERCONFORMANCE);
         assert(att);
         if (att->HasMetcon()) {
             attributes->push_back(std::make_pair("metcon", att->MeterConformanceMetconToStr(att->GetMetcon())));
         }
     }
     if (element->HasAttClass(ATT_METERCONFORMANCEBAR)) {
-        const AttMeterConformanceBar *att = dynamic_cast<const AttMeterConformanceBar *>(element);
+        const AttMeterConformanceBar *att = element->GetAttClass<AttMeterConformanceBar>(ATT_METERCONFORMANCEBAR);
         assert(att);
         if (att->HasMetcon()) {
             attributes->push_back(std::make_pair("metcon", att->BooleanToStr(att->GetMetcon())));
@@ -10068,7 +10068,7 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_METERSIGLOG)) {
-        const AttMeterSigLog *att = dynamic_cast<const AttMeterSigLog *>(element);
+        const AttMeterSigLog *att = element->GetAttClass<AttMeterSigLog>(ATT_METERSIGLOG);
         assert(att);
         if (att->HasCount()) {
             attributes->push_back(std::make_pair("count", att->IntToStr(att->GetCount())));
@@ -10081,7 +10081,7 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_METERSIGDEFAULTLOG)) {
-        const AttMeterSigDefaultLog *att = dynamic_cast<const AttMeterSigDefaultLog *>(element);
+        const AttMeterSigDefaultLog *att = element->GetAttClass<AttMeterSigDefaultLog>(ATT_METERSIGDEFAULTLOG);
         assert(att);
         if (att->HasMeterCount()) {
             attributes->push_back(std::make_pair("meter.count", att->IntToStr(att->GetMeterCount())));
@@ -10094,7 +10094,7 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_MMTEMPO)) {
-        const AttMmTempo *att = dynamic_cast<const AttMmTempo *>(element);
+        const AttMmTempo *att = element->GetAttClass<AttMmTempo>(ATT_MMTEMPO);
         assert(att);
         if (att->HasMm()) {
             attributes->push_back(std::make_pair("mm", att->IntToStr(att->GetMm())));
@@ -10107,28 +10107,28 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_MULTINUMMEASURES)) {
-        const AttMultinumMeasures *att = dynamic_cast<const AttMultinumMeasures *>(element);
+        const AttMultinumMeasures *att = element->GetAttClass<AttMultinumMeasures>(ATT_MULTINUMMEASURES);
         assert(att);
         if (att->HasMultiNumber()) {
             attributes->push_back(std::make_pair("multi.number", att->BooleanToStr(att->GetMultiNumber())));
         }
     }
     if (element->HasAttClass(ATT_NINTEGER)) {
-        const AttNInteger *att = dynamic_cast<const AttNInteger *>(element);
+        const AttNInteger *att = element->GetAttClass<AttNInteger>(ATT_NINTEGER);
         assert(att);
         if (att->HasN()) {
             attributes->push_back(std::make_pair("n", att->IntToStr(att->GetN())));
         }
     }
     if (element->HasAttClass(ATT_NNUMBERLIKE)) {
-        const AttNNumberLike *att = dynamic_cast<const AttNNumberLike *>(element);
+        const AttNNumberLike *att = element->GetAttClass<AttNNumberLike>(ATT_NNUMBERLIKE);
         assert(att);
         if (att->HasN()) {
             attributes->push_back(std::make_pair("n", att->StrToStr(att->GetN())));
         }
     }
     if (element->HasAttClass(ATT_NAME)) {
-        const AttName *att = dynamic_cast<const AttName *>(element);
+        const AttName *att = element->GetAttClass<AttName>(ATT_NAME);
         assert(att);
         if (att->HasNymref()) {
             attributes->push_back(std::make_pair("nymref", att->StrToStr(att->GetNymref())));
@@ -10138,7 +10138,7 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_NOTATIONSTYLE)) {
-        const AttNotationStyle *att = dynamic_cast<const AttNotationStyle *>(element);
+        const AttNotationStyle *att = element->GetAttClass<AttNotationStyle>(ATT_NOTATIONSTYLE);
         assert(att);
         if (att->HasMusicName()) {
             attributes->push_back(std::make_pair("music.name", att->StrToStr(att->GetMusicName())));
@@ -10148,7 +10148,7 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_NOTEHEADS)) {
-        const AttNoteHeads *att = dynamic_cast<const AttNoteHeads *>(element);
+        const AttNoteHeads *att = element->GetAttClass<AttNoteHeads>(ATT_NOTEHEADS);
         assert(att);
         if (att->HasHeadAltsym()) {
             attributes->push_back(std::make_pair("head.altsym", att->StrToStr(att->GetHeadAltsym())));
@@ -10179,21 +10179,21 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_OCTAVE)) {
-        const AttOctave *att = dynamic_cast<const AttOctave *>(element);
+        const AttOctave *att = element->GetAttClass<AttOctave>(ATT_OCTAVE);
         assert(att);
         if (att->HasOct()) {
             attributes->push_back(std::make_pair("oct", att->OctaveToStr(att->GetOct())));
         }
     }
     if (element->HasAttClass(ATT_OCTAVEDEFAULT)) {
-        const AttOctaveDefault *att = dynamic_cast<const AttOctaveDefault *>(element);
+        const AttOctaveDefault *att = element->GetAttClass<AttOctaveDefault>(ATT_OCTAVEDEFAULT);
         assert(att);
         if (att->HasOctDefault()) {
             attributes->push_back(std::make_pair("oct.default", att->OctaveToStr(att->GetOctDefault())));
         }
     }
     if (element->HasAttClass(ATT_OCTAVEDISPLACEMENT)) {
-        const AttOctaveDisplacement *att = dynamic_cast<const AttOctaveDisplacement *>(element);
+        const AttOctaveDisplacement *att = element->GetAttClass<AttOctaveDisplacement>(ATT_OCTAVEDISPLACEMENT);
         assert(att);
         if (att->HasDis()) {
             attributes->push_back(std::make_pair("dis", att->OctaveDisToStr(att->GetDis())));
@@ -10203,35 +10203,35 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_ONELINESTAFF)) {
-        const AttOneLineStaff *att = dynamic_cast<const AttOneLineStaff *>(element);
+        const AttOneLineStaff *att = element->GetAttClass<AttOneLineStaff>(ATT_ONELINESTAFF);
         assert(att);
         if (att->HasOntheline()) {
             attributes->push_back(std::make_pair("ontheline", att->BooleanToStr(att->GetOntheline())));
         }
     }
     if (element->HasAttClass(ATT_OPTIMIZATION)) {
-        const AttOptimization *att = dynamic_cast<const AttOptimization *>(element);
+        const AttOptimization *att = element->GetAttClass<AttOptimization>(ATT_OPTIMIZATION);
         assert(att);
         if (att->HasOptimize()) {
             attributes->push_back(std::make_pair("optimize", att->BooleanToStr(att->GetOptimize())));
         }
     }
     if (element->HasAttClass(ATT_ORIGINLAYERIDENT)) {
-        const AttOriginLayerIdent *att = dynamic_cast<const AttOriginLayerIdent *>(element);
+        const AttOriginLayerIdent *att = element->GetAttClass<AttOriginLayerIdent>(ATT_ORIGINLAYERIDENT);
         assert(att);
         if (att->HasOriginLayer()) {
             attributes->push_back(std::make_pair("origin.layer", att->StrToStr(att->GetOriginLayer())));
         }
     }
     if (element->HasAttClass(ATT_ORIGINSTAFFIDENT)) {
-        const AttOriginStaffIdent *att = dynamic_cast<const AttOriginStaffIdent *>(element);
+        const AttOriginStaffIdent *att = element->GetAttClass<AttOriginStaffIdent>(ATT_ORIGINSTAFFIDENT);
         assert(att);
         if (att->HasOriginStaff()) {
             attributes->push_back(std::make_pair("origin.staff", att->StrToStr(att->GetOriginStaff())));
         }
     }
     if (element->HasAttClass(ATT_ORIGINSTARTENDID)) {
-        const AttOriginStartEndId *att = dynamic_cast<const AttOriginStartEndId *>(element);
+        const AttOriginStartEndId *att = element->GetAttClass<AttOriginStartEndId>(ATT_ORIGINSTARTENDID);
         assert(att);
         if (att->HasOriginStartid()) {
             attributes->push_back(std::make_pair("origin.startid", att->StrToStr(att->GetOriginStartid())));
@@ -10241,7 +10241,8 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_ORIGINTIMESTAMPLOGICAL)) {
-        const AttOriginTimestampLogical *att = dynamic_cast<const AttOriginTimestampLogical *>(element);
+        const AttOriginTimestampLogical *att
+            = element->GetAttClass<AttOriginTimestampLogical>(ATT_ORIGINTIMESTAMPLOGICAL);
         assert(att);
         if (att->HasOriginTstamp()) {
             attributes->push_back(std::make_pair("origin.tstamp", att->MeasurebeatToStr(att->GetOriginTstamp())));
@@ -10251,7 +10252,7 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_PAGES)) {
-        const AttPages *att = dynamic_cast<const AttPages *>(element);
+        const AttPages *att = element->GetAttClass<AttPages>(ATT_PAGES);
         assert(att);
         if (att->HasPageHeight()) {
             attributes->push_back(std::make_pair("page.height", att->MeasurementabsToStr(att->GetPageHeight())));
@@ -10279,7 +10280,7 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_PARTIDENT)) {
-        const AttPartIdent *att = dynamic_cast<const AttPartIdent *>(element);
+        const AttPartIdent *att = element->GetAttClass<AttPartIdent>(ATT_PARTIDENT);
         assert(att);
         if (att->HasPart()) {
             attributes->push_back(std::make_pair("part", att->StrToStr(att->GetPart())));
@@ -10289,28 +10290,28 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_PITCH)) {
-        const AttPitch *att = dynamic_cast<const AttPitch *>(element);
+        const AttPitch *att = element->GetAttClass<AttPitch>(ATT_PITCH);
         assert(att);
         if (att->HasPname()) {
             attributes->push_back(std::make_pair("pname", att->PitchnameToStr(att->GetPname())));
         }
     }
     if (element->HasAttClass(ATT_PLACEMENT)) {
-        const AttPlacement *att = dynamic_cast<const AttPlacement *>(element);
+        const AttPlacement *att = element->GetAttClass<AttPlacement>(ATT_PLACEMENT);
         assert(att);
         if (att->HasPlace()) {
             attributes->push_back(std::make_pair("place", att->StaffrelToStr(att->GetPlace())));
         }
     }
     if (element->HasAttClass(ATT_PLIST)) {
-        const AttPlist *att = dynamic_cast<const AttPlist *>(element);
+        const AttPlist *att = element->GetAttClass<AttPlist>(ATT_PLIST);
         assert(att);
         if (att->HasPlist()) {
             attributes->push_back(std::make_pair("plist", att->XsdAnyURIListToStr(att->GetPlist())));
         }
     }
     if (element->HasAttClass(ATT_POINTING)) {
-        const AttPointing *att = dynamic_cast<const AttPointing *>(element);
+        const AttPointing *att = element->GetAttClass<AttPointing>(ATT_POINTING);
         assert(att);
         if (att->HasActuate()) {
             attributes->push_back(std::make_pair("xlink:actuate", att->StrToStr(att->GetActuate())));
@@ -10329,14 +10330,14 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_QUANTITY)) {
-        const AttQuantity *att = dynamic_cast<const AttQuantity *>(element);
+        const AttQuantity *att = element->GetAttClass<AttQuantity>(ATT_QUANTITY);
         assert(att);
         if (att->HasQuantity()) {
             attributes->push_back(std::make_pair("quantity", att->DblToStr(att->GetQuantity())));
         }
     }
     if (element->HasAttClass(ATT_RANGING)) {
-        const AttRanging *att = dynamic_cast<const AttRanging *>(element);
+        const AttRanging *att = element->GetAttClass<AttRanging>(ATT_RANGING);
         assert(att);
         if (att->HasAtleast()) {
             attributes->push_back(std::make_pair("atleast", att->DblToStr(att->GetAtleast())));
@@ -10355,56 +10356,56 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_RESPONSIBILITY)) {
-        const AttResponsibility *att = dynamic_cast<const AttResponsibility *>(element);
+        const AttResponsibility *att = element->GetAttClass<AttResponsibility>(ATT_RESPONSIBILITY);
         assert(att);
         if (att->HasResp()) {
             attributes->push_back(std::make_pair("resp", att->StrToStr(att->GetResp())));
         }
     }
     if (element->HasAttClass(ATT_RESTDURATIONLOGICAL)) {
-        const AttRestdurationLogical *att = dynamic_cast<const AttRestdurationLogical *>(element);
+        const AttRestdurationLogical *att = element->GetAttClass<AttRestdurationLogical>(ATT_RESTDURATIONLOGICAL);
         assert(att);
         if (att->HasDur()) {
             attributes->push_back(std::make_pair("dur", att->DurationrestsToStr(att->GetDur())));
         }
     }
     if (element->HasAttClass(ATT_SCALABLE)) {
-        const AttScalable *att = dynamic_cast<const AttScalable *>(element);
+        const AttScalable *att = element->GetAttClass<AttScalable>(ATT_SCALABLE);
         assert(att);
         if (att->HasScale()) {
             attributes->push_back(std::make_pair("scale", att->PercentToStr(att->GetScale())));
         }
     }
     if (element->HasAttClass(ATT_SEQUENCE)) {
-        const AttSequence *att = dynamic_cast<const AttSequence *>(element);
+        const AttSequence *att = element->GetAttClass<AttSequence>(ATT_SEQUENCE);
         assert(att);
         if (att->HasSeq()) {
             attributes->push_back(std::make_pair("seq", att->IntToStr(att->GetSeq())));
         }
     }
     if (element->HasAttClass(ATT_SLASHCOUNT)) {
-        const AttSlashCount *att = dynamic_cast<const AttSlashCount *>(element);
+        const AttSlashCount *att = element->GetAttClass<AttSlashCount>(ATT_SLASHCOUNT);
         assert(att);
         if (att->HasSlash()) {
             attributes->push_back(std::make_pair("slash", att->IntToStr(att->GetSlash())));
         }
     }
     if (element->HasAttClass(ATT_SLURPRESENT)) {
-        const AttSlurPresent *att = dynamic_cast<const AttSlurPresent *>(element);
+        const AttSlurPresent *att = element->GetAttClass<AttSlurPresent>(ATT_SLURPRESENT);
         assert(att);
         if (att->HasSlur()) {
             attributes->push_back(std::make_pair("slur", att->StrToStr(att->GetSlur())));
         }
     }
     if (element->HasAttClass(ATT_SOURCE)) {
-        const AttSource *att = dynamic_cast<const AttSource *>(element);
+        const AttSource *att = element->GetAttClass<AttSource>(ATT_SOURCE);
         assert(att);
         if (att->HasSource()) {
             attributes->push_back(std::make_pair("source", att->StrToStr(att->GetSource())));
         }
     }
     if (element->HasAttClass(ATT_SPACING)) {
-        const AttSpacing *att = dynamic_cast<const AttSpacing *>(element);
+        const AttSpacing *att = element->GetAttClass<AttSpacing>(ATT_SPACING);
         assert(att);
         if (att->HasSpacingPackexp()) {
             attributes->push_back(std::make_pair("spacing.packexp", att->DblToStr(att->GetSpacingPackexp())));
@@ -10420,35 +10421,35 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_STAFFLOG)) {
-        const AttStaffLog *att = dynamic_cast<const AttStaffLog *>(element);
+        const AttStaffLog *att = element->GetAttClass<AttStaffLog>(ATT_STAFFLOG);
         assert(att);
         if (att->HasDef()) {
             attributes->push_back(std::make_pair("def", att->StrToStr(att->GetDef())));
         }
     }
     if (element->HasAttClass(ATT_STAFFDEFLOG)) {
-        const AttStaffDefLog *att = dynamic_cast<const AttStaffDefLog *>(element);
+        const AttStaffDefLog *att = element->GetAttClass<AttStaffDefLog>(ATT_STAFFDEFLOG);
         assert(att);
         if (att->HasLines()) {
             attributes->push_back(std::make_pair("lines", att->IntToStr(att->GetLines())));
         }
     }
     if (element->HasAttClass(ATT_STAFFGROUPINGSYM)) {
-        const AttStaffGroupingSym *att = dynamic_cast<const AttStaffGroupingSym *>(element);
+        const AttStaffGroupingSym *att = element->GetAttClass<AttStaffGroupingSym>(ATT_STAFFGROUPINGSYM);
         assert(att);
         if (att->HasSymbol()) {
             attributes->push_back(std::make_pair("symbol", att->StaffGroupingSymSymbolToStr(att->GetSymbol())));
         }
     }
     if (element->HasAttClass(ATT_STAFFIDENT)) {
-        const AttStaffIdent *att = dynamic_cast<const AttStaffIdent *>(element);
+        const AttStaffIdent *att = element->GetAttClass<AttStaffIdent>(ATT_STAFFIDENT);
         assert(att);
         if (att->HasStaff()) {
             attributes->push_back(std::make_pair("staff", att->XsdPositiveIntegerListToStr(att->GetStaff())));
         }
     }
     if (element->HasAttClass(ATT_STAFFITEMS)) {
-        const AttStaffItems *att = dynamic_cast<const AttStaffItems *>(element);
+        const AttStaffItems *att = element->GetAttClass<AttStaffItems>(ATT_STAFFITEMS);
         assert(att);
         if (att->HasAboveorder()) {
             attributes->push_back(std::make_pair("aboveorder", att->StaffitemToStr(att->GetAboveorder())));
@@ -10461,14 +10462,14 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_STAFFLOC)) {
-        const AttStaffLoc *att = dynamic_cast<const AttStaffLoc *>(element);
+        const AttStaffLoc *att = element->GetAttClass<AttStaffLoc>(ATT_STAFFLOC);
         assert(att);
         if (att->HasLoc()) {
             attributes->push_back(std::make_pair("loc", att->IntToStr(att->GetLoc())));
         }
     }
     if (element->HasAttClass(ATT_STAFFLOCPITCHED)) {
-        const AttStaffLocPitched *att = dynamic_cast<const AttStaffLocPitched *>(element);
+        const AttStaffLocPitched *att = element->GetAttClass<AttStaffLocPitched>(ATT_STAFFLOCPITCHED);
         assert(att);
         if (att->HasPloc()) {
             attributes->push_back(std::make_pair("ploc", att->PitchnameToStr(att->GetPloc())));
@@ -10478,21 +10479,21 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_STARTENDID)) {
-        const AttStartEndId *att = dynamic_cast<const AttStartEndId *>(element);
+        const AttStartEndId *att = element->GetAttClass<AttStartEndId>(ATT_STARTENDID);
         assert(att);
         if (att->HasEndid()) {
             attributes->push_back(std::make_pair("endid", att->StrToStr(att->GetEndid())));
         }
     }
     if (element->HasAttClass(ATT_STARTID)) {
-        const AttStartId *att = dynamic_cast<const AttStartId *>(element);
+        const AttStartId *att = element->GetAttClass<AttStartId>(ATT_STARTID);
         assert(att);
         if (att->HasStartid()) {
             attributes->push_back(std::make_pair("startid", att->StrToStr(att->GetStartid())));
         }
     }
     if (element->HasAttClass(ATT_STEMS)) {
-        const AttStems *att = dynamic_cast<const AttStems *>(element);
+        const AttStems *att = element->GetAttClass<AttStems>(ATT_STEMS);
         assert(att);
         if (att->HasStemDir()) {
             attributes->push_back(std::make_pair("stem.dir", att->StemdirectionToStr(att->GetStemDir())));
@@ -10520,7 +10521,7 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_SYLLOG)) {
-        const AttSylLog *att = dynamic_cast<const AttSylLog *>(element);
+        const AttSylLog *att = element->GetAttClass<AttSylLog>(ATT_SYLLOG);
         assert(att);
         if (att->HasCon()) {
             attributes->push_back(std::make_pair("con", att->SylLogConToStr(att->GetCon())));
@@ -10530,14 +10531,14 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_SYLTEXT)) {
-        const AttSylText *att = dynamic_cast<const AttSylText *>(element);
+        const AttSylText *att = element->GetAttClass<AttSylText>(ATT_SYLTEXT);
         assert(att);
         if (att->HasSyl()) {
             attributes->push_back(std::make_pair("syl", att->StrToStr(att->GetSyl())));
         }
     }
     if (element->HasAttClass(ATT_SYSTEMS)) {
-        const AttSystems *att = dynamic_cast<const AttSystems *>(element);
+        const AttSystems *att = element->GetAttClass<AttSystems>(ATT_SYSTEMS);
         assert(att);
         if (att->HasSystemLeftline()) {
             attributes->push_back(std::make_pair("system.leftline", att->BooleanToStr(att->GetSystemLeftline())));
@@ -10553,21 +10554,21 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_TARGETEVAL)) {
-        const AttTargetEval *att = dynamic_cast<const AttTargetEval *>(element);
+        const AttTargetEval *att = element->GetAttClass<AttTargetEval>(ATT_TARGETEVAL);
         assert(att);
         if (att->HasEvaluate()) {
             attributes->push_back(std::make_pair("evaluate", att->TargetEvalEvaluateToStr(att->GetEvaluate())));
         }
     }
     if (element->HasAttClass(ATT_TEMPOLOG)) {
-        const AttTempoLog *att = dynamic_cast<const AttTempoLog *>(element);
+        const AttTempoLog *att = element->GetAttClass<AttTempoLog>(ATT_TEMPOLOG);
         assert(att);
         if (att->HasFunc()) {
             attributes->push_back(std::make_pair("func", att->TempoLogFuncToStr(att->GetFunc())));
         }
     }
     if (element->HasAttClass(ATT_TEXTRENDITION)) {
-        const AttTextRendition *att = dynamic_cast<const AttTextRendition *>(element);
+        const AttTextRendition *att = element->GetAttClass<AttTextRendition>(ATT_TEXTRENDITION);
         assert(att);
         if (att->HasAltrend()) {
             attributes->push_back(std::make_pair("altrend", att->StrToStr(att->GetAltrend())));
@@ -10577,7 +10578,7 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_TEXTSTYLE)) {
-        const AttTextStyle *att = dynamic_cast<const AttTextStyle *>(element);
+        const AttTextStyle *att = element->GetAttClass<AttTextStyle>(ATT_TEXTSTYLE);
         assert(att);
         if (att->HasTextFam()) {
             attributes->push_back(std::make_pair("text.fam", att->StrToStr(att->GetTextFam())));
@@ -10596,28 +10597,28 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_TIEPRESENT)) {
-        const AttTiePresent *att = dynamic_cast<const AttTiePresent *>(element);
+        const AttTiePresent *att = element->GetAttClass<AttTiePresent>(ATT_TIEPRESENT);
         assert(att);
         if (att->HasTie()) {
             attributes->push_back(std::make_pair("tie", att->TieToStr(att->GetTie())));
         }
     }
     if (element->HasAttClass(ATT_TIMESTAMPLOGICAL)) {
-        const AttTimestampLogical *att = dynamic_cast<const AttTimestampLogical *>(element);
+        const AttTimestampLogical *att = element->GetAttClass<AttTimestampLogical>(ATT_TIMESTAMPLOGICAL);
         assert(att);
         if (att->HasTstamp()) {
             attributes->push_back(std::make_pair("tstamp", att->DblToStr(att->GetTstamp())));
         }
     }
     if (element->HasAttClass(ATT_TIMESTAMP2LOGICAL)) {
-        const AttTimestamp2Logical *att = dynamic_cast<const AttTimestamp2Logical *>(element);
+        const AttTimestamp2Logical *att = element->GetAttClass<AttTimestamp2Logical>(ATT_TIMESTAMP2LOGICAL);
         assert(att);
         if (att->HasTstamp2()) {
             attributes->push_back(std::make_pair("tstamp2", att->MeasurebeatToStr(att->GetTstamp2())));
         }
     }
     if (element->HasAttClass(ATT_TRANSPOSITION)) {
-        const AttTransposition *att = dynamic_cast<const AttTransposition *>(element);
+        const AttTransposition *att = element->GetAttClass<AttTransposition>(ATT_TRANSPOSITION);
         assert(att);
         if (att->HasTransDiat()) {
             attributes->push_back(std::make_pair("trans.diat", att->DblToStr(att->GetTransDiat())));
@@ -10627,21 +10628,21 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_TUPLETPRESENT)) {
-        const AttTupletPresent *att = dynamic_cast<const AttTupletPresent *>(element);
+        const AttTupletPresent *att = element->GetAttClass<AttTupletPresent>(ATT_TUPLETPRESENT);
         assert(att);
         if (att->HasTuplet()) {
             attributes->push_back(std::make_pair("tuplet", att->StrToStr(att->GetTuplet())));
         }
     }
     if (element->HasAttClass(ATT_TYPED)) {
-        const AttTyped *att = dynamic_cast<const AttTyped *>(element);
+        const AttTyped *att = element->GetAttClass<AttTyped>(ATT_TYPED);
         assert(att);
         if (att->HasType()) {
             attributes->push_back(std::make_pair("type", att->StrToStr(att->GetType())));
         }
     }
     if (element->HasAttClass(ATT_TYPOGRAPHY)) {
-        const AttTypography *att = dynamic_cast<const AttTypography *>(element);
+        const AttTypography *att = element->GetAttClass<AttTypography>(ATT_TYPOGRAPHY);
         assert(att);
         if (att->HasFontfam()) {
             attributes->push_back(std::make_pair("fontfam", att->StrToStr(att->GetFontfam())));
@@ -10660,49 +10661,49 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_VERTICALALIGN)) {
-        const AttVerticalAlign *att = dynamic_cast<const AttVerticalAlign *>(element);
+        const AttVerticalAlign *att = element->GetAttClass<AttVerticalAlign>(ATT_VERTICALALIGN);
         assert(att);
         if (att->HasValign()) {
             attributes->push_back(std::make_pair("valign", att->VerticalalignmentToStr(att->GetValign())));
         }
     }
     if (element->HasAttClass(ATT_VERTICALGROUP)) {
-        const AttVerticalGroup *att = dynamic_cast<const AttVerticalGroup *>(element);
+        const AttVerticalGroup *att = element->GetAttClass<AttVerticalGroup>(ATT_VERTICALGROUP);
         assert(att);
         if (att->HasVgrp()) {
             attributes->push_back(std::make_pair("vgrp", att->IntToStr(att->GetVgrp())));
         }
     }
     if (element->HasAttClass(ATT_VISIBILITY)) {
-        const AttVisibility *att = dynamic_cast<const AttVisibility *>(element);
+        const AttVisibility *att = element->GetAttClass<AttVisibility>(ATT_VISIBILITY);
         assert(att);
         if (att->HasVisible()) {
             attributes->push_back(std::make_pair("visible", att->BooleanToStr(att->GetVisible())));
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSETHO)) {
-        const AttVisualOffsetHo *att = dynamic_cast<const AttVisualOffsetHo *>(element);
+        const AttVisualOffsetHo *att = element->GetAttClass<AttVisualOffsetHo>(ATT_VISUALOFFSETHO);
         assert(att);
         if (att->HasHo()) {
             attributes->push_back(std::make_pair("ho", att->MeasurementrelToStr(att->GetHo())));
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSETTO)) {
-        const AttVisualOffsetTo *att = dynamic_cast<const AttVisualOffsetTo *>(element);
+        const AttVisualOffsetTo *att = element->GetAttClass<AttVisualOffsetTo>(ATT_VISUALOFFSETTO);
         assert(att);
         if (att->HasTo()) {
             attributes->push_back(std::make_pair("to", att->DblToStr(att->GetTo())));
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSETVO)) {
-        const AttVisualOffsetVo *att = dynamic_cast<const AttVisualOffsetVo *>(element);
+        const AttVisualOffsetVo *att = element->GetAttClass<AttVisualOffsetVo>(ATT_VISUALOFFSETVO);
         assert(att);
         if (att->HasVo()) {
             attributes->push_back(std::make_pair("vo", att->MeasurementrelToStr(att->GetVo())));
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSET2HO)) {
-        const AttVisualOffset2Ho *att = dynamic_cast<const AttVisualOffset2Ho *>(element);
+        const AttVisualOffset2Ho *att = element->GetAttClass<AttVisualOffset2Ho>(ATT_VISUALOFFSET2HO);
         assert(att);
         if (att->HasStartho()) {
             attributes->push_back(std::make_pair("startho", att->MeasurementrelToStr(att->GetStartho())));
@@ -10712,7 +10713,7 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSET2TO)) {
-        const AttVisualOffset2To *att = dynamic_cast<const AttVisualOffset2To *>(element);
+        const AttVisualOffset2To *att = element->GetAttClass<AttVisualOffset2To>(ATT_VISUALOFFSET2TO);
         assert(att);
         if (att->HasStartto()) {
             attributes->push_back(std::make_pair("startto", att->DblToStr(att->GetStartto())));
@@ -10722,7 +10723,7 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSET2VO)) {
-        const AttVisualOffset2Vo *att = dynamic_cast<const AttVisualOffset2Vo *>(element);
+        const AttVisualOffset2Vo *att = element->GetAttClass<AttVisualOffset2Vo>(ATT_VISUALOFFSET2VO);
         assert(att);
         if (att->HasStartvo()) {
             attributes->push_back(std::make_pair("startvo", att->MeasurementrelToStr(att->GetStartvo())));
@@ -10732,28 +10733,28 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_VOLTAGROUPINGSYM)) {
-        const AttVoltaGroupingSym *att = dynamic_cast<const AttVoltaGroupingSym *>(element);
+        const AttVoltaGroupingSym *att = element->GetAttClass<AttVoltaGroupingSym>(ATT_VOLTAGROUPINGSYM);
         assert(att);
         if (att->HasVoltasym()) {
             attributes->push_back(std::make_pair("voltasym", att->VoltaGroupingSymVoltasymToStr(att->GetVoltasym())));
         }
     }
     if (element->HasAttClass(ATT_WHITESPACE)) {
-        const AttWhitespace *att = dynamic_cast<const AttWhitespace *>(element);
+        const AttWhitespace *att = element->GetAttClass<AttWhitespace>(ATT_WHITESPACE);
         assert(att);
         if (att->HasSpace()) {
             attributes->push_back(std::make_pair("xml:space", att->StrToStr(att->GetSpace())));
         }
     }
     if (element->HasAttClass(ATT_WIDTH)) {
-        const AttWidth *att = dynamic_cast<const AttWidth *>(element);
+        const AttWidth *att = element->GetAttClass<AttWidth>(ATT_WIDTH);
         assert(att);
         if (att->HasWidth()) {
             attributes->push_back(std::make_pair("width", att->MeasurementabsToStr(att->GetWidth())));
         }
     }
     if (element->HasAttClass(ATT_XY)) {
-        const AttXy *att = dynamic_cast<const AttXy *>(element);
+        const AttXy *att = element->GetAttClass<AttXy>(ATT_XY);
         assert(att);
         if (att->HasX()) {
             attributes->push_back(std::make_pair("x", att->DblToStr(att->GetX())));
@@ -10763,7 +10764,7 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_XY2)) {
-        const AttXy2 *att = dynamic_cast<const AttXy2 *>(element);
+        const AttXy2 *att = element->GetAttClass<AttXy2>(ATT_XY2);
         assert(att);
         if (att->HasX2()) {
             attributes->push_back(std::make_pair("x2", att->DblToStr(att->GetX2())));
@@ -10774,4 +10775,147 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::GetSharedOffsets(const Object *element, std::vector<int> *offsets)
+{
+    offsets->at(ATT_ACCIDLOG) = Att::GetOffset(element, dynamic_cast<const AttAccidLog *>(element));
+    offsets->at(ATT_ACCIDENTAL) = Att::GetOffset(element, dynamic_cast<const AttAccidental *>(element));
+    offsets->at(ATT_ARTICULATION) = Att::GetOffset(element, dynamic_cast<const AttArticulation *>(element));
+    offsets->at(ATT_ATTACCALOG) = Att::GetOffset(element, dynamic_cast<const AttAttaccaLog *>(element));
+    offsets->at(ATT_AUDIENCE) = Att::GetOffset(element, dynamic_cast<const AttAudience *>(element));
+    offsets->at(ATT_AUGMENTDOTS) = Att::GetOffset(element, dynamic_cast<const AttAugmentDots *>(element));
+    offsets->at(ATT_AUTHORIZED) = Att::GetOffset(element, dynamic_cast<const AttAuthorized *>(element));
+    offsets->at(ATT_BARLINELOG) = Att::GetOffset(element, dynamic_cast<const AttBarLineLog *>(element));
+    offsets->at(ATT_BARRING) = Att::GetOffset(element, dynamic_cast<const AttBarring *>(element));
+    offsets->at(ATT_BASIC) = Att::GetOffset(element, dynamic_cast<const AttBasic *>(element));
+    offsets->at(ATT_BIBL) = Att::GetOffset(element, dynamic_cast<const AttBibl *>(element));
+    offsets->at(ATT_CALENDARED) = Att::GetOffset(element, dynamic_cast<const AttCalendared *>(element));
+    offsets->at(ATT_CANONICAL) = Att::GetOffset(element, dynamic_cast<const AttCanonical *>(element));
+    offsets->at(ATT_CLASSED) = Att::GetOffset(element, dynamic_cast<const AttClassed *>(element));
+    offsets->at(ATT_CLEFLOG) = Att::GetOffset(element, dynamic_cast<const AttClefLog *>(element));
+    offsets->at(ATT_CLEFSHAPE) = Att::GetOffset(element, dynamic_cast<const AttClefShape *>(element));
+    offsets->at(ATT_CLEFFINGLOG) = Att::GetOffset(element, dynamic_cast<const AttCleffingLog *>(element));
+    offsets->at(ATT_COLOR) = Att::GetOffset(element, dynamic_cast<const AttColor *>(element));
+    offsets->at(ATT_COLORATION) = Att::GetOffset(element, dynamic_cast<const AttColoration *>(element));
+    offsets->at(ATT_COORDINATED) = Att::GetOffset(element, dynamic_cast<const AttCoordinated *>(element));
+    offsets->at(ATT_CUE) = Att::GetOffset(element, dynamic_cast<const AttCue *>(element));
+    offsets->at(ATT_CURVATURE) = Att::GetOffset(element, dynamic_cast<const AttCurvature *>(element));
+    offsets->at(ATT_CURVEREND) = Att::GetOffset(element, dynamic_cast<const AttCurveRend *>(element));
+    offsets->at(ATT_CUSTOSLOG) = Att::GetOffset(element, dynamic_cast<const AttCustosLog *>(element));
+    offsets->at(ATT_DATAPOINTING) = Att::GetOffset(element, dynamic_cast<const AttDataPointing *>(element));
+    offsets->at(ATT_DATABLE) = Att::GetOffset(element, dynamic_cast<const AttDatable *>(element));
+    offsets->at(ATT_DISTANCES) = Att::GetOffset(element, dynamic_cast<const AttDistances *>(element));
+    offsets->at(ATT_DOTLOG) = Att::GetOffset(element, dynamic_cast<const AttDotLog *>(element));
+    offsets->at(ATT_DURATIONADDITIVE) = Att::GetOffset(element, dynamic_cast<const AttDurationAdditive *>(element));
+    offsets->at(ATT_DURATIONDEFAULT) = Att::GetOffset(element, dynamic_cast<const AttDurationDefault *>(element));
+    offsets->at(ATT_DURATIONLOGICAL) = Att::GetOffset(element, dynamic_cast<const AttDurationLogical *>(element));
+    offsets->at(ATT_DURATIONRATIO) = Att::GetOffset(element, dynamic_cast<const AttDurationRatio *>(element));
+    offsets->at(ATT_ENCLOSINGCHARS) = Att::GetOffset(element, dynamic_cast<const AttEnclosingChars *>(element));
+    offsets->at(ATT_ENDINGS) = Att::GetOffset(element, dynamic_cast<const AttEndings *>(element));
+    offsets->at(ATT_EVIDENCE) = Att::GetOffset(element, dynamic_cast<const AttEvidence *>(element));
+    offsets->at(ATT_EXTENDER) = Att::GetOffset(element, dynamic_cast<const AttExtender *>(element));
+    offsets->at(ATT_EXTENT) = Att::GetOffset(element, dynamic_cast<const AttExtent *>(element));
+    offsets->at(ATT_FERMATAPRESENT) = Att::GetOffset(element, dynamic_cast<const AttFermataPresent *>(element));
+    offsets->at(ATT_FILING) = Att::GetOffset(element, dynamic_cast<const AttFiling *>(element));
+    offsets->at(ATT_GRPSYMLOG) = Att::GetOffset(element, dynamic_cast<const AttGrpSymLog *>(element));
+    offsets->at(ATT_HANDIDENT) = Att::GetOffset(element, dynamic_cast<const AttHandIdent *>(element));
+    offsets->at(ATT_HEIGHT) = Att::GetOffset(element, dynamic_cast<const AttHeight *>(element));
+    offsets->at(ATT_HORIZONTALALIGN) = Att::GetOffset(element, dynamic_cast<const AttHorizontalAlign *>(element));
+    offsets->at(ATT_INTERNETMEDIA) = Att::GetOffset(element, dynamic_cast<const AttInternetMedia *>(element));
+    offsets->at(ATT_JOINED) = Att::GetOffset(element, dynamic_cast<const AttJoined *>(element));
+    offsets->at(ATT_KEYSIGLOG) = Att::GetOffset(element, dynamic_cast<const AttKeySigLog *>(element));
+    offsets->at(ATT_KEYSIGDEFAULTLOG) = Att::GetOffset(element, dynamic_cast<const AttKeySigDefaultLog *>(element));
+    offsets->at(ATT_LABELLED) = Att::GetOffset(element, dynamic_cast<const AttLabelled *>(element));
+    offsets->at(ATT_LANG) = Att::GetOffset(element, dynamic_cast<const AttLang *>(element));
+    offsets->at(ATT_LAYERLOG) = Att::GetOffset(element, dynamic_cast<const AttLayerLog *>(element));
+    offsets->at(ATT_LAYERIDENT) = Att::GetOffset(element, dynamic_cast<const AttLayerIdent *>(element));
+    offsets->at(ATT_LINELOC) = Att::GetOffset(element, dynamic_cast<const AttLineLoc *>(element));
+    offsets->at(ATT_LINEREND) = Att::GetOffset(element, dynamic_cast<const AttLineRend *>(element));
+    offsets->at(ATT_LINERENDBASE) = Att::GetOffset(element, dynamic_cast<const AttLineRendBase *>(element));
+    offsets->at(ATT_LINKING) = Att::GetOffset(element, dynamic_cast<const AttLinking *>(element));
+    offsets->at(ATT_LYRICSTYLE) = Att::GetOffset(element, dynamic_cast<const AttLyricStyle *>(element));
+    offsets->at(ATT_MEASURENUMBERS) = Att::GetOffset(element, dynamic_cast<const AttMeasureNumbers *>(element));
+    offsets->at(ATT_MEASUREMENT) = Att::GetOffset(element, dynamic_cast<const AttMeasurement *>(element));
+    offsets->at(ATT_MEDIABOUNDS) = Att::GetOffset(element, dynamic_cast<const AttMediaBounds *>(element));
+    offsets->at(ATT_MEDIUM) = Att::GetOffset(element, dynamic_cast<const AttMedium *>(element));
+    offsets->at(ATT_MEIVERSION) = Att::GetOffset(element, dynamic_cast<const AttMeiVersion *>(element));
+    offsets->at(ATT_METADATAPOINTING) = Att::GetOffset(element, dynamic_cast<const AttMetadataPointing *>(element));
+    offsets->at(ATT_METERCONFORMANCE) = Att::GetOffset(element, dynamic_cast<const AttMeterConformance *>(element));
+    offsets->at(ATT_METERCONFORMANCEBAR)
+        = Att::GetOffset(element, dynamic_cast<const AttMeterConformanceBar *>(element));
+    offsets->at(ATT_METERSIGLOG) = Att::GetOffset(element, dynamic_cast<const AttMeterSigLog *>(element));
+    offsets->at(ATT_METERSIGDEFAULTLOG) = Att::GetOffset(element, dynamic_cast<const AttMeterSigDefaultLog *>(element));
+    offsets->at(ATT_MMTEMPO) = Att::GetOffset(element, dynamic_cast<const AttMmTempo *>(element));
+    offsets->at(ATT_MULTINUMMEASURES) = Att::GetOffset(element, dynamic_cast<const AttMultinumMeasures *>(element));
+    offsets->at(ATT_NINTEGER) = Att::GetOffset(element, dynamic_cast<const AttNInteger *>(element));
+    offsets->at(ATT_NNUMBERLIKE) = Att::GetOffset(element, dynamic_cast<const AttNNumberLike *>(element));
+    offsets->at(ATT_NAME) = Att::GetOffset(element, dynamic_cast<const AttName *>(element));
+    offsets->at(ATT_NOTATIONSTYLE) = Att::GetOffset(element, dynamic_cast<const AttNotationStyle *>(element));
+    offsets->at(ATT_NOTEHEADS) = Att::GetOffset(element, dynamic_cast<const AttNoteHeads *>(element));
+    offsets->at(ATT_OCTAVE) = Att::GetOffset(element, dynamic_cast<const AttOctave *>(element));
+    offsets->at(ATT_OCTAVEDEFAULT) = Att::GetOffset(element, dynamic_cast<const AttOctaveDefault *>(element));
+    offsets->at(ATT_OCTAVEDISPLACEMENT) = Att::GetOffset(element, dynamic_cast<const AttOctaveDisplacement *>(element));
+    offsets->at(ATT_ONELINESTAFF) = Att::GetOffset(element, dynamic_cast<const AttOneLineStaff *>(element));
+    offsets->at(ATT_OPTIMIZATION) = Att::GetOffset(element, dynamic_cast<const AttOptimization *>(element));
+    offsets->at(ATT_ORIGINLAYERIDENT) = Att::GetOffset(element, dynamic_cast<const AttOriginLayerIdent *>(element));
+    offsets->at(ATT_ORIGINSTAFFIDENT) = Att::GetOffset(element, dynamic_cast<const AttOriginStaffIdent *>(element));
+    offsets->at(ATT_ORIGINSTARTENDID) = Att::GetOffset(element, dynamic_cast<const AttOriginStartEndId *>(element));
+    offsets->at(ATT_ORIGINTIMESTAMPLOGICAL)
+        = Att::GetOffset(element, dynamic_cast<const AttOriginTimestampLogical *>(element));
+    offsets->at(ATT_PAGES) = Att::GetOffset(element, dynamic_cast<const AttPages *>(element));
+    offsets->at(ATT_PARTIDENT) = Att::GetOffset(element, dynamic_cast<const AttPartIdent *>(element));
+    offsets->at(ATT_PITCH) = Att::GetOffset(element, dynamic_cast<const AttPitch *>(element));
+    offsets->at(ATT_PLACEMENT) = Att::GetOffset(element, dynamic_cast<const AttPlacement *>(element));
+    offsets->at(ATT_PLIST) = Att::GetOffset(element, dynamic_cast<const AttPlist *>(element));
+    offsets->at(ATT_POINTING) = Att::GetOffset(element, dynamic_cast<const AttPointing *>(element));
+    offsets->at(ATT_QUANTITY) = Att::GetOffset(element, dynamic_cast<const AttQuantity *>(element));
+    offsets->at(ATT_RANGING) = Att::GetOffset(element, dynamic_cast<const AttRanging *>(element));
+    offsets->at(ATT_RESPONSIBILITY) = Att::GetOffset(element, dynamic_cast<const AttResponsibility *>(element));
+    offsets->at(ATT_RESTDURATIONLOGICAL)
+        = Att::GetOffset(element, dynamic_cast<const AttRestdurationLogical *>(element));
+    offsets->at(ATT_SCALABLE) = Att::GetOffset(element, dynamic_cast<const AttScalable *>(element));
+    offsets->at(ATT_SEQUENCE) = Att::GetOffset(element, dynamic_cast<const AttSequence *>(element));
+    offsets->at(ATT_SLASHCOUNT) = Att::GetOffset(element, dynamic_cast<const AttSlashCount *>(element));
+    offsets->at(ATT_SLURPRESENT) = Att::GetOffset(element, dynamic_cast<const AttSlurPresent *>(element));
+    offsets->at(ATT_SOURCE) = Att::GetOffset(element, dynamic_cast<const AttSource *>(element));
+    offsets->at(ATT_SPACING) = Att::GetOffset(element, dynamic_cast<const AttSpacing *>(element));
+    offsets->at(ATT_STAFFLOG) = Att::GetOffset(element, dynamic_cast<const AttStaffLog *>(element));
+    offsets->at(ATT_STAFFDEFLOG) = Att::GetOffset(element, dynamic_cast<const AttStaffDefLog *>(element));
+    offsets->at(ATT_STAFFGROUPINGSYM) = Att::GetOffset(element, dynamic_cast<const AttStaffGroupingSym *>(element));
+    offsets->at(ATT_STAFFIDENT) = Att::GetOffset(element, dynamic_cast<const AttStaffIdent *>(element));
+    offsets->at(ATT_STAFFITEMS) = Att::GetOffset(element, dynamic_cast<const AttStaffItems *>(element));
+    offsets->at(ATT_STAFFLOC) = Att::GetOffset(element, dynamic_cast<const AttStaffLoc *>(element));
+    offsets->at(ATT_STAFFLOCPITCHED) = Att::GetOffset(element, dynamic_cast<const AttStaffLocPitched *>(element));
+    offsets->at(ATT_STARTENDID) = Att::GetOffset(element, dynamic_cast<const AttStartEndId *>(element));
+    offsets->at(ATT_STARTID) = Att::GetOffset(element, dynamic_cast<const AttStartId *>(element));
+    offsets->at(ATT_STEMS) = Att::GetOffset(element, dynamic_cast<const AttStems *>(element));
+    offsets->at(ATT_SYLLOG) = Att::GetOffset(element, dynamic_cast<const AttSylLog *>(element));
+    offsets->at(ATT_SYLTEXT) = Att::GetOffset(element, dynamic_cast<const AttSylText *>(element));
+    offsets->at(ATT_SYSTEMS) = Att::GetOffset(element, dynamic_cast<const AttSystems *>(element));
+    offsets->at(ATT_TARGETEVAL) = Att::GetOffset(element, dynamic_cast<const AttTargetEval *>(element));
+    offsets->at(ATT_TEMPOLOG) = Att::GetOffset(element, dynamic_cast<const AttTempoLog *>(element));
+    offsets->at(ATT_TEXTRENDITION) = Att::GetOffset(element, dynamic_cast<const AttTextRendition *>(element));
+    offsets->at(ATT_TEXTSTYLE) = Att::GetOffset(element, dynamic_cast<const AttTextStyle *>(element));
+    offsets->at(ATT_TIEPRESENT) = Att::GetOffset(element, dynamic_cast<const AttTiePresent *>(element));
+    offsets->at(ATT_TIMESTAMPLOGICAL) = Att::GetOffset(element, dynamic_cast<const AttTimestampLogical *>(element));
+    offsets->at(ATT_TIMESTAMP2LOGICAL) = Att::GetOffset(element, dynamic_cast<const AttTimestamp2Logical *>(element));
+    offsets->at(ATT_TRANSPOSITION) = Att::GetOffset(element, dynamic_cast<const AttTransposition *>(element));
+    offsets->at(ATT_TUPLETPRESENT) = Att::GetOffset(element, dynamic_cast<const AttTupletPresent *>(element));
+    offsets->at(ATT_TYPED) = Att::GetOffset(element, dynamic_cast<const AttTyped *>(element));
+    offsets->at(ATT_TYPOGRAPHY) = Att::GetOffset(element, dynamic_cast<const AttTypography *>(element));
+    offsets->at(ATT_VERTICALALIGN) = Att::GetOffset(element, dynamic_cast<const AttVerticalAlign *>(element));
+    offsets->at(ATT_VERTICALGROUP) = Att::GetOffset(element, dynamic_cast<const AttVerticalGroup *>(element));
+    offsets->at(ATT_VISIBILITY) = Att::GetOffset(element, dynamic_cast<const AttVisibility *>(element));
+    offsets->at(ATT_VISUALOFFSETHO) = Att::GetOffset(element, dynamic_cast<const AttVisualOffsetHo *>(element));
+    offsets->at(ATT_VISUALOFFSETTO) = Att::GetOffset(element, dynamic_cast<const AttVisualOffsetTo *>(element));
+    offsets->at(ATT_VISUALOFFSETVO) = Att::GetOffset(element, dynamic_cast<const AttVisualOffsetVo *>(element));
+    offsets->at(ATT_VISUALOFFSET2HO) = Att::GetOffset(element, dynamic_cast<const AttVisualOffset2Ho *>(element));
+    offsets->at(ATT_VISUALOFFSET2TO) = Att::GetOffset(element, dynamic_cast<const AttVisualOffset2To *>(element));
+    offsets->at(ATT_VISUALOFFSET2VO) = Att::GetOffset(element, dynamic_cast<const AttVisualOffset2Vo *>(element));
+    offsets->at(ATT_VOLTAGROUPINGSYM) = Att::GetOffset(element, dynamic_cast<const AttVoltaGroupingSym *>(element));
+    offsets->at(ATT_WHITESPACE) = Att::GetOffset(element, dynamic_cast<const AttWhitespace *>(element));
+    offsets->at(ATT_WIDTH) = Att::GetOffset(element, dynamic_cast<const AttWidth *>(element));
+    offsets->at(ATT_XY) = Att::GetOffset(element, dynamic_cast<const AttXy *>(element));
+    offsets->at(ATT_XY2) = Att::GetOffset(element, dynamic_cast<const AttXy2 *>(element));
+}
+
 } // vrv namespace
@@ -213,7 +213,7 @@ bool AttLineLog::HasFunc() const
 bool Att::SetUsersymbols(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_ALTSYM)) {
-        AttAltSym *att = dynamic_cast<AttAltSym *>(element);
+        AttAltSym *att = element->GetAttClass<AttAltSym>(ATT_ALTSYM);
         assert(att);
         if (attrType == "altsym") {
             att->SetAltsym(att->StrToStr(attrValue));
@@ -221,7 +221,7 @@ bool Att::SetUsersymbols(Object *element, const std::string &attrType, const std
         }
     }
     if (element->HasAttClass(ATT_ANCHOREDTEXTLOG)) {
-        AttAnchoredTextLog *att = dynamic_cast<AttAnchoredTextLog *>(element);
+        AttAnchoredTextLog *att = element->GetAttClass<AttAnchoredTextLog>(ATT_ANCHOREDTEXTLOG);
         assert(att);
         if (attrType == "func") {
             att->SetFunc(att->StrToStr(attrValue));
@@ -229,7 +229,7 @@ bool Att::SetUsersymbols(Object *element, const std::string &attrType, const std
         }
     }
     if (element->HasAttClass(ATT_CURVELOG)) {
-        AttCurveLog *att = dynamic_cast<AttCurveLog *>(element);
+        AttCurveLog *att = element->GetAttClass<AttCurveLog>(ATT_CURVELOG);
         assert(att);
         if (attrType == "func") {
             att->SetFunc(att->StrToStr(attrValue));
@@ -237,7 +237,7 @@ bool Att::SetUsersymbols(Object *element, const std::string &attrType, const std
         }
     }
     if (element->HasAttClass(ATT_LINELOG)) {
-        AttLineLog *att = dynamic_cast<AttLineLog *>(element);
+        AttLineLog *att = element->GetAttClass<AttLineLog>(ATT_LINELOG);
         assert(att);
         if (attrType == "func") {
             att->SetFunc(att->StrToStr(attrValue));
@@ -251,28 +251,28 @@ bool Att::SetUsersymbols(Object *element, const std::string &attrType, const std
 void Att::GetUsersymbols(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_ALTSYM)) {
-        const AttAltSym *att = dynamic_cast<const AttAltSym *>(element);
+        const AttAltSym *att = element->GetAttClass<AttAltSym>(ATT_ALTSYM);
         assert(att);
         if (att->HasAltsym()) {
             attributes->push_back(std::make_pair("altsym", att->StrToStr(att->GetAltsym())));
         }
     }
     if (element->HasAttClass(ATT_ANCHOREDTEXTLOG)) {
-        const AttAnchoredTextLog *att = dynamic_cast<const AttAnchoredTextLog *>(element);
+        const AttAnchoredTextLog *att = element->GetAttClass<AttAnchoredTextLog>(ATT_ANCHOREDTEXTLOG);
         assert(att);
         if (att->HasFunc()) {
             attributes->push_back(std::make_pair("func", att->StrToStr(att->GetFunc())));
         }
     }
     if (element->HasAttClass(ATT_CURVELOG)) {
-        const AttCurveLog *att = dynamic_cast<const AttCurveLog *>(element);
+        const AttCurveLog *att = element->GetAttClass<AttCurveLog>(ATT_CURVELOG);
         assert(att);
         if (att->HasFunc()) {
             attributes->push_back(std::make_pair("func", att->StrToStr(att->GetFunc())));
         }
     }
     if (element->HasAttClass(ATT_LINELOG)) {
-        const AttLineLog *att = dynamic_cast<const AttLineLog *>(element);
+        const AttLineLog *att = element->GetAttClass<AttLineLog>(ATT_LINELOG);
         assert(att);
         if (att->HasFunc()) {
             attributes->push_back(std::make_pair("func", att->StrToStr(att->GetFunc())));
@@ -280,4 +280,12 @@ void Att::GetUsersymbols(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::GetUsersymbolsOffsets(const Object *element, std::vector<int> *offsets)
+{
+    offsets->at(ATT_ALTSYM) = Att::GetOffset(element, dynamic_cast<const AttAltSym *>(element));
+    offsets->at(ATT_ANCHOREDTEXTLOG) = Att::GetOffset(element, dynamic_cast<const AttAnchoredTextLog *>(element));
+    offsets->at(ATT_CURVELOG) = Att::GetOffset(element, dynamic_cast<const AttCurveLog *>(element));
+    offsets->at(ATT_LINELOG) = Att::GetOffset(element, dynamic_cast<const AttLineLog *>(element));
+}
+
 } // vrv namespace
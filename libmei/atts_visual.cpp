@@ -2254,7 +2254,7 @@ bool AttTupletVis::HasNumFormat() const
 bool Att::SetVisual(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_ANNOTVIS)) {
-        AttAnnotVis *att = dynamic_cast<AttAnnotVis *>(element);
+        AttAnnotVis *att = element->GetAttClass<AttAnnotVis>(ATT_ANNOTVIS);
         assert(att);
         if (attrType == "place") {
             att->SetPlace(att->StrToPlacement(attrValue));
@@ -2262,7 +2262,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_ARPEGVIS)) {
-        AttArpegVis *att = dynamic_cast<AttArpegVis *>(element);
+        AttArpegVis *att = element->GetAttClass<AttArpegVis>(ATT_ARPEGVIS);
         assert(att);
         if (attrType == "arrow") {
             att->SetArrow(att->StrToBoolean(attrValue));
@@ -2294,7 +2294,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_BARLINEVIS)) {
-        AttBarLineVis *att = dynamic_cast<AttBarLineVis *>(element);
+        AttBarLineVis *att = element->GetAttClass<AttBarLineVis>(ATT_BARLINEVIS);
         assert(att);
         if (attrType == "len") {
             att->SetLen(att->StrToDbl(attrValue));
@@ -2310,7 +2310,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_BEAMINGVIS)) {
-        AttBeamingVis *att = dynamic_cast<AttBeamingVis *>(element);
+        AttBeamingVis *att = element->GetAttClass<AttBeamingVis>(ATT_BEAMINGVIS);
         assert(att);
         if (attrType == "beam.color") {
             att->SetBeamColor(att->StrToStr(attrValue));
@@ -2326,7 +2326,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_BEATRPTVIS)) {
-        AttBeatRptVis *att = dynamic_cast<AttBeatRptVis *>(element);
+        AttBeatRptVis *att = element->GetAttClass<AttBeatRptVis>(ATT_BEATRPTVIS);
         assert(att);
         if (attrType == "slash") {
             att->SetSlash(att->StrToBeatrptRend(attrValue));
@@ -2334,7 +2334,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_CHORDVIS)) {
-        AttChordVis *att = dynamic_cast<AttChordVis *>(element);
+        AttChordVis *att = element->GetAttClass<AttChordVis>(ATT_CHORDVIS);
         assert(att);
         if (attrType == "cluster") {
             att->SetCluster(att->StrToCluster(attrValue));
@@ -2342,7 +2342,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_CLEFFINGVIS)) {
-        AttCleffingVis *att = dynamic_cast<AttCleffingVis *>(element);
+        AttCleffingVis *att = element->GetAttClass<AttCleffingVis>(ATT_CLEFFINGVIS);
         assert(att);
         if (attrType == "clef.color") {
             att->SetClefColor(att->StrToStr(attrValue));
@@ -2354,7 +2354,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_EPISEMAVIS)) {
-        AttEpisemaVis *att = dynamic_cast<AttEpisemaVis *>(element);
+        AttEpisemaVis *att = element->GetAttClass<AttEpisemaVis>(ATT_EPISEMAVIS);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToEpisemaVisForm(attrValue));
@@ -2366,7 +2366,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_FTREMVIS)) {
-        AttFTremVis *att = dynamic_cast<AttFTremVis *>(element);
+        AttFTremVis *att = element->GetAttClass<AttFTremVis>(ATT_FTREMVIS);
         assert(att);
         if (attrType == "beams") {
             att->SetBeams(att->StrToInt(attrValue));
@@ -2382,7 +2382,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_FERMATAVIS)) {
-        AttFermataVis *att = dynamic_cast<AttFermataVis *>(element);
+        AttFermataVis *att = element->GetAttClass<AttFermataVis>(ATT_FERMATAVIS);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToFermataVisForm(attrValue));
@@ -2394,7 +2394,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_FINGGRPVIS)) {
-        AttFingGrpVis *att = dynamic_cast<AttFingGrpVis *>(element);
+        AttFingGrpVis *att = element->GetAttClass<AttFingGrpVis>(ATT_FINGGRPVIS);
         assert(att);
         if (attrType == "orient") {
             att->SetOrient(att->StrToFingGrpVisOrient(attrValue));
@@ -2402,7 +2402,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_HAIRPINVIS)) {
-        AttHairpinVis *att = dynamic_cast<AttHairpinVis *>(element);
+        AttHairpinVis *att = element->GetAttClass<AttHairpinVis>(ATT_HAIRPINVIS);
         assert(att);
         if (attrType == "opening") {
             att->SetOpening(att->StrToMeasurementabs(attrValue));
@@ -2410,7 +2410,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_HARMVIS)) {
-        AttHarmVis *att = dynamic_cast<AttHarmVis *>(element);
+        AttHarmVis *att = element->GetAttClass<AttHarmVis>(ATT_HARMVIS);
         assert(att);
         if (attrType == "rendgrid") {
             att->SetRendgrid(att->StrToHarmVisRendgrid(attrValue));
@@ -2418,7 +2418,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_HISPANTICKVIS)) {
-        AttHispanTickVis *att = dynamic_cast<AttHispanTickVis *>(element);
+        AttHispanTickVis *att = element->GetAttClass<AttHispanTickVis>(ATT_HISPANTICKVIS);
         assert(att);
         if (attrType == "place") {
             att->SetPlace(att->StrToEventrel(attrValue));
@@ -2430,7 +2430,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_KEYSIGVIS)) {
-        AttKeySigVis *att = dynamic_cast<AttKeySigVis *>(element);
+        AttKeySigVis *att = element->GetAttClass<AttKeySigVis>(ATT_KEYSIGVIS);
         assert(att);
         if (attrType == "sig.showchange") {
             att->SetSigShowchange(att->StrToBoolean(attrValue));
@@ -2438,7 +2438,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_KEYSIGDEFAULTVIS)) {
-        AttKeySigDefaultVis *att = dynamic_cast<AttKeySigDefaultVis *>(element);
+        AttKeySigDefaultVis *att = element->GetAttClass<AttKeySigDefaultVis>(ATT_KEYSIGDEFAULTVIS);
         assert(att);
         if (attrType == "keysig.show") {
             att->SetKeysigShow(att->StrToBoolean(attrValue));
@@ -2450,7 +2450,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_LIGATUREVIS)) {
-        AttLigatureVis *att = dynamic_cast<AttLigatureVis *>(element);
+        AttLigatureVis *att = element->GetAttClass<AttLigatureVis>(ATT_LIGATUREVIS);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToLigatureform(attrValue));
@@ -2458,7 +2458,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_LINEVIS)) {
-        AttLineVis *att = dynamic_cast<AttLineVis *>(element);
+        AttLineVis *att = element->GetAttClass<AttLineVis>(ATT_LINEVIS);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToLineform(attrValue));
@@ -2486,7 +2486,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_LIQUESCENTVIS)) {
-        AttLiquescentVis *att = dynamic_cast<AttLiquescentVis *>(element);
+        AttLiquescentVis *att = element->GetAttClass<AttLiquescentVis>(ATT_LIQUESCENTVIS);
         assert(att);
         if (attrType == "curve") {
             att->SetCurve(att->StrToLiquescentVisCurve(attrValue));
@@ -2498,7 +2498,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_MENSURVIS)) {
-        AttMensurVis *att = dynamic_cast<AttMensurVis *>(element);
+        AttMensurVis *att = element->GetAttClass<AttMensurVis>(ATT_MENSURVIS);
         assert(att);
         if (attrType == "dot") {
             att->SetDot(att->StrToBoolean(attrValue));
@@ -2518,7 +2518,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_MENSURALVIS)) {
-        AttMensuralVis *att = dynamic_cast<AttMensuralVis *>(element);
+        AttMensuralVis *att = element->GetAttClass<AttMensuralVis>(ATT_MENSURALVIS);
         assert(att);
         if (attrType == "mensur.color") {
             att->SetMensurColor(att->StrToStr(attrValue));
@@ -2554,7 +2554,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_METERSIGVIS)) {
-        AttMeterSigVis *att = dynamic_cast<AttMeterSigVis *>(element);
+        AttMeterSigVis *att = element->GetAttClass<AttMeterSigVis>(ATT_METERSIGVIS);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToMeterform(attrValue));
@@ -2562,7 +2562,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_METERSIGDEFAULTVIS)) {
-        AttMeterSigDefaultVis *att = dynamic_cast<AttMeterSigDefaultVis *>(element);
+        AttMeterSigDefaultVis *att = element->GetAttClass<AttMeterSigDefaultVis>(ATT_METERSIGDEFAULTVIS);
         assert(att);
         if (attrType == "meter.form") {
             att->SetMeterForm(att->StrToMeterform(attrValue));
@@ -2574,7 +2574,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_MULTIRESTVIS)) {
-        AttMultiRestVis *att = dynamic_cast<AttMultiRestVis *>(element);
+        AttMultiRestVis *att = element->GetAttClass<AttMultiRestVis>(ATT_MULTIRESTVIS);
         assert(att);
         if (attrType == "block") {
             att->SetBlock(att->StrToBoolean(attrValue));
@@ -2582,7 +2582,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_PBVIS)) {
-        AttPbVis *att = dynamic_cast<AttPbVis *>(element);
+        AttPbVis *att = element->GetAttClass<AttPbVis>(ATT_PBVIS);
         assert(att);
         if (attrType == "folium") {
             att->SetFolium(att->StrToPbVisFolium(attrValue));
@@ -2590,7 +2590,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_PEDALVIS)) {
-        AttPedalVis *att = dynamic_cast<AttPedalVis *>(element);
+        AttPedalVis *att = element->GetAttClass<AttPedalVis>(ATT_PEDALVIS);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToPedalVisForm(attrValue));
@@ -2598,7 +2598,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_QUILISMAVIS)) {
-        AttQuilismaVis *att = dynamic_cast<AttQuilismaVis *>(element);
+        AttQuilismaVis *att = element->GetAttClass<AttQuilismaVis>(ATT_QUILISMAVIS);
         assert(att);
         if (attrType == "waves") {
             att->SetWaves(att->StrToInt(attrValue));
@@ -2606,7 +2606,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_SBVIS)) {
-        AttSbVis *att = dynamic_cast<AttSbVis *>(element);
+        AttSbVis *att = element->GetAttClass<AttSbVis>(ATT_SBVIS);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToSbVisForm(attrValue));
@@ -2614,7 +2614,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_SCOREDEFVIS)) {
-        AttScoreDefVis *att = dynamic_cast<AttScoreDefVis *>(element);
+        AttScoreDefVis *att = element->GetAttClass<AttScoreDefVis>(ATT_SCOREDEFVIS);
         assert(att);
         if (attrType == "vu.height") {
             att->SetVuHeight(att->StrToStr(attrValue));
@@ -2622,7 +2622,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_SECTIONVIS)) {
-        AttSectionVis *att = dynamic_cast<AttSectionVis *>(element);
+        AttSectionVis *att = element->GetAttClass<AttSectionVis>(ATT_SECTIONVIS);
         assert(att);
         if (attrType == "restart") {
             att->SetRestart(att->StrToBoolean(attrValue));
@@ -2630,7 +2630,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_SIGNIFLETVIS)) {
-        AttSignifLetVis *att = dynamic_cast<AttSignifLetVis *>(element);
+        AttSignifLetVis *att = element->GetAttClass<AttSignifLetVis>(ATT_SIGNIFLETVIS);
         assert(att);
         if (attrType == "place") {
             att->SetPlace(att->StrToEventrel(attrValue));
@@ -2638,7 +2638,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_SPACEVIS)) {
-        AttSpaceVis *att = dynamic_cast<AttSpaceVis *>(element);
+        AttSpaceVis *att = element->GetAttClass<AttSpaceVis>(ATT_SPACEVIS);
         assert(att);
         if (attrType == "compressable") {
             att->SetCompressable(att->StrToBoolean(attrValue));
@@ -2646,7 +2646,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_STAFFDEFVIS)) {
-        AttStaffDefVis *att = dynamic_cast<AttStaffDefVis *>(element);
+        AttStaffDefVis *att = element->GetAttClass<AttStaffDefVis>(ATT_STAFFDEFVIS);
         assert(att);
         if (attrType == "grid.show") {
             att->SetGridShow(att->StrToBoolean(attrValue));
@@ -2670,7 +2670,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_STAFFGRPVIS)) {
-        AttStaffGrpVis *att = dynamic_cast<AttStaffGrpVis *>(element);
+        AttStaffGrpVis *att = element->GetAttClass<AttStaffGrpVis>(ATT_STAFFGRPVIS);
         assert(att);
         if (attrType == "bar.thru") {
             att->SetBarThru(att->StrToBoolean(attrValue));
@@ -2678,7 +2678,7 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
         }
     }
     if (element->HasAttClass(ATT_TUPLETVIS)) {
-        AttTupletVis *att = dynamic_cast<AttTupletVis *>(element);
+        AttTupletVis *att = element->GetAttClass<AttTupletVis>(ATT_TUPLETVIS);
         assert(att);
         if (attrType == "bracket.place") {
             att->SetBracketPlace(att->StrToStaffrelBasic(attrValue));
@@ -2704,14 +2704,14 @@ bool Att::SetVisual(Object *element, const std::string &attrType, const std::str
 void Att::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_ANNOTVIS)) {
-        const AttAnnotVis *att = dynamic_cast<const AttAnnotVis *>(element);
+        const AttAnnotVis *att = element->GetAttClass<AttAnnotVis>(ATT_ANNOTVIS);
         assert(att);
         if (att->HasPlace()) {
             attributes->push_back(std::make_pair("place", att->PlacementToStr(att->GetPlace())));
         }
     }
     if (element->HasAttClass(ATT_ARPEGVIS)) {
-        const AttArpegVis *att = dynamic_cast<const AttArpegVis *>(element);
+        const AttArpegVis *att = element->GetAttClass<AttArpegVis>(ATT_ARPEGVIS);
         assert(att);
         if (att->HasArrow()) {
             attributes->push_back(std::make_pair("arrow", att->BooleanToStr(att->GetArrow())));
@@ -2736,7 +2736,7 @@ void Att::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_BARLINEVIS)) {
-        const AttBarLineVis *att = dynamic_cast<const AttBarLineVis *>(element);
+        const AttBarLineVis *att = element->GetAttClass<AttBarLineVis>(ATT_BARLINEVIS);
         assert(att);
         if (att->HasLen()) {
             attributes->push_back(std::make_pair("len", att->DblToStr(att->GetLen())));
@@ -2749,7 +2749,7 @@ void Att::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_BEAMINGVIS)) {
-        const AttBeamingVis *att = dynamic_cast<const AttBeamingVis *>(element);
+        const AttBeamingVis *att = element->GetAttClass<AttBeamingVis>(ATT_BEAMINGVIS);
         assert(att);
         if (att->HasBeamColor()) {
             attributes->push_back(std::make_pair("beam.color", att->StrToStr(att->GetBeamColor())));
@@ -2762,21 +2762,21 @@ void Att::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_BEATRPTVIS)) {
-        const AttBeatRptVis *att = dynamic_cast<const AttBeatRptVis *>(element);
+        const AttBeatRptVis *att = element->GetAttClass<AttBeatRptVis>(ATT_BEATRPTVIS);
         assert(att);
         if (att->HasSlash()) {
             attributes->push_back(std::make_pair("slash", att->BeatrptRendToStr(att->GetSlash())));
         }
     }
     if (element->HasAttClass(ATT_CHORDVIS)) {
-        const AttChordVis *att = dynamic_cast<const AttChordVis *>(element);
+        const AttChordVis *att = element->GetAttClass<AttChordVis>(ATT_CHORDVIS);
         assert(att);
         if (att->HasCluster()) {
             attributes->push_back(std::make_pair("cluster", att->ClusterToStr(att->GetCluster())));
         }
     }
     if (element->HasAttClass(ATT_CLEFFINGVIS)) {
-        const AttCleffingVis *att = dynamic_cast<const AttCleffingVis *>(element);
+        const AttCleffingVis *att = element->GetAttClass<AttCleffingVis>(ATT_CLEFFINGVIS);
         assert(att);
         if (att->HasClefColor()) {
             attributes->push_back(std::make_pair("clef.color", att->StrToStr(att->GetClefColor())));
@@ -2786,7 +2786,7 @@ void Att::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_EPISEMAVIS)) {
-        const AttEpisemaVis *att = dynamic_cast<const AttEpisemaVis *>(element);
+        const AttEpisemaVis *att = element->GetAttClass<AttEpisemaVis>(ATT_EPISEMAVIS);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back(std::make_pair("form", att->EpisemaVisFormToStr(att->GetForm())));
@@ -2796,7 +2796,7 @@ void Att::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_FTREMVIS)) {
-        const AttFTremVis *att = dynamic_cast<const AttFTremVis *>(element);
+        const AttFTremVis *att = element->GetAttClass<AttFTremVis>(ATT_FTREMVIS);
         assert(att);
         if (att->HasBeams()) {
             attributes->push_back(std::make_pair("beams", att->IntToStr(att->GetBeams())));
@@ -2809,7 +2809,7 @@ void Att::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_FERMATAVIS)) {
-        const AttFermataVis *att = dynamic_cast<const AttFermataVis *>(element);
+        const AttFermataVis *att = element->GetAttClass<AttFermataVis>(ATT_FERMATAVIS);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back(std::make_pair("form", att->FermataVisFormToStr(att->GetForm())));
@@ -2819,28 +2819,28 @@ void Att::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_FINGGRPVIS)) {
-        const AttFingGrpVis *att = dynamic_cast<const AttFingGrpVis *>(element);
+        const AttFingGrpVis *att = element->GetAttClass<AttFingGrpVis>(ATT_FINGGRPVIS);
         assert(att);
         if (att->HasOrient()) {
             attributes->push_back(std::make_pair("orient", att->FingGrpVisOrientToStr(att->GetOrient())));
         }
     }
     if (element->HasAttClass(ATT_HAIRPINVIS)) {
-        const AttHairpinVis *att = dynamic_cast<const AttHairpinVis *>(element);
+        const AttHairpinVis *att = element->GetAttClass<AttHairpinVis>(ATT_HAIRPINVIS);
         assert(att);
         if (att->HasOpening()) {
             attributes->push_back(std::make_pair("opening", att->MeasurementabsToStr(att->GetOpening())));
         }
     }
     if (element->HasAttClass(ATT_HARMVIS)) {
-        const AttHarmVis *att = dynamic_cast<const AttHarmVis *>(element);
+        const AttHarmVis *att = element->GetAttClass<AttHarmVis>(ATT_HARMVIS);
         assert(att);
         if (att->HasRendgrid()) {
             attributes->push_back(std::make_pair("rendgrid", att->HarmVisRendgridToStr(att->GetRendgrid())));
         }
     }
     if (element->HasAttClass(ATT_HISPANTICKVIS)) {
-        const AttHispanTickVis *att = dynamic_cast<const AttHispanTickVis *>(element);
+        const AttHispanTickVis *att = element->GetAttClass<AttHispanTickVis>(ATT_HISPANTICKVIS);
         assert(att);
         if (att->HasPlace()) {
             attributes->push_back(std::make_pair("place", att->EventrelToStr(att->GetPlace())));
@@ -2850,14 +2850,14 @@ void Att::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_KEYSIGVIS)) {
-        const AttKeySigVis *att = dynamic_cast<const AttKeySigVis *>(element);
+        const AttKeySigVis *att = element->GetAttClass<AttKeySigVis>(ATT_KEYSIGVIS);
         assert(att);
         if (att->HasSigShowchange()) {
             attributes->push_back(std::make_pair("sig.showchange", att->BooleanToStr(att->GetSigShowchange())));
         }
     }
     if (element->HasAttClass(ATT_KEYSIGDEFAULTVIS)) {
-        const AttKeySigDefaultVis *att = dynamic_cast<const AttKeySigDefaultVis *>(element);
+        const AttKeySigDefaultVis *att = element->GetAttClass<AttKeySigDefaultVis>(ATT_KEYSIGDEFAULTVIS);
         assert(att);
         if (att->HasKeysigShow()) {
             attributes->push_back(std::make_pair("keysig.show", att->BooleanToStr(att->GetKeysigShow())));
@@ -2867,14 +2867,14 @@ void Att::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_LIGATUREVIS)) {
-        const AttLigatureVis *att = dynamic_cast<const AttLigatureVis *>(element);
+        const AttLigatureVis *att = element->GetAttClass<AttLigatureVis>(ATT_LIGATUREVIS);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back(std::make_pair("form", att->LigatureformToStr(att->GetForm())));
         }
     }
     if (element->HasAttClass(ATT_LINEVIS)) {
-        const AttLineVis *att = dynamic_cast<const AttLineVis *>(element);
+        const AttLineVis *att = element->GetAttClass<AttLineVis>(ATT_LINEVIS);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back(std::make_pair("form", att->LineformToStr(att->GetForm())));
@@ -2896,7 +2896,7 @@ void Att::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_LIQUESCENTVIS)) {
-        const AttLiquescentVis *att = dynamic_cast<const AttLiquescentVis *>(element);
+        const AttLiquescentVis *att = element->GetAttClass<AttLiquescentVis>(ATT_LIQUESCENTVIS);
         assert(att);
         if (att->HasCurve()) {
             attributes->push_back(std::make_pair("curve", att->LiquescentVisCurveToStr(att->GetCurve())));
@@ -2906,7 +2906,7 @@ void Att::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_MENSURVIS)) {
-        const AttMensurVis *att = dynamic_cast<const AttMensurVis *>(element);
+        const AttMensurVis *att = element->GetAttClass<AttMensurVis>(ATT_MENSURVIS);
         assert(att);
         if (att->HasDot()) {
             attributes->push_back(std::make_pair("dot", att->BooleanToStr(att->GetDot())));
@@ -2922,7 +2922,7 @@ void Att::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_MENSURALVIS)) {
-        const AttMensuralVis *att = dynamic_cast<const AttMensuralVis *>(element);
+        const AttMensuralVis *att = element->GetAttClass<AttMensuralVis>(ATT_MENSURALVIS);
         assert(att);
         if (att->HasMensurColor()) {
             attributes->push_back(std::make_pair("mensur.color", att->StrToStr(att->GetMensurColor())));
@@ -2950,14 +2950,14 @@ void Att::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_METERSIGVIS)) {
-        const AttMeterSigVis *att = dynamic_cast<const AttMeterSigVis *>(element);
+        const AttMeterSigVis *att = element->GetAttClass<AttMeterSigVis>(ATT_METERSIGVIS);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back(std::make_pair("form", att->MeterformToStr(att->GetForm())));
         }
     }
     if (element->HasAttClass(ATT_METERSIGDEFAULTVIS)) {
-        const AttMeterSigDefaultVis *att = dynamic_cast<const AttMeterSigDefaultVis *>(element);
+        const AttMeterSigDefaultVis *att = element->GetAttClass<AttMeterSigDefaultVis>(ATT_METERSIGDEFAULTVIS);
         assert(att);
         if (att->HasMeterForm()) {
             attributes->push_back(std::make_pair("meter.form", att->MeterformToStr(att->GetMeterForm())));
@@ -2967,70 +2967,70 @@ void Att::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_MULTIRESTVIS)) {
-        const AttMultiRestVis *att = dynamic_cast<const AttMultiRestVis *>(element);
+        const AttMultiRestVis *att = element->GetAttClass<AttMultiRestVis>(ATT_MULTIRESTVIS);
         assert(att);
         if (att->HasBlock()) {
             attributes->push_back(std::make_pair("block", att->BooleanToStr(att->GetBlock())));
         }
     }
     if (element->HasAttClass(ATT_PBVIS)) {
-        const AttPbVis *att = dynamic_cast<const AttPbVis *>(element);
+        const AttPbVis *att = element->GetAttClass<AttPbVis>(ATT_PBVIS);
         assert(att);
         if (att->HasFolium()) {
             attributes->push_back(std::make_pair("folium", att->PbVisFoliumToStr(att->GetFolium())));
         }
     }
     if (element->HasAttClass(ATT_PEDALVIS)) {
-        const AttPedalVis *att = dynamic_cast<const AttPedalVis *>(element);
+        const AttPedalVis *att = element->GetAttClass<AttPedalVis>(ATT_PEDALVIS);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back(std::make_pair("form", att->PedalVisFormToStr(att->GetForm())));
         }
     }
     if (element->HasAttClass(ATT_QUILISMAVIS)) {
-        const AttQuilismaVis *att = dynamic_cast<const AttQuilismaVis *>(element);
+        const AttQuilismaVis *att = element->GetAttClass<AttQuilismaVis>(ATT_QUILISMAVIS);
         assert(att);
         if (att->HasWaves()) {
             attributes->push_back(std::make_pair("waves", att->IntToStr(att->GetWaves())));
         }
     }
     if (element->HasAttClass(ATT_SBVIS)) {
-        const AttSbVis *att = dynamic_cast<const AttSbVis *>(element);
+        const AttSbVis *att = element->GetAttClass<AttSbVis>(ATT_SBVIS);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back(std::make_pair("form", att->SbVisFormToStr(att->GetForm())));
         }
     }
     if (element->HasAttClass(ATT_SCOREDEFVIS)) {
-        const AttScoreDefVis *att = dynamic_cast<const AttScoreDefVis *>(element);
+        const AttScoreDefVis *att = element->GetAttClass<AttScoreDefVis>(ATT_SCOREDEFVIS);
         assert(att);
         if (att->HasVuHeight()) {
             attributes->push_back(std::make_pair("vu.height", att->StrToStr(att->GetVuHeight())));
         }
     }
     if (element->HasAttClass(ATT_SECTIONVIS)) {
-        const AttSectionVis *att = dynamic_cast<const AttSectionVis *>(element);
+        const AttSectionVis *att = element->GetAttClass<AttSectionVis>(ATT_SECTIONVIS);
         assert(att);
         if (att->HasRestart()) {
             attributes->push_back(std::make_pair("restart", att->BooleanToStr(att->GetRestart())));
         }
     }
     if (element->HasAttClass(ATT_SIGNIFLETVIS)) {
-        const AttSignifLetVis *att = dynamic_cast<const AttSignifLetVis *>(element);
+        const AttSignifLetVis *att = element->GetAttClass<AttSignifLetVis>(ATT_SIGNIFLETVIS);
         assert(att);
         if (att->HasPlace()) {
             attributes->push_back(std::make_pair("place", att->EventrelToStr(att->GetPlace())));
         }
     }
     if (element->HasAttClass(ATT_SPACEVIS)) {
-        const AttSpaceVis *att = dynamic_cast<const AttSpaceVis *>(element);
+        const AttSpaceVis *att = element->GetAttClass<AttSpaceVis>(ATT_SPACEVIS);
         assert(att);
         if (att->HasCompressable()) {
             attributes->push_back(std::make_pair("compressable", att->BooleanToStr(att->GetCompressable())));
         }
     }
     if (element->HasAttClass(ATT_STAFFDEFVIS)) {
-        const AttStaffDefVis *att = dynamic_cast<const AttStaffDefVis *>(element);
+        const AttStaffDefVis *att = element->GetAttClass<AttStaffDefVis>(ATT_STAFFDEFVIS);
         assert(att);
         if (att->HasGridShow()) {
             attributes->push_back(std::make_pair("grid.show", att->BooleanToStr(att->GetGridShow())));
@@ -3049,14 +3049,14 @@ void Att::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_STAFFGRPVIS)) {
-        const AttStaffGrpVis *att = dynamic_cast<const AttStaffGrpVis *>(element);
+        const AttStaffGrpVis *att = element->GetAttClass<AttStaffGrpVis>(ATT_STAFFGRPVIS);
         assert(att);
         if (att->HasBarThru()) {
             attributes->push_back(std::make_pair("bar.thru", att->BooleanToStr(att->GetBarThru())));
         }
     }
     if (element->HasAttClass(ATT_TUPLETVIS)) {
-        const AttTupletVis *att = dynamic_cast<const AttTupletVis *>(element);
+        const AttTupletVis *att = element->GetAttClass<AttTupletVis>(ATT_TUPLETVIS);
         assert(att);
         if (att->HasBracketPlace()) {
             attributes->push_back(std::make_pair("bracket.place", att->StaffrelBasicToStr(att->GetBracketPlace())));
@@ -3073,4 +3073,43 @@ void Att::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::GetVisualOffsets(const Object *element, std::vector<int> *offsets)
+{
+    offsets->at(ATT_ANNOTVIS) = Att::GetOffset(element, dynamic_cast<const AttAnnotVis *>(element));
+    offsets->at(ATT_ARPEGVIS) = Att::GetOffset(element, dynamic_cast<const AttArpegVis *>(element));
+    offsets->at(ATT_BARLINEVIS) = Att::GetOffset(element, dynamic_cast<const AttBarLineVis *>(element));
+    offsets->at(ATT_BEAMINGVIS) = Att::GetOffset(element, dynamic_cast<const AttBeamingVis *>(element));
+    offsets->at(ATT_BEATRPTVIS) = Att::GetOffset(element, dynamic_cast<const AttBeatRptVis *>(element));
+    offsets->at(ATT_CHORDVIS) = Att::GetOffset(element, dynamic_cast<const AttChordVis *>(element));
+    offsets->at(ATT_CLEFFINGVIS) = Att::GetOffset(element, dynamic_cast<const AttCleffingVis *>(element));
+    offsets->at(ATT_EPISEMAVIS) = Att::GetOffset(element, dynamic_cast<const AttEpisemaVis *>(element));
+    offsets->at(ATT_FTREMVIS) = Att::GetOffset(element, dynamic_cast<const AttFTremVis *>(element));
+    offsets->at(ATT_FERMATAVIS) = Att::GetOffset(element, dynamic_cast<const AttFermataVis *>(element));
+    offsets->at(ATT_FINGGRPVIS) = Att::GetOffset(element, dynamic_cast<const AttFingGrpVis *>(element));
+    offsets->at(ATT_HAIRPINVIS) = Att::GetOffset(element, dynamic_cast<const AttHairpinVis *>(element));
+    offsets->at(ATT_HARMVIS) = Att::GetOffset(element, dynamic_cast<const AttHarmVis *>(element));
+    offsets->at(ATT_HISPANTICKVIS) = Att::GetOffset(element, dynamic_cast<const AttHispanTickVis *>(element));
+    offsets->at(ATT_KEYSIGVIS) = Att::GetOffset(element, dynamic_cast<const AttKeySigVis *>(element));
+    offsets->at(ATT_KEYSIGDEFAULTVIS) = Att::GetOffset(element, dynamic_cast<const AttKeySigDefaultVis *>(element));
+    offsets->at(ATT_LIGATUREVIS) = Att::GetOffset(element, dynamic_cast<const AttLigatureVis *>(element));
+    offsets->at(ATT_LINEVIS) = Att::GetOffset(element, dynamic_cast<const AttLineVis *>(element));
+    offsets->at(ATT_LIQUESCENTVIS) = Att::GetOffset(element, dynamic_cast<const AttLiquescentVis *>(element));
+    offsets->at(ATT_MENSURVIS) = Att::GetOffset(element, dynamic_cast<const AttMensurVis *>(element));
+    offsets->at(ATT_MENSURALVIS) = Att::GetOffset(element, dynamic_cast<const AttMensuralVis *>(element));
+    offsets->at(ATT_METERSIGVIS) = Att::GetOffset(element, dynamic_cast<const AttMeterSigVis *>(element));
+    offsets->at(ATT_METERSIGDEFAULTVIS) = Att::GetOffset(element, dynamic_cast<const AttMeterSigDefaultVis *>(element));
+    offsets->at(ATT_MULTIRESTVIS) = Att::GetOffset(element, dynamic_cast<const AttMultiRestVis *>(element));
+    offsets->at(ATT_PBVIS) = Att::GetOffset(element, dynamic_cast<const AttPbVis *>(element));
+    offsets->at(ATT_PEDALVIS) = Att::GetOffset(element, dynamic_cast<const AttPedalVis *>(element));
+    offsets->at(ATT_QUILISMAVIS) = Att::GetOffset(element, dynamic_cast<const AttQuilismaVis *>(element));
+    offsets->at(ATT_SBVIS) = Att::GetOffset(element, dynamic_cast<const AttSbVis *>(element));
+    offsets->at(ATT_SCOREDEFVIS) = Att::GetOffset(element, dynamic_cast<const AttScoreDefVis *>(element));
+    offsets->at(ATT_SECTIONVIS) = Att::GetOffset(element, dynamic_cast<const AttSectionVis *>(element));
+    offsets->at(ATT_SIGNIFLETVIS) = Att::GetOffset(element, dynamic_cast<const AttSignifLetVis *>(element));
+    offsets->at(ATT_SPACEVIS) = Att::GetOffset(element, dynamic_cast<const AttSpaceVis *>(element));
+    offsets->at(ATT_STAFFDEFVIS) = Att::GetOffset(element, dynamic_cast<const AttStaffDefVis *>(element));
+    offsets->at(ATT_STAFFGRPVIS) = Att::GetOffset(element, dynamic_cast<const AttStaffGrpVis *>(element));
+    offsets->at(ATT_TUPLETVIS) = Att::GetOffset(element, dynamic_cast<const AttTupletVis *>(element));
+}
+
 } // vrv namespace
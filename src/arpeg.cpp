@@ -222,10 +222,10 @@ int Arpeg::AdjustArpeg(FunctorParams *functorParams)
     // We should have call DrawArpeg before
     assert(this->GetCurrentFloatingPositioner());
 
-    Staff *topStaff = vrv_cast<Staff *>(topNote->GetFirstAncestor(STAFF));
+    Staff *topStaff = topNote->GetAncestorStaff();
     assert(topStaff);
 
-    Staff *bottomStaff = vrv_cast<Staff *>(bottomNote->GetFirstAncestor(STAFF));
+    Staff *bottomStaff = bottomNote->GetAncestorStaff();
     assert(bottomStaff);
 
     Staff *crossStaff = GetCrossStaff();
@@ -798,6 +798,12 @@ data_STAFFREL_basic Att::StaffrelToStaffrelBasic(data_STAFFREL staffrel)
     return staffrelBasic;
 }
 
+int Att::GetOffset(const Object *element, const void *att)
+{
+    if (!att) return VRV_UNSET;
+    return (int)(static_cast<const char *>(att) - reinterpret_cast<const char *>(element));
+}
+
 bool Att::IsMensuralType(data_NOTATIONTYPE notationType)
 {
     return (notationType == NOTATIONTYPE_mensural || notationType == NOTATIONTYPE_mensural_white
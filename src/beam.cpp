@@ -71,6 +71,12 @@ const ArrayOfBeamElementCoords *BeamSegment::GetElementCoordRefs()
     return &m_beamElementCoordRefs;
 }
 
+size_t BeamSegment::GetMemorySize() const
+{
+    return sizeof(*this) + m_beamElementCoordRefs.capacity() * sizeof(BeamElementCoord *)
+        + m_beamElementCoordRefs.size() * sizeof(BeamElementCoord);
+}
+
 void BeamSegment::ClearCoordRefs()
 {
     m_beamElementCoordRefs.clear();
@@ -1124,12 +1130,12 @@ void Beam::FilterList(ArrayOfObjects *childList)
         }
     }
 
-    Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *staff = this->GetAncestorStaff();
     assert(staff);
     Staff *beamStaff = staff;
     /*
     if (this->HasBeamWith()) {
-        Measure *measure = vrv_cast<Measure *>(this->GetFirstAncestor(MEASURE));
+        Measure *measure = this->GetAncestorMeasure();
         assert(measure);
         if (this->GetBeamWith() == OTHERSTAFF_below) {
             beamStaff = dynamic_cast<Staff *>(measure->GetNext(staff, STAFF));
@@ -1383,7 +1389,7 @@ int Beam::AdjustBeams(FunctorParams *functorParams)
 
     const int overlapMargin = std::max(leftMargin * params->m_directionBias, rightMargin * params->m_directionBias);
     if (overlapMargin >= params->m_overlapMargin) {
-        Staff *staff = vrv_cast<Staff *>(GetFirstAncestor(STAFF));
+        Staff *staff = this->GetAncestorStaff();
         assert(staff);
         const int staffOffset = params->m_doc->GetDrawingUnit(staff->m_drawingStaffSize);
         params->m_overlapMargin = (overlapMargin + staffOffset) * params->m_directionBias;
@@ -1423,7 +1429,7 @@ int Beam::CalcStem(FunctorParams *functorParams)
 
     this->m_beamSegment.InitCoordRefs(this->GetElementCoords());
 
-    Layer *layer = vrv_cast<Layer *>(this->GetFirstAncestor(LAYER));
+    Layer *layer = this->GetAncestorLayer();
     assert(layer);
     Staff *staff = vrv_cast<Staff *>(layer->GetFirstAncestor(STAFF));
     assert(staff);
@@ -1446,4 +1452,16 @@ int Beam::ResetDrawing(FunctorParams *functorParams)
     return FUNCTOR_CONTINUE;
 }
 
+
+int Beam::GetMemoryUsage(FunctorParams *functorParams)
+{
+    GetMemoryUsageParams *params = vrv_params_cast<GetMemoryUsageParams *>(functorParams);
+    assert(params);
+
+    params->m_beamSegments.first++;
+    params->m_beamSegments.second += m_beamSegment.GetMemorySize();
+
+    return Object::GetMemoryUsage(functorParams);
+}
+
 } // namespace vrv
@@ -91,7 +91,7 @@ int Clef::AdjustBeams(FunctorParams *functorParams)
     assert(params);
     if (!params->m_beam) return FUNCTOR_SIBLINGS;
 
-    Staff *staff = vrv_cast<Staff *>(GetFirstAncestor(STAFF));
+    Staff *staff = this->GetAncestorStaff();
     assert(staff);
 
     auto currentShapeIter = topToMiddleProportions.find(GetShape());
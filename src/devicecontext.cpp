@@ -16,6 +16,7 @@
 //----------------------------------------------------------------------------
 
 #include "glyph.h"
+#include "textextentcache.h"
 #include "vrv.h"
 
 namespace vrv {
@@ -137,36 +138,49 @@ void DeviceContext::GetTextExtent(const std::wstring &string, TextExtend *extend
     assert(m_fontStack.top());
     assert(extend);
 
-    extend->m_width = 0;
-    extend->m_height = 0;
-
-    if (typeSize) {
-        AddGlyphToTextExtend(Resources::GetTextGlyph(L'p'), extend);
-        AddGlyphToTextExtend(Resources::GetTextGlyph(L'M'), extend);
-        extend->m_width = 0;
-    }
+    // The glyphs of the text font are the ones of the current style set by Resources::SelectTextFont
+    const int pointSize = m_fontStack.top()->GetPointSize();
+    const Resources::StyleAttributes style = Resources::GetTextStyle();
+
+    // The string is measured from an empty extend for being cached
+    TextExtend stringExtend;
+    if (!m_textExtentCache || !m_textExtentCache->Find(string, pointSize, style, typeSize, stringExtend)) {
+        if (typeSize) {
+            AddGlyphToTextExtend(Resources::GetTextGlyph(L'p'), &stringExtend);
+            AddGlyphToTextExtend(Resources::GetTextGlyph(L'M'), &stringExtend);
+            stringExtend.m_width = 0;
+        }
 
-    Glyph *unkown = Resources::GetTextGlyph(L'o');
+        Glyph *unkown = Resources::GetTextGlyph(L'o');
 
-    for (unsigned int i = 0; i < string.length(); ++i) {
-        wchar_t c = string[i];
-        Glyph *glyph = Resources::GetTextGlyph(c);
-        if (!glyph) {
-            glyph = Resources::GetGlyph(c);
-        }
-        if (!glyph) {
-            // There is no glyph for space, and we would use 'o' to increase extend width. However 'o' is wider than
-            // space, which led to incorrect rendering. For the time being, set width to that of '.' instead.
-            // This will probably need to be improved to change with font size/style
-            if (c == L' ') {
-                glyph = Resources::GetTextGlyph(L'.');
+        for (unsigned int i = 0; i < string.length(); ++i) {
+            wchar_t c = string[i];
+            Glyph *glyph = Resources::GetTextGlyph(c);
+            if (!glyph) {
+                glyph = Resources::GetGlyph(c);
             }
-            else {
-                glyph = unkown;
+            if (!glyph) {
+                // There is no glyph for space, and we would use 'o' to increase extend width. However 'o' is wider
+                // than space, which led to incorrect rendering. For the time being, set width to that of '.'
+                // instead. This will probably need to be improved to change with font size/style
+                if (c == L' ') {
+                    glyph = Resources::GetTextGlyph(L'.');
+                }
+                else {
+                    glyph = unkown;
+                }
             }
+            AddGlyphToTextExtend(glyph, &stringExtend);
         }
-        AddGlyphToTextExtend(glyph, extend);
+
+        if (m_textExtentCache) m_textExtentCache->Add(string, pointSize, style, typeSize, stringExtend);
     }
+
+    // The ascent and the descent of the extend passed are kept when higher
+    extend->m_width = stringExtend.m_width;
+    extend->m_height = stringExtend.m_height;
+    extend->m_ascent = std::max(extend->m_ascent, stringExtend.m_ascent);
+    extend->m_descent = std::max(extend->m_descent, stringExtend.m_descent);
 }
 
 void DeviceContext::GetSmuflTextExtent(const std::wstring &string, TextExtend *extend)
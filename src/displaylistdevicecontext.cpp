@@ -0,0 +1,756 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        displaylistdevicecontext.cpp
+// Author:      Laurent Pugin
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "displaylistdevicecontext.h"
+
+//----------------------------------------------------------------------------
+
+#include <assert.h>
+
+//----------------------------------------------------------------------------
+
+#include "object.h"
+#include "vrv.h"
+
+namespace vrv {
+
+static bool IsSamePen(const Pen &pen1, const Pen &pen2)
+{
+    return ((pen1.GetColour() == pen2.GetColour()) && (pen1.GetWidth() == pen2.GetWidth())
+        && (pen1.GetDashLength() == pen2.GetDashLength()) && (pen1.GetLineCap() == pen2.GetLineCap())
+        && (pen1.GetOpacity() == pen2.GetOpacity()));
+}
+
+static bool IsSameBrush(const Brush &brush1, const Brush &brush2)
+{
+    return ((brush1.GetColour() == brush2.GetColour()) && (brush1.GetOpacity() == brush2.GetOpacity()));
+}
+
+static bool IsSameFont(FontInfo &font1, FontInfo &font2)
+{
+    return ((font1.GetPointSize() == font2.GetPointSize()) && (font1.GetFamily() == font2.GetFamily())
+        && (font1.GetStyle() == font2.GetStyle()) && (font1.GetWeight() == font2.GetWeight())
+        && (font1.GetUnderlined() == font2.GetUnderlined()) && (font1.GetSupSubScript() == font2.GetSupSubScript())
+        && (font1.GetFaceName() == font2.GetFaceName()) && (font1.GetEncoding() == font2.GetEncoding())
+        && (font1.GetWidthToHeightRatio() == font2.GetWidthToHeightRatio()));
+}
+
+//----------------------------------------------------------------------------
+// DisplayListDeviceContext
+//----------------------------------------------------------------------------
+
+DisplayListDeviceContext::DisplayListDeviceContext(bool useGlobalStyling) : DeviceContext()
+{
+    m_useGlobalStyling = useGlobalStyling;
+
+    Reset();
+}
+
+DisplayListDeviceContext::~DisplayListDeviceContext()
+{
+    this->ClearClones();
+}
+
+void DisplayListDeviceContext::ClearClones()
+{
+    ArrayOfObjects::iterator iter;
+    for (iter = m_clones.begin(); iter != m_clones.end(); ++iter) {
+        delete *iter;
+    }
+    m_clones.clear();
+}
+
+void DisplayListDeviceContext::Reset()
+{
+    m_logicalOrigin = Point(0, 0);
+    m_PPUFactor = 1.0;
+
+    m_operations.clear();
+    m_points.clear();
+    m_doubles.clear();
+    m_strings.clear();
+    m_wstrings.clear();
+    m_objects.clear();
+    this->ClearClones();
+    m_objectIndices.clear();
+    m_parentChildren.clear();
+    m_views.clear();
+    m_svgShapes.clear();
+    m_images.clear();
+
+    m_pens.clear();
+    m_brushes.clear();
+    m_fonts.clear();
+    m_currentPen = -1;
+    m_currentBrush = -1;
+    m_currentFont = -1;
+    m_currentDeactivation = 0;
+}
+
+void DisplayListDeviceContext::AddOperation(DisplayListOperation operation)
+{
+    // Pen, brush and font are not virtual in DeviceContext - record the changes of the top ones on the stacks
+    int pen = -1;
+    if (!m_penStack.empty()) {
+        pen = m_currentPen;
+        if ((pen == -1) || !IsSamePen(m_pens.at(pen), m_penStack.top())) {
+            m_pens.push_back(m_penStack.top());
+            pen = (int)m_pens.size() - 1;
+        }
+    }
+    if (pen != m_currentPen) {
+        m_operations.push_back(DL_PEN);
+        m_operations.push_back(pen);
+        m_currentPen = pen;
+    }
+
+    int brush = -1;
+    if (!m_brushStack.empty()) {
+        brush = m_currentBrush;
+        if ((brush == -1) || !IsSameBrush(m_brushes.at(brush), m_brushStack.top())) {
+            m_brushes.push_back(m_brushStack.top());
+            brush = (int)m_brushes.size() - 1;
+        }
+    }
+    if (brush != m_currentBrush) {
+        m_operations.push_back(DL_BRUSH);
+        m_operations.push_back(brush);
+        m_currentBrush = brush;
+    }
+
+    // The font is copied because it can be a local variable of the view
+    int font = -1;
+    if (!m_fontStack.empty() && m_fontStack.top()) {
+        font = m_currentFont;
+        if ((font == -1) || !IsSameFont(m_fonts.at(font), *m_fontStack.top())) {
+            m_fonts.push_back(*m_fontStack.top());
+            font = (int)m_fonts.size() - 1;
+        }
+    }
+    if (font != m_currentFont) {
+        m_operations.push_back(DL_FONT);
+        m_operations.push_back(font);
+        m_currentFont = font;
+    }
+
+    int deactivation = (m_isDeactivatedX ? 1 : 0) | (m_isDeactivatedY ? 2 : 0);
+    if (deactivation != m_currentDeactivation) {
+        m_operations.push_back(DL_DEACTIVATE);
+        m_operations.push_back(deactivation);
+        m_currentDeactivation = deactivation;
+    }
+
+    m_operations.push_back(operation);
+}
+
+void DisplayListDeviceContext::AddPoints(int n, const Point points[])
+{
+    m_operations.push_back(n);
+    m_operations.push_back((int)m_points.size());
+    m_points.insert(m_points.end(), points, points + n);
+}
+
+void DisplayListDeviceContext::AddDouble(double value)
+{
+    m_operations.push_back((int)m_doubles.size());
+    m_doubles.push_back(value);
+}
+
+void DisplayListDeviceContext::AddString(const std::string &value)
+{
+    m_operations.push_back((int)m_strings.size());
+    m_strings.push_back(value);
+}
+
+void DisplayListDeviceContext::AddWString(const std::wstring &value)
+{
+    m_operations.push_back((int)m_wstrings.size());
+    m_wstrings.push_back(value);
+}
+
+void DisplayListDeviceContext::AddObject(Object *object)
+{
+    // Each object is recorded once for all its graphics
+    auto iter = m_objectIndices.find(object);
+    if (iter != m_objectIndices.end()) {
+        m_operations.push_back(iter->second);
+        return;
+    }
+
+    // Some objects are instanciated by the view only for drawing and are not in the tree - keep a copy of them
+    // These are the lyric and figured bass connectors and the ending numbers. Other objects not in the tree (e.g., the
+    // current clef of a staffDef) are owned by the document and are recorded as they are, since not all classes
+    // implement Object::Clone
+    if (object->Is({ FIGURE, SYL, TEXT }) && !this->IsChildOfParent(object)) {
+        Object *clone = object->Clone();
+        clone->SetUuid(object->GetUuid());
+        clone->SetParent(object->GetParent());
+        m_clones.push_back(clone);
+        m_objectIndices[object] = (int)m_objects.size();
+        m_operations.push_back((int)m_objects.size());
+        m_objects.push_back(clone);
+        return;
+    }
+
+    m_objectIndices[object] = (int)m_objects.size();
+    m_operations.push_back((int)m_objects.size());
+    m_objects.push_back(object);
+}
+
+void DisplayListDeviceContext::AddEndedObject(Object *object)
+{
+    this->AddObject(object);
+
+    // An object not in the tree can be deleted once drawn and its address given to another one
+    const int index = m_operations.back();
+    if (m_objects.at(index) != object) m_objectIndices.erase(object);
+}
+
+bool DisplayListDeviceContext::IsChildOfParent(Object *object)
+{
+    Object *parent = object->GetParent();
+    if (!parent) return false;
+
+    auto iter = m_parentChildren.find(parent);
+    if (iter == m_parentChildren.end()) {
+        const ArrayOfObjects *children = parent->GetChildren();
+        iter = m_parentChildren.emplace(parent, std::unordered_set<Object *>(children->begin(), children->end())).first;
+    }
+    return (iter->second.count(object) > 0);
+}
+
+void DisplayListDeviceContext::AddView(View *view)
+{
+    m_operations.push_back((int)m_views.size());
+    m_views.push_back(view);
+}
+
+void DisplayListDeviceContext::Replay(DeviceContext *dc)
+{
+    assert(dc);
+
+    dc->SetWidth(this->GetWidth());
+    dc->SetHeight(this->GetHeight());
+    dc->SetContentHeight(this->GetContentHeight());
+
+    bool hasPen = false;
+    bool hasBrush = false;
+    bool hasFont = false;
+    int deactivation = 0;
+
+    const int *args = m_operations.data();
+    const int *end = args + m_operations.size();
+    while (args < end) {
+        DisplayListOperation operation = (DisplayListOperation)*args++;
+        switch (operation) {
+            case DL_PEN: {
+                if (hasPen) dc->ResetPen();
+                int pen = *args++;
+                hasPen = (pen != -1);
+                if (hasPen) {
+                    const Pen &current = m_pens.at(pen);
+                    dc->SetPen(current.GetColour(), current.GetWidth(),
+                        (current.GetOpacity() == 0.0) ? AxTRANSPARENT : AxSOLID, current.GetDashLength(),
+                        current.GetLineCap());
+                }
+                break;
+            }
+            case DL_BRUSH: {
+                if (hasBrush) dc->ResetBrush();
+                int brush = *args++;
+                hasBrush = (brush != -1);
+                if (hasBrush) {
+                    const Brush &current = m_brushes.at(brush);
+                    dc->SetBrush(current.GetColour(), (current.GetOpacity() == 0.0) ? AxTRANSPARENT : AxSOLID);
+                }
+                break;
+            }
+            case DL_FONT: {
+                if (hasFont) dc->ResetFont();
+                int font = *args++;
+                hasFont = (font != -1);
+                if (hasFont) dc->SetFont(&m_fonts.at(font));
+                break;
+            }
+            case DL_DEACTIVATE: {
+                if (deactivation != 0) dc->ReactivateGraphic();
+                deactivation = *args++;
+                if (deactivation == 3) {
+                    dc->DeactivateGraphic();
+                }
+                else if (deactivation == 1) {
+                    dc->DeactivateGraphicX();
+                }
+                else if (deactivation == 2) {
+                    dc->DeactivateGraphicY();
+                }
+                break;
+            }
+            case DL_BACKGROUND: {
+                dc->SetBackground(args[0], args[1]);
+                args += 2;
+                break;
+            }
+            case DL_BACKGROUND_IMAGE: {
+                dc->SetBackgroundImage(m_images.at(args[0]), m_doubles.at(args[1]));
+                args += 2;
+                break;
+            }
+            case DL_BACKGROUND_MODE: dc->SetBackgroundMode(*args++); break;
+            case DL_TEXT_FOREGROUND: dc->SetTextForeground(*args++); break;
+            case DL_TEXT_BACKGROUND: dc->SetTextBackground(*args++); break;
+            case DL_LOGICAL_ORIGIN: {
+                dc->SetLogicalOrigin(args[0], args[1]);
+                args += 2;
+                break;
+            }
+            case DL_SIMPLE_BEZIER_PATH: {
+                dc->DrawSimpleBezierPath(m_points.data() + args[1]);
+                args += 2;
+                break;
+            }
+            case DL_COMPLEX_BEZIER_PATH: {
+                dc->DrawComplexBezierPath(m_points.data() + args[1], m_points.data() + args[3]);
+                args += 4;
+                break;
+            }
+            case DL_CIRCLE: {
+                dc->DrawCircle(args[0], args[1], args[2]);
+                args += 3;
+                break;
+            }
+            case DL_ELLIPSE: {
+                dc->DrawEllipse(args[0], args[1], args[2], args[3]);
+                args += 4;
+                break;
+            }
+            case DL_ELLIPTIC_ARC: {
+                dc->DrawEllipticArc(
+                    args[0], args[1], args[2], args[3], m_doubles.at(args[4]), m_doubles.at(args[5]));
+                args += 6;
+                break;
+            }
+            case DL_LINE: {
+                dc->DrawLine(args[0], args[1], args[2], args[3]);
+                args += 4;
+                break;
+            }
+            case DL_POLYGON: {
+                dc->DrawPolygon(args[0], m_points.data() + args[1], args[2], args[3], args[4]);
+                args += 5;
+                break;
+            }
+            case DL_RECTANGLE: {
+                dc->DrawRectangle(args[0], args[1], args[2], args[3]);
+                args += 4;
+                break;
+            }
+            case DL_ROTATED_TEXT: {
+                dc->DrawRotatedText(m_strings.at(args[0]), args[1], args[2], m_doubles.at(args[3]));
+                args += 4;
+                break;
+            }
+            case DL_ROUNDED_RECTANGLE: {
+                dc->DrawRoundedRectangle(args[0], args[1], args[2], args[3], args[4]);
+                args += 5;
+                break;
+            }
+            case DL_TEXT: {
+                dc->DrawText(m_strings.at(args[0]), m_wstrings.at(args[1]), args[2], args[3], args[4], args[5]);
+                args += 6;
+                break;
+            }
+            case DL_MUSIC_TEXT: {
+                dc->DrawMusicText(m_wstrings.at(args[0]), args[1], args[2], (args[3] != 0));
+                args += 4;
+                break;
+            }
+            case DL_SPLINE: {
+                dc->DrawSpline(args[0], m_points.data() + args[1]);
+                args += 2;
+                break;
+            }
+            case DL_SVG_SHAPE: {
+                dc->DrawSvgShape(args[0], args[1], args[2], args[3], m_svgShapes.at(args[4]));
+                args += 5;
+                break;
+            }
+            case DL_BACKGROUND_IMAGE_DRAW: {
+                dc->DrawBackgroundImage(args[0], args[1]);
+                args += 2;
+                break;
+            }
+            case DL_PLACEHOLDER: {
+                dc->DrawPlaceholder(args[0], args[1]);
+                args += 2;
+                break;
+            }
+            case DL_START_TEXT: {
+                dc->StartText(args[0], args[1], (data_HORIZONTALALIGNMENT)args[2]);
+                args += 3;
+                break;
+            }
+            case DL_END_TEXT: dc->EndText(); break;
+            case DL_MOVE_TEXT_TO: {
+                dc->MoveTextTo(args[0], args[1], (data_HORIZONTALALIGNMENT)args[2]);
+                args += 3;
+                break;
+            }
+            case DL_MOVE_TEXT_VERTICALLY_TO: dc->MoveTextVerticallyTo(*args++); break;
+            case DL_START_GRAPHIC: {
+                dc->StartGraphic(m_objects.at(args[0]), m_strings.at(args[1]), m_strings.at(args[2]), (args[3] != 0),
+                    (args[4] != 0));
+                args += 5;
+                break;
+            }
+            case DL_END_GRAPHIC: {
+                dc->EndGraphic(m_objects.at(args[0]), m_views.at(args[1]));
+                args += 2;
+                break;
+            }
+            case DL_START_CUSTOM_GRAPHIC: {
+                dc->StartCustomGraphic(m_strings.at(args[0]), m_strings.at(args[1]), m_strings.at(args[2]));
+                args += 3;
+                break;
+            }
+            case DL_END_CUSTOM_GRAPHIC: dc->EndCustomGraphic(); break;
+            case DL_RESUME_GRAPHIC: {
+                dc->ResumeGraphic(m_objects.at(args[0]), m_strings.at(args[1]));
+                args += 2;
+                break;
+            }
+            case DL_END_RESUMED_GRAPHIC: {
+                dc->EndResumedGraphic(m_objects.at(args[0]), m_views.at(args[1]));
+                args += 2;
+                break;
+            }
+            case DL_START_TEXT_GRAPHIC: {
+                dc->StartTextGraphic(m_objects.at(args[0]), m_strings.at(args[1]), m_strings.at(args[2]));
+                args += 3;
+                break;
+            }
+            case DL_END_TEXT_GRAPHIC: {
+                dc->EndTextGraphic(m_objects.at(args[0]), m_views.at(args[1]));
+                args += 2;
+                break;
+            }
+            case DL_ROTATE_GRAPHIC: {
+                dc->RotateGraphic(m_points.at(args[1]), m_doubles.at(args[2]));
+                args += 3;
+                break;
+            }
+            case DL_START_PAGE: dc->StartPage(); break;
+            case DL_END_PAGE: dc->EndPage(); break;
+            case DL_DESCRIPTION: dc->AddDescription(m_strings.at(*args++)); break;
+            default: LogError("Unknown display list operation %d", operation); return;
+        }
+    }
+
+    // Leave the device context with the pen, brush and font it had
+    if (hasPen) dc->ResetPen();
+    if (hasBrush) dc->ResetBrush();
+    if (hasFont) dc->ResetFont();
+    if (deactivation != 0) dc->ReactivateGraphic();
+}
+
+void DisplayListDeviceContext::SetBackground(int colour, int style)
+{
+    this->AddOperation(DL_BACKGROUND);
+    this->AddInt(colour);
+    this->AddInt(style);
+}
+
+void DisplayListDeviceContext::SetBackgroundImage(void *image, double opacity)
+{
+    this->AddOperation(DL_BACKGROUND_IMAGE);
+    this->AddInt((int)m_images.size());
+    m_images.push_back(image);
+    this->AddDouble(opacity);
+}
+
+void DisplayListDeviceContext::SetBackgroundMode(int mode)
+{
+    this->AddOperation(DL_BACKGROUND_MODE);
+    this->AddInt(mode);
+}
+
+void DisplayListDeviceContext::SetTextForeground(int colour)
+{
+    this->AddOperation(DL_TEXT_FOREGROUND);
+    this->AddInt(colour);
+}
+
+void DisplayListDeviceContext::SetTextBackground(int colour)
+{
+    this->AddOperation(DL_TEXT_BACKGROUND);
+    this->AddInt(colour);
+}
+
+void DisplayListDeviceContext::SetLogicalOrigin(int x, int y)
+{
+    m_logicalOrigin = Point(x, y);
+
+    this->AddOperation(DL_LOGICAL_ORIGIN);
+    this->AddInt(x);
+    this->AddInt(y);
+}
+
+Point DisplayListDeviceContext::GetLogicalOrigin()
+{
+    return m_logicalOrigin;
+}
+
+void DisplayListDeviceContext::DrawSimpleBezierPath(Point bezier[4])
+{
+    this->AddOperation(DL_SIMPLE_BEZIER_PATH);
+    this->AddPoints(4, bezier);
+}
+
+void DisplayListDeviceContext::DrawComplexBezierPath(Point bezier1[4], Point bezier2[4])
+{
+    this->AddOperation(DL_COMPLEX_BEZIER_PATH);
+    this->AddPoints(4, bezier1);
+    this->AddPoints(4, bezier2);
+}
+
+void DisplayListDeviceContext::DrawCircle(int x, int y, int radius)
+{
+    this->AddOperation(DL_CIRCLE);
+    this->AddInt(x);
+    this->AddInt(y);
+    this->AddInt(radius);
+}
+
+void DisplayListDeviceContext::DrawEllipse(int x, int y, int width, int height)
+{
+    this->AddOperation(DL_ELLIPSE);
+    this->AddInt(x);
+    this->AddInt(y);
+    this->AddInt(width);
+    this->AddInt(height);
+}
+
+void DisplayListDeviceContext::DrawEllipticArc(int x, int y, int width, int height, double start, double end)
+{
+    this->AddOperation(DL_ELLIPTIC_ARC);
+    this->AddInt(x);
+    this->AddInt(y);
+    this->AddInt(width);
+    this->AddInt(height);
+    this->AddDouble(start);
+    this->AddDouble(end);
+}
+
+void DisplayListDeviceContext::DrawLine(int x1, int y1, int x2, int y2)
+{
+    this->AddOperation(DL_LINE);
+    this->AddInt(x1);
+    this->AddInt(y1);
+    this->AddInt(x2);
+    this->AddInt(y2);
+}
+
+void DisplayListDeviceContext::DrawPolygon(int n, Point points[], int xOffset, int yOffset, int fillStyle)
+{
+    this->AddOperation(DL_POLYGON);
+    this->AddPoints(n, points);
+    this->AddInt(xOffset);
+    this->AddInt(yOffset);
+    this->AddInt(fillStyle);
+}
+
+void DisplayListDeviceContext::DrawRectangle(int x, int y, int width, int height)
+{
+    this->AddOperation(DL_RECTANGLE);
+    this->AddInt(x);
+    this->AddInt(y);
+    this->AddInt(width);
+    this->AddInt(height);
+}
+
+void DisplayListDeviceContext::DrawRotatedText(const std::string &text, int x, int y, double angle)
+{
+    this->AddOperation(DL_ROTATED_TEXT);
+    this->AddString(text);
+    this->AddInt(x);
+    this->AddInt(y);
+    this->AddDouble(angle);
+}
+
+void DisplayListDeviceContext::DrawRoundedRectangle(int x, int y, int width, int height, int radius)
+{
+    this->AddOperation(DL_ROUNDED_RECTANGLE);
+    this->AddInt(x);
+    this->AddInt(y);
+    this->AddInt(width);
+    this->AddInt(height);
+    this->AddInt(radius);
+}
+
+void DisplayListDeviceContext::DrawText(
+    const std::string &text, const std::wstring wtext, int x, int y, int width, int height)
+{
+    this->AddOperation(DL_TEXT);
+    this->AddString(text);
+    this->AddWString(wtext);
+    this->AddInt(x);
+    this->AddInt(y);
+    this->AddInt(width);
+    this->AddInt(height);
+}
+
+void DisplayListDeviceContext::DrawMusicText(const std::wstring &text, int x, int y, bool setSmuflGlyph)
+{
+    this->AddOperation(DL_MUSIC_TEXT);
+    this->AddWString(text);
+    this->AddInt(x);
+    this->AddInt(y);
+    this->AddInt(setSmuflGlyph);
+}
+
+void DisplayListDeviceContext::DrawSpline(int n, Point points[])
+{
+    this->AddOperation(DL_SPLINE);
+    this->AddPoints(n, points);
+}
+
+void DisplayListDeviceContext::DrawSvgShape(int x, int y, int width, int height, pugi::xml_node svg)
+{
+    this->AddOperation(DL_SVG_SHAPE);
+    this->AddInt(x);
+    this->AddInt(y);
+    this->AddInt(width);
+    this->AddInt(height);
+    this->AddInt((int)m_svgShapes.size());
+    m_svgShapes.push_back(svg);
+}
+
+void DisplayListDeviceContext::DrawBackgroundImage(int x, int y)
+{
+    this->AddOperation(DL_BACKGROUND_IMAGE_DRAW);
+    this->AddInt(x);
+    this->AddInt(y);
+}
+
+void DisplayListDeviceContext::DrawPlaceholder(int x, int y)
+{
+    this->AddOperation(DL_PLACEHOLDER);
+    this->AddInt(x);
+    this->AddInt(y);
+}
+
+void DisplayListDeviceContext::StartText(int x, int y, data_HORIZONTALALIGNMENT alignment)
+{
+    this->AddOperation(DL_START_TEXT);
+    this->AddInt(x);
+    this->AddInt(y);
+    this->AddInt(alignment);
+}
+
+void DisplayListDeviceContext::EndText()
+{
+    this->AddOperation(DL_END_TEXT);
+}
+
+void DisplayListDeviceContext::MoveTextTo(int x, int y, data_HORIZONTALALIGNMENT alignment)
+{
+    this->AddOperation(DL_MOVE_TEXT_TO);
+    this->AddInt(x);
+    this->AddInt(y);
+    this->AddInt(alignment);
+}
+
+void DisplayListDeviceContext::MoveTextVerticallyTo(int y)
+{
+    this->AddOperation(DL_MOVE_TEXT_VERTICALLY_TO);
+    this->AddInt(y);
+}
+
+void DisplayListDeviceContext::StartGraphic(
+    Object *object, std::string gClass, std::string gId, bool primary, bool prepend)
+{
+    this->AddOperation(DL_START_GRAPHIC);
+    this->AddObject(object);
+    this->AddString(gClass);
+    this->AddString(gId);
+    this->AddInt(primary);
+    this->AddInt(prepend);
+}
+
+void DisplayListDeviceContext::EndGraphic(Object *object, View *view)
+{
+    this->AddOperation(DL_END_GRAPHIC);
+    this->AddEndedObject(object);
+    this->AddView(view);
+}
+
+void DisplayListDeviceContext::StartCustomGraphic(std::string name, std::string gClass, std::string gId)
+{
+    this->AddOperation(DL_START_CUSTOM_GRAPHIC);
+    this->AddString(name);
+    this->AddString(gClass);
+    this->AddString(gId);
+}
+
+void DisplayListDeviceContext::EndCustomGraphic()
+{
+    this->AddOperation(DL_END_CUSTOM_GRAPHIC);
+}
+
+void DisplayListDeviceContext::ResumeGraphic(Object *object, std::string gId)
+{
+    this->AddOperation(DL_RESUME_GRAPHIC);
+    this->AddObject(object);
+    this->AddString(gId);
+}
+
+void DisplayListDeviceContext::EndResumedGraphic(Object *object, View *view)
+{
+    this->AddOperation(DL_END_RESUMED_GRAPHIC);
+    this->AddEndedObject(object);
+    this->AddView(view);
+}
+
+void DisplayListDeviceContext::StartTextGraphic(Object *object, std::string gClass, std::string gId)
+{
+    this->AddOperation(DL_START_TEXT_GRAPHIC);
+    this->AddObject(object);
+    this->AddString(gClass);
+    this->AddString(gId);
+}
+
+void DisplayListDeviceContext::EndTextGraphic(Object *object, View *view)
+{
+    this->AddOperation(DL_END_TEXT_GRAPHIC);
+    this->AddEndedObject(object);
+    this->AddView(view);
+}
+
+void DisplayListDeviceContext::RotateGraphic(Point const &orig, double angle)
+{
+    this->AddOperation(DL_ROTATE_GRAPHIC);
+    this->AddPoints(1, &orig);
+    this->AddDouble(angle);
+}
+
+void DisplayListDeviceContext::StartPage()
+{
+    this->AddOperation(DL_START_PAGE);
+}
+
+void DisplayListDeviceContext::EndPage()
+{
+    this->AddOperation(DL_END_PAGE);
+}
+
+void DisplayListDeviceContext::AddDescription(const std::string &text)
+{
+    this->AddOperation(DL_DESCRIPTION);
+    this->AddString(text);
+}
+
+} // namespace vrv
@@ -9,13 +9,17 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <assert.h>
 #include <math.h>
+#include <string.h>
 
 //----------------------------------------------------------------------------
 
+#include "app.h"
 #include "barline.h"
 #include "beatrpt.h"
+#include "choice.h"
 #include "chord.h"
 #include "comparison.h"
 #include "expansion.h"
@@ -50,6 +54,7 @@
 #include "staff.h"
 #include "staffdef.h"
 #include "staffgrp.h"
+#include "subst.h"
 #include "syl.h"
 #include "syllable.h"
 #include "system.h"
@@ -64,6 +69,10 @@
 
 #include "MidiFile.h"
 
+// The number of measures laid out horizontally and of systems laid out vertically at once with a progressive cast-off
+#define CASTOFF_CHUNK_MEASURES 16
+#define CASTOFF_CHUNK_SYSTEMS 8
+
 namespace vrv {
 
 //----------------------------------------------------------------------------
@@ -73,17 +82,27 @@ namespace vrv {
 Doc::Doc() : Object("doc-")
 {
     m_options = new Options();
+    m_castOffContentPage = NULL;
+    m_castOffSystemsParams = NULL;
+    m_castOffPagesParams = NULL;
+    m_castOffSystemsScoreDefParams = NULL;
+    m_castOffPagesScoreDefParams = NULL;
+    m_castOffCurrentScoreDef = NULL;
 
     Reset();
 }
 
 Doc::~Doc()
 {
+    this->ClearCastOffProgress();
     delete m_options;
 }
 
 void Doc::Reset()
 {
+    // The content page is owned by the pages and deleted by Object::Reset
+    this->ClearCastOffProgress();
+
     Object::Reset();
 
     m_type = Raw;
@@ -109,8 +128,23 @@ void Doc::Reset()
     m_drawingPreparationDone = false;
     m_MIDITimemapTempo = 0.0;
     m_markup = MARKUP_DEFAULT;
+    m_markupConversionDone = false;
     m_isMensuralMusicOnly = false;
 
+    m_castOffX = 0;
+    m_castOffShift = 0;
+    m_castOffPrevBottomOverflow = 0;
+    m_castOffScoreDefPage = 0;
+    m_castOffScoreDefSystem = 0;
+
+    m_hasCachedHorizontalLayout = false;
+    m_useCachedHorizontalLayout = false;
+    m_cachedScoreDefWidth = 0;
+    m_cachedLabelsWidth = 0;
+    m_cachedAbbrLabelsWidth = 0;
+
+    m_textExtentCache.Reset();
+
     m_mdivScoreDef.Reset();
 
     m_drawingSmuflFontSize = 0;
@@ -119,6 +153,7 @@ void Doc::Reset()
     m_header.reset();
     m_front.reset();
     m_back.reset();
+    m_selectionSkeleton.reset();
 }
 
 void Doc::SetType(DocType type)
@@ -273,7 +308,8 @@ void Doc::CalculateMidiTimemap()
     calcMaxMeasureDurationParams.m_currentTempo = tempo;
     calcMaxMeasureDurationParams.m_tempoAdjustment = m_options->m_midiTempoAdjustment.GetValue();
     Functor calcMaxMeasureDuration(&Object::CalcMaxMeasureDuration);
-    this->Process(&calcMaxMeasureDuration, &calcMaxMeasureDurationParams);
+    this->ProcessPerformance(
+        &calcMaxMeasureDuration, &calcMaxMeasureDurationParams, calcMaxMeasureDurationParams.m_repeat);
 
     // Then calculate the onset and offset times (w.r.t. the measure) for every note
     CalcOnsetOffsetParams calcOnsetOffsetParams;
@@ -288,6 +324,22 @@ void Doc::CalculateMidiTimemap()
     m_MIDITimemapTempo = m_options->m_midiTempoAdjustment.GetValue();
 }
 
+void Doc::ProcessPerformance(
+    Functor *functor, FunctorParams *functorParams, int &repeat, Functor *endFunctor, ArrayOfComparisons *filters)
+{
+    if (!m_expansionMap.HasReferences()) {
+        repeat = 1;
+        this->Process(functor, functorParams, endFunctor, filters);
+        return;
+    }
+
+    std::map<Object *, int> repeats;
+    for (Object *measure : m_expansionMap.GetReferences()) {
+        repeat = ++repeats[measure];
+        measure->Process(functor, functorParams, endFunctor, filters);
+    }
+}
+
 void Doc::ExportMIDI(smf::MidiFile *midiFile)
 {
 
@@ -388,12 +440,12 @@ void Doc::ExportMIDI(smf::MidiFile *midiFile)
             generateMIDIParams.m_currentTempo = tempo;
 
             // LogDebug("Exporting track %d ----------------", midiTrack);
-            this->Process(&generateMIDI, &generateMIDIParams, NULL, &filters);
+            this->ProcessPerformance(&generateMIDI, &generateMIDIParams, generateMIDIParams.m_repeat, NULL, &filters);
         }
     }
 }
 
-bool Doc::ExportTimemap(std::string &output)
+bool Doc::ExportTimemap(std::string &output, bool binary)
 {
     if (!Doc::HasMidiTimemap()) {
         // generate MIDI timemap before progressing
@@ -406,86 +458,205 @@ bool Doc::ExportTimemap(std::string &output)
     }
     Functor generateTimemap(&Object::GenerateTimemap);
     GenerateTimemapParams generateTimemapParams(&generateTimemap);
-    this->Process(&generateTimemap, &generateTimemapParams);
+    this->ProcessPerformance(&generateTimemap, &generateTimemapParams, generateTimemapParams.m_repeat);
 
-    PrepareJsonTimemap(output, generateTimemapParams.realTimeToScoreTime, generateTimemapParams.realTimeToOnElements,
-        generateTimemapParams.realTimeToOffElements, generateTimemapParams.realTimeToTempo);
+    // The sort has to be stable for keeping the document order of the events occurring at the same time
+    ArrayOfTimemapEvents &timemapEvents = generateTimemapParams.m_timemapEvents;
+    std::stable_sort(timemapEvents.begin(), timemapEvents.end(),
+        [](const TimemapEvent &a, const TimemapEvent &b) { return a.m_realTime < b.m_realTime; });
+
+    if (binary) {
+        PrepareBinaryTimemap(output, timemapEvents);
+    }
+    else {
+        PrepareJsonTimemap(output, timemapEvents);
+    }
 
     return true;
 }
 
-void Doc::PrepareJsonTimemap(std::string &output, std::map<double, double> &realTimeToScoreTime,
-    std::map<double, std::vector<std::string> > &realTimeToOnElements,
-    std::map<double, std::vector<std::string> > &realTimeToOffElements, std::map<double, int> &realTimeToTempo)
+static std::string GetTimemapUuid(const TimemapEvent &event)
 {
+    // With an expansion by reference, the repeats get the uuid listed for them in the expansion map
+    if (event.m_repeat > 1) return event.m_object->GetUuid() + "-rend" + std::to_string(event.m_repeat);
+    return event.m_object->GetUuid();
+}
 
+void Doc::PrepareJsonTimemap(std::string &output, const ArrayOfTimemapEvents &timemapEvents)
+{
     int currentTempo = -1000;
-    int newTempo;
-    int mapsize = (int)realTimeToScoreTime.size();
     output = "";
-    output.reserve(mapsize * 100); // Estimate 100 characters for each entry.
+    // Estimate 50 characters for each event (i.e., 100 for each note)
+    output.reserve(timemapEvents.size() * 50);
     output += "[\n";
-    auto lastit = realTimeToScoreTime.end();
-    lastit--;
-    for (auto it = realTimeToScoreTime.begin(); it != realTimeToScoreTime.end(); ++it) {
+    auto it = timemapEvents.begin();
+    while (it != timemapEvents.end()) {
+        // Look for the events with the same real time - the last one gives the score time and the tempo
+        auto groupEnd = it;
+        double scoreTime = it->m_scoreTime;
+        int tempo = VRV_UNSET;
+        bool hasOn = false;
+        bool hasOff = false;
+        for (; (groupEnd != timemapEvents.end()) && (groupEnd->m_realTime == it->m_realTime); ++groupEnd) {
+            scoreTime = groupEnd->m_scoreTime;
+            if (groupEnd->m_isOn) {
+                tempo = groupEnd->m_tempo;
+                hasOn = true;
+            }
+            else {
+                hasOff = true;
+            }
+        }
+
         output += "\t{\n";
         output += "\t\t\"tstamp\":\t";
-        output += std::to_string(it->first);
+        output += std::to_string(it->m_realTime);
         output += ",\n";
         output += "\t\t\"qstamp\":\t";
-        output += std::to_string(it->second);
-
-        auto ittempo = realTimeToTempo.find(it->first);
-        if (ittempo != realTimeToTempo.end()) {
-            newTempo = ittempo->second;
-            if (newTempo != currentTempo) {
-                currentTempo = newTempo;
-                output += ",\n\t\t\"tempo\":\t";
-                output += std::to_string(currentTempo);
-            }
+        output += std::to_string(scoreTime);
+
+        if (hasOn && (tempo != currentTempo)) {
+            currentTempo = tempo;
+            output += ",\n\t\t\"tempo\":\t";
+            output += std::to_string(currentTempo);
         }
 
-        auto iton = realTimeToOnElements.find(it->first);
-        if (iton != realTimeToOnElements.end()) {
+        if (hasOn) {
             output += ",\n\t\t\"on\":\t[";
-            for (int ion = 0; ion < (int)iton->second.size(); ++ion) {
+            bool first = true;
+            for (auto event = it; event != groupEnd; ++event) {
+                if (!event->m_isOn) continue;
+                if (!first) output += ", ";
                 output += "\"";
-                output += iton->second[ion];
+                output += GetTimemapUuid(*event);
                 output += "\"";
-                if (ion < (int)iton->second.size() - 1) {
-                    output += ", ";
-                }
+                first = false;
             }
             output += "]";
         }
 
-        auto itoff = realTimeToOffElements.find(it->first);
-        if (itoff != realTimeToOffElements.end()) {
+        if (hasOff) {
             output += ",\n\t\t\"off\":\t[";
-            for (int ioff = 0; ioff < (int)itoff->second.size(); ++ioff) {
+            bool first = true;
+            for (auto event = it; event != groupEnd; ++event) {
+                if (event->m_isOn) continue;
+                if (!first) output += ", ";
                 output += "\"";
-                output += itoff->second[ioff];
+                output += GetTimemapUuid(*event);
                 output += "\"";
-                if (ioff < (int)itoff->second.size() - 1) {
-                    output += ", ";
-                }
+                first = false;
             }
             output += "]";
         }
 
         output += "\n\t}";
-        if (it == lastit) {
-            output += "\n";
-        }
-        else {
-            output += ",\n";
-        }
+        it = groupEnd;
+        output += (it == timemapEvents.end()) ? "\n" : ",\n";
     }
     output += "]\n";
 }
 
+static void AppendTimemapInt(std::string &output, uint32_t value)
+{
+    // Little endian, independently from the platform
+    for (int i = 0; i < 4; ++i) {
+        output.push_back((char)((value >> (8 * i)) & 0xFF));
+    }
+}
+
+static void AppendTimemapDouble(std::string &output, double value)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(double));
+    for (int i = 0; i < 8; ++i) {
+        output.push_back((char)((bits >> (8 * i)) & 0xFF));
+    }
+}
+
+void Doc::PrepareBinaryTimemap(std::string &output, const ArrayOfTimemapEvents &timemapEvents)
+{
+    // The binary timemap is made of little endian values that can be read as typed arrays:
+    // - header (8 uint32): "VTM1", entry count (N), uuid count (U), on count, off count, tempo count (T),
+    //   uuid table size in bytes, 0 (padding for keeping the float64 arrays aligned)
+    // - tstamp: float64[N] - real times in ms
+    // - qstamp: float64[N] - score times in quarter notes
+    // - on index: uint32[N + 1] - the on uuids of entry i are on[onIndex[i]] to on[onIndex[i + 1] - 1]
+    // - on: uint32[on count] - indexes in the uuid table
+    // - off index: uint32[N + 1] and off: uint32[off count] - same as for on
+    // - tempo entries: uint32[T] - indexes of the entries where the tempo changes
+    // - tempo values: uint32[T]
+    // - uuid table: U null-terminated strings, each uuid appearing only once
+    std::vector<double> realTimes;
+    std::vector<double> scoreTimes;
+    std::vector<uint32_t> onIndex;
+    std::vector<uint32_t> on;
+    std::vector<uint32_t> offIndex;
+    std::vector<uint32_t> off;
+    std::vector<uint32_t> tempoEntries;
+    std::vector<uint32_t> tempoValues;
+    std::map<std::pair<Object *, int>, uint32_t> uuidIndexes;
+    std::string uuidTable;
+
+    int currentTempo = -1000;
+    auto it = timemapEvents.begin();
+    while (it != timemapEvents.end()) {
+        const uint32_t entry = (uint32_t)realTimes.size();
+        onIndex.push_back((uint32_t)on.size());
+        offIndex.push_back((uint32_t)off.size());
+        double scoreTime = it->m_scoreTime;
+        int tempo = VRV_UNSET;
+        auto groupEnd = it;
+        for (; (groupEnd != timemapEvents.end()) && (groupEnd->m_realTime == it->m_realTime); ++groupEnd) {
+            scoreTime = groupEnd->m_scoreTime;
+            // Intern the uuid
+            auto inserted = uuidIndexes.insert(
+                { { groupEnd->m_object, groupEnd->m_repeat }, (uint32_t)uuidIndexes.size() });
+            if (inserted.second) {
+                uuidTable += GetTimemapUuid(*groupEnd);
+                uuidTable.push_back('\0');
+            }
+            if (groupEnd->m_isOn) {
+                tempo = groupEnd->m_tempo;
+                on.push_back(inserted.first->second);
+            }
+            else {
+                off.push_back(inserted.first->second);
+            }
+        }
+        if ((tempo != VRV_UNSET) && (tempo != currentTempo)) {
+            currentTempo = tempo;
+            tempoEntries.push_back(entry);
+            tempoValues.push_back((uint32_t)tempo);
+        }
+        realTimes.push_back(it->m_realTime);
+        scoreTimes.push_back(scoreTime);
+        it = groupEnd;
+    }
+    onIndex.push_back((uint32_t)on.size());
+    offIndex.push_back((uint32_t)off.size());
+
+    output = "VTM1";
+    output.reserve(32 + realTimes.size() * 24 + (on.size() + off.size()) * 4 + uuidTable.size());
+    AppendTimemapInt(output, (uint32_t)realTimes.size());
+    AppendTimemapInt(output, (uint32_t)uuidIndexes.size());
+    AppendTimemapInt(output, (uint32_t)on.size());
+    AppendTimemapInt(output, (uint32_t)off.size());
+    AppendTimemapInt(output, (uint32_t)tempoEntries.size());
+    AppendTimemapInt(output, (uint32_t)uuidTable.size());
+    AppendTimemapInt(output, 0);
+    for (double value : realTimes) AppendTimemapDouble(output, value);
+    for (double value : scoreTimes) AppendTimemapDouble(output, value);
+    for (const std::vector<uint32_t> *values : { &onIndex, &on, &offIndex, &off, &tempoEntries, &tempoValues }) {
+        for (uint32_t value : *values) AppendTimemapInt(output, value);
+    }
+    output += uuidTable;
+}
+
 void Doc::PrepareDrawing()
 {
+    // The content has to be laid out again
+    m_hasCachedHorizontalLayout = false;
+
     if (m_drawingPreparationDone) {
         Functor resetDrawing(&Object::ResetDrawing);
         this->Process(&resetDrawing, NULL);
@@ -845,7 +1016,24 @@ void Doc::CastOffDocBase(bool useSb, bool usePb)
 
     Page *contentPage = this->SetDrawingPage(0);
     assert(contentPage);
-    contentPage->LayOutHorizontally();
+
+    const bool progressive = m_options->m_progressiveCastOff.GetValue();
+    // With a progressive cast-off, the measures are laid out horizontally and cast off into systems by chunks
+    const bool progressiveSystems = progressive && !(useSb && !usePb);
+
+    // The horizontal layout of the content page does not depend on the page size
+    CacheHorizontalLayoutParams cacheHorizontalLayoutParams(false, m_options->GetHorizontalLayoutHash());
+    Functor cacheHorizontalLayout(&Object::CacheHorizontalLayout);
+    if (!m_useCachedHorizontalLayout && !progressiveSystems) {
+        contentPage->LayOutHorizontally();
+        contentPage->Process(&cacheHorizontalLayout, &cacheHorizontalLayoutParams);
+        System *system = vrv_cast<System *>(contentPage->GetChild(0));
+        assert(system);
+        m_cachedScoreDefWidth = contentPage->m_drawingScoreDef.GetDrawingWidth();
+        m_cachedLabelsWidth = system->GetDrawingLabelsWidth();
+        m_cachedAbbrLabelsWidth = system->GetDrawingAbbrLabelsWidth();
+        m_hasCachedHorizontalLayout = true;
+    }
 
     System *contentSystem = vrv_cast<System *>(contentPage->DetachChild(0));
     assert(contentSystem);
@@ -853,37 +1041,100 @@ void Doc::CastOffDocBase(bool useSb, bool usePb)
     System *currentSystem = new System();
     contentPage->AddChild(currentSystem);
 
-    if (useSb && !usePb) {
-        CastOffEncodingParams castOffEncodingParams(this, contentPage, currentSystem, contentSystem, false);
+    bool optimize = IsOptimizationNeeded();
 
-        Functor castOffEncoding(&Object::CastOffEncoding);
-        contentSystem->Process(&castOffEncoding, &castOffEncodingParams);
+    if (progressiveSystems) {
+        // The content system is kept as last child of the content page, see Doc::CastOffSystemsChunk
+        contentPage->AddChild(contentSystem);
+        m_castOffSystemsParams = new CastOffSystemsParams(NULL, contentPage, currentSystem, this);
+        m_castOffSystemsParams->m_systemWidth
+            = this->m_drawingPageContentWidth - currentSystem->m_systemLeftMar - currentSystem->m_systemRightMar;
+        if (m_useCachedHorizontalLayout) {
+            m_castOffSystemsParams->m_shift = -m_cachedLabelsWidth;
+            m_castOffSystemsParams->m_currentScoreDefWidth = m_cachedScoreDefWidth + m_cachedAbbrLabelsWidth;
+            m_castOffSystemsParams->m_useCachedLayout = true;
+        }
+        m_castOffX = VRV_UNSET;
+        // The cache of the horizontal layout is valid only once all the measures are laid out
+        if (!m_useCachedHorizontalLayout) m_hasCachedHorizontalLayout = false;
+        // The scoreDef is set to the systems once they are complete, starting with the content page as first page
+        m_castOffSystemsScoreDefParams = new SetCurrentScoreDefParams(this, new ScoreDef(m_mdivScoreDef));
+        Functor setCurrentScoreDef(&Object::SetCurrentScoreDef);
+        m_castOffSystemsScoreDefParams->m_upcomingScoreDef->Process(
+            &setCurrentScoreDef, m_castOffSystemsScoreDefParams);
+        contentPage->SetCurrentScoreDef(m_castOffSystemsScoreDefParams);
     }
     else {
-        CastOffSystemsParams castOffSystemsParams(contentSystem, contentPage, currentSystem, this);
-        castOffSystemsParams.m_systemWidth
-            = this->m_drawingPageContentWidth - currentSystem->m_systemLeftMar - currentSystem->m_systemRightMar;
-        castOffSystemsParams.m_shift = -contentSystem->GetDrawingLabelsWidth();
-        castOffSystemsParams.m_currentScoreDefWidth
-            = contentPage->m_drawingScoreDef.GetDrawingWidth() + contentSystem->GetDrawingAbbrLabelsWidth();
+        const bool useCachedLayout = m_useCachedHorizontalLayout;
+        m_useCachedHorizontalLayout = false;
 
-        Functor castOffSystems(&Object::CastOffSystems);
-        Functor castOffSystemsEnd(&Object::CastOffSystemsEnd);
-        contentSystem->Process(&castOffSystems, &castOffSystemsParams, &castOffSystemsEnd);
-    }
-    delete contentSystem;
+        if (useSb && !usePb) {
+            CastOffEncodingParams castOffEncodingParams(this, contentPage, currentSystem, contentSystem, false);
 
-    bool optimize = IsOptimizationNeeded();
-    // Reset the scoreDef at the beginning of each system
-    this->SetCurrentScoreDefDoc(true);
-    if (optimize) {
-        this->OptimizeScoreDefDoc();
+            Functor castOffEncoding(&Object::CastOffEncoding);
+            contentSystem->Process(&castOffEncoding, &castOffEncodingParams);
+        }
+        else {
+            CastOffSystemsParams castOffSystemsParams(contentSystem, contentPage, currentSystem, this);
+            castOffSystemsParams.m_systemWidth
+                = this->m_drawingPageContentWidth - currentSystem->m_systemLeftMar - currentSystem->m_systemRightMar;
+            castOffSystemsParams.m_shift = -m_cachedLabelsWidth;
+            castOffSystemsParams.m_currentScoreDefWidth = m_cachedScoreDefWidth + m_cachedAbbrLabelsWidth;
+            castOffSystemsParams.m_useCachedLayout = useCachedLayout;
+
+            Functor castOffSystems(&Object::CastOffSystems);
+            Functor castOffSystemsEnd(&Object::CastOffSystemsEnd);
+            contentSystem->Process(&castOffSystems, &castOffSystemsParams, &castOffSystemsEnd);
+        }
+        delete contentSystem;
+
+        // Reset the scoreDef at the beginning of each system
+        this->SetCurrentScoreDefDoc(true);
+        if (optimize) {
+            this->OptimizeScoreDefDoc();
+        }
+
+        // Here we redo the alignment because of the new scoreDefs
+        // We can actually optimise this and have a custom version that does not redo all the calculation
+        // Because of the new scoreDef, we need to reset cached drawingX
+        contentPage->ResetCachedDrawingX();
+    }
+
+    if (progressive) {
+        // Detach the contentPage and keep it for laying out its systems vertically by chunks
+        pages->DetachChild(0);
+        assert(contentPage && !contentPage->GetParent());
+        this->ResetDrawingPage();
+
+        Page *currentPage = new Page();
+        m_castOffPagesParams = new CastOffPagesParams(NULL, this, currentPage);
+        CastOffRunningElements(m_castOffPagesParams);
+        m_castOffPagesParams->m_pageHeight = this->m_drawingPageContentHeight;
+        pages->AddChild(currentPage);
+
+        // The position of the first system is the one Page::AlignSystems gives it on the first page
+        m_castOffShift = this->m_drawingPageContentHeight;
+        RunningElement *header = currentPage->GetHeader();
+        if (header) {
+            m_castOffShift -= header->GetTotalHeight()
+                + m_options->m_bottomMarginPgHead.GetValue() * this->GetDrawingUnit(100);
+        }
+        m_castOffPrevBottomOverflow = VRV_UNSET;
+
+        // The scoreDef is set again to the systems once they are on a page
+        m_castOffPagesScoreDefParams = new SetCurrentScoreDefParams(this, new ScoreDef(m_mdivScoreDef));
+        Functor setCurrentScoreDef(&Object::SetCurrentScoreDef);
+        m_castOffPagesScoreDefParams->m_upcomingScoreDef->Process(&setCurrentScoreDef, m_castOffPagesScoreDefParams);
+        m_castOffScoreDefPage = 0;
+        m_castOffScoreDefSystem = 0;
+
+        // The content page is added back as last page until all systems are cast off
+        m_castOffContentPage = contentPage;
+        pages->AddChild(contentPage);
+        this->ContinueCastOffDoc(0);
+        return;
     }
 
-    // Here we redo the alignment because of the new scoreDefs
-    // We can actually optimise this and have a custom version that does not redo all the calculation
-    // Because of the new scoreDef, we need to reset cached drawingX
-    contentPage->ResetCachedDrawingX();
     contentPage->LayOutVertically();
 
     // Detach the contentPage
@@ -906,6 +1157,325 @@ void Doc::CastOffDocBase(bool useSb, bool usePb)
     }
 }
 
+void Doc::ContinueCastOffDoc(int pageIdx)
+{
+    if (!m_castOffContentPage) return;
+
+    Pages *pages = this->GetPages();
+    assert(pages);
+
+    // Detach the content page so the new pages are added before it
+    assert(pages->GetLast() == m_castOffContentPage);
+    pages->DetachChild(m_castOffContentPage->GetIdx());
+    this->ResetDrawingPage();
+
+    const int systemMargin = m_options->m_spacingSystem.GetValue() * this->GetDrawingUnit(100);
+    Functor castOffPages(&Object::CastOffPages);
+
+    // The page is complete once a system has been added to the next one
+    while (m_castOffContentPage->GetChildCount()
+        && ((pageIdx == VRV_UNSET) || (pages->GetChildCount() <= pageIdx + 1))) {
+        // Cast off the next measures into systems until we have enough systems for laying them out vertically
+        while (m_castOffSystemsParams && (this->GetCastOffReadySystemCount() < CASTOFF_CHUNK_SYSTEMS)) {
+            this->CastOffSystemsChunk();
+        }
+        const int readySystems = this->GetCastOffReadySystemCount();
+        if (readySystems == 0) break;
+
+        // Move the next systems to a page on which we can do the vertical layout
+        Page *chunkPage = new Page();
+        for (int i = 0; (i < CASTOFF_CHUNK_SYSTEMS) && (i < readySystems); ++i) {
+            chunkPage->AddChild(m_castOffContentPage->DetachChild(0));
+        }
+        // The chunk is laid out as the first page, as the content page is when the document is cast off at once
+        chunkPage->SetParent(pages);
+        pages->InsertChild(chunkPage, 0);
+        this->SetDrawingPage(0);
+        chunkPage->LayOutVertically();
+        pages->DetachChild(0);
+        this->ResetDrawingPage();
+
+        // Page::AlignSystems started the chunk without a system margin - move the systems to where they are when
+        // the whole content page is laid out at once, which is what System::CastOffPages expects.
+        System *first = vrv_cast<System *>(chunkPage->GetChild(0));
+        assert(first);
+        int shift = m_castOffShift;
+        if (m_castOffPrevBottomOverflow != VRV_UNSET) {
+            const int margin
+                = systemMargin - (m_castOffPrevBottomOverflow + first->m_systemAligner.GetOverflowAbove(this));
+            shift -= (margin > 0) ? margin : 0;
+        }
+        const int offset = shift - first->GetDrawingYRel();
+        for (auto child : *chunkPage->GetChildren()) {
+            System *system = vrv_cast<System *>(child);
+            assert(system);
+            system->SetDrawingYRel(system->GetDrawingYRel() + offset);
+        }
+        System *last = vrv_cast<System *>(chunkPage->GetLast());
+        assert(last);
+        m_castOffShift = last->GetDrawingYRel() + last->m_systemAligner.GetBottomAlignment()->GetYRel();
+        m_castOffPrevBottomOverflow = last->m_systemAligner.GetOverflowBelow(this);
+
+        m_castOffPagesParams->m_contentPage = chunkPage;
+        chunkPage->Process(&castOffPages, m_castOffPagesParams);
+        delete chunkPage;
+    }
+
+    const bool complete = (m_castOffContentPage->GetChildCount() == 0);
+    if (!complete) {
+        pages->AddChild(m_castOffContentPage);
+    }
+    else {
+        delete m_castOffContentPage;
+        m_castOffContentPage = NULL;
+    }
+
+    // Set the scoreDef of the systems added to the pages, including the ones of the last page. A page is complete
+    // only once a system has been added to the next one, which also sets its cautionary elements.
+    const int pageCount = pages->GetChildCount() - (complete ? 0 : 1);
+    while (m_castOffScoreDefPage < pageCount) {
+        Page *page = vrv_cast<Page *>(pages->GetChild(m_castOffScoreDefPage));
+        assert(page);
+        if (m_castOffScoreDefSystem == 0) page->SetCurrentScoreDef(m_castOffPagesScoreDefParams);
+        this->SetCurrentScoreDefSystems(
+            page, m_castOffScoreDefSystem, page->GetChildCount(), m_castOffPagesScoreDefParams);
+        if (m_castOffScoreDefPage == pageCount - 1) {
+            m_castOffScoreDefSystem = page->GetChildCount();
+            break;
+        }
+        ++m_castOffScoreDefPage;
+        m_castOffScoreDefSystem = 0;
+    }
+
+    if (complete) this->ClearCastOffProgress();
+}
+
+void Doc::CastOffSystemsChunk()
+{
+    assert(m_castOffContentPage);
+    assert(m_castOffSystemsParams);
+
+    System *contentSystem = vrv_cast<System *>(m_castOffContentPage->GetLast());
+    assert(contentSystem);
+    const int startIdx = m_castOffSystemsParams->m_currentSystem->GetIdx();
+    Functor castOffSystems(&Object::CastOffSystems);
+
+    if (!contentSystem->GetChildCount()) {
+        // Everything is cast off - add the pending objects as System::CastOffSystemsEnd does
+        m_castOffContentPage->DeleteChild(contentSystem);
+        for (Object *object : m_castOffSystemsParams->m_pendingObjects) {
+            m_castOffSystemsParams->m_currentSystem->AddChild(object);
+        }
+        delete m_castOffSystemsParams;
+        m_castOffSystemsParams = NULL;
+        this->SetCurrentScoreDefSystems(
+            m_castOffContentPage, startIdx, m_castOffContentPage->GetChildCount(), m_castOffSystemsScoreDefParams);
+        if (!m_useCachedHorizontalLayout) m_hasCachedHorizontalLayout = true;
+        m_useCachedHorizontalLayout = false;
+        return;
+    }
+
+    // Move the next measures to a system for laying them out on a page of their own. The chunk ends before a measure
+    // without a scoreDef for its scoreDef elements to be laid out as in the whole content. With the detection of the
+    // longest duration, the whole content is laid out at once since the spacing depends on all the measures.
+    const bool allMeasures = m_options->m_spacingDurDetection.GetValue();
+    Page *chunkPage = new Page();
+    chunkPage->m_drawingScoreDef = m_castOffContentPage->m_drawingScoreDef;
+    System *chunkSystem = new System();
+    if (contentSystem->GetDrawingScoreDef()) chunkSystem->SetDrawingScoreDef(contentSystem->GetDrawingScoreDef());
+    chunkPage->AddChild(chunkSystem);
+    int measures = 0;
+    Measure *lastMeasure = NULL;
+    while (contentSystem->GetChildCount()) {
+        Object *child = contentSystem->GetChild(0);
+        if (child->Is(MEASURE)) {
+            Measure *measure = vrv_cast<Measure *>(child);
+            assert(measure);
+            if ((measures >= CASTOFF_CHUNK_MEASURES) && !allMeasures && !measure->GetDrawingScoreDef()) break;
+            lastMeasure = measure;
+            ++measures;
+        }
+        chunkSystem->AddChild(contentSystem->DetachChild(0));
+    }
+
+    // The next measure is laid out with the chunk since the lyrics and the harmonies can widen the previous measure
+    const bool layOut = !m_useCachedHorizontalLayout;
+    int lookahead = 0;
+    if (layOut) {
+        while (lookahead < contentSystem->GetChildCount()) {
+            if (contentSystem->GetChild(lookahead++)->Is(MEASURE)) break;
+        }
+        for (int i = 0; i < lookahead; ++i) {
+            chunkSystem->AddChild(contentSystem->DetachChild(0));
+        }
+    }
+
+    if (layOut) {
+        // The staves of the measures without a scoreDef point to the one of a previous measure that can already be cast
+        // off and have its scoreDef set again - point them to the copy kept from the previous chunk
+        ScoreDef *currentScoreDef = m_castOffCurrentScoreDef;
+        for (Object *object : *chunkSystem->GetChildren()) {
+            if (!object->Is(MEASURE)) continue;
+            Measure *measure = vrv_cast<Measure *>(object);
+            assert(measure);
+            if (measure->GetDrawingScoreDef()) {
+                currentScoreDef = measure->GetDrawingScoreDef();
+                continue;
+            }
+            if (!currentScoreDef || (currentScoreDef != m_castOffCurrentScoreDef)) continue;
+            for (Object *staffObject : *measure->GetChildren()) {
+                if (!staffObject->Is(STAFF)) continue;
+                Staff *staff = vrv_cast<Staff *>(staffObject);
+                assert(staff);
+                StaffDef *staffDef = currentScoreDef->GetStaffDef(staff->GetN());
+                if (staffDef) staff->m_drawingStaffDef = staffDef;
+            }
+        }
+
+        Pages *pages = this->GetPages();
+        assert(pages);
+        chunkPage->SetParent(pages);
+        pages->InsertChild(chunkPage, 0);
+        this->SetDrawingPage(0);
+        chunkPage->LayOutHorizontally();
+        if (m_castOffX == VRV_UNSET) {
+            // This is the first chunk - the widths are the ones of the first system as in Doc::CastOffDocBase
+            m_cachedScoreDefWidth = chunkPage->m_drawingScoreDef.GetDrawingWidth();
+            m_cachedLabelsWidth = chunkSystem->GetDrawingLabelsWidth();
+            m_cachedAbbrLabelsWidth = chunkSystem->GetDrawingAbbrLabelsWidth();
+            m_castOffSystemsParams->m_shift = -m_cachedLabelsWidth;
+            m_castOffSystemsParams->m_currentScoreDefWidth = m_cachedScoreDefWidth + m_cachedAbbrLabelsWidth;
+            m_castOffX = 0;
+        }
+        // Move the measures after the ones of the previous chunks
+        for (int i = 0; i < chunkSystem->GetChildCount() - lookahead; ++i) {
+            Object *child = chunkSystem->GetChild(i);
+            if (!child->Is(MEASURE)) continue;
+            Measure *measure = vrv_cast<Measure *>(child);
+            assert(measure);
+            measure->SetDrawingXRel(measure->GetDrawingXRel() + m_castOffX);
+        }
+        if (lastMeasure) m_castOffX = lastMeasure->GetDrawingXRel() + lastMeasure->GetWidth();
+        CacheHorizontalLayoutParams cacheHorizontalLayoutParams(false, m_options->GetHorizontalLayoutHash());
+        Functor cacheHorizontalLayout(&Object::CacheHorizontalLayout);
+        chunkPage->Process(&cacheHorizontalLayout, &cacheHorizontalLayoutParams);
+        pages->DetachChild(0);
+        this->ResetDrawingPage();
+
+        // Put back the next measure
+        for (int i = 0; i < lookahead; ++i) {
+            Object *child = chunkSystem->DetachChild(chunkSystem->GetChildCount() - 1);
+            child->SetParent(contentSystem);
+            contentSystem->InsertChild(child, 0);
+        }
+
+        // Keep a copy of the scoreDef the next measures point to before it is set again with the systems
+        ScoreDef *lastScoreDef = NULL;
+        for (Object *object : *chunkSystem->GetChildren()) {
+            if (!object->Is(MEASURE)) continue;
+            Measure *measure = vrv_cast<Measure *>(object);
+            assert(measure);
+            if (measure->GetDrawingScoreDef()) lastScoreDef = measure->GetDrawingScoreDef();
+        }
+        // Assigning the previous copy would delete the staffDefs the measures of the current system can point to
+        if (lastScoreDef) {
+            m_castOffCurrentScoreDef = new ScoreDef(*lastScoreDef);
+            m_castOffScoreDefs.push_back(m_castOffCurrentScoreDef);
+        }
+    }
+
+    // The systems are added to the content page, after which the content system is moved back as last child
+    m_castOffSystemsParams->m_contentSystem = chunkSystem;
+    chunkSystem->Process(&castOffSystems, m_castOffSystemsParams);
+    delete chunkPage;
+    m_castOffContentPage->DetachChild(contentSystem->GetIdx());
+    m_castOffContentPage->AddChild(contentSystem);
+
+    // Set the scoreDef of the systems that are complete
+    this->SetCurrentScoreDefSystems(m_castOffContentPage, startIdx, m_castOffSystemsParams->m_currentSystem->GetIdx(),
+        m_castOffSystemsScoreDefParams);
+}
+
+int Doc::GetCastOffReadySystemCount()
+{
+    assert(m_castOffContentPage);
+
+    if (!m_castOffSystemsParams) return m_castOffContentPage->GetChildCount();
+
+    // The scoreDef is set to the systems before the current one, and only the last one of them can still change
+    const int readySystems = m_castOffSystemsParams->m_currentSystem->GetIdx() - 1;
+    return (readySystems > 0) ? readySystems : 0;
+}
+
+void Doc::SetCurrentScoreDefSystems(Page *page, int startIdx, int endIdx, SetCurrentScoreDefParams *params)
+{
+    assert(page);
+    assert(params);
+
+    Functor unsetCurrentScoreDef(&Object::UnsetCurrentScoreDef);
+    UnsetCurrentScoreDefParams unsetCurrentScoreDefParams(&unsetCurrentScoreDef);
+    Functor setCurrentScoreDef(&Object::SetCurrentScoreDef);
+    Functor optimizeScoreDef(&Object::OptimizeScoreDef);
+    Functor optimizeScoreDefEnd(&Object::OptimizeScoreDefEnd);
+    const bool optimize = this->IsOptimizationNeeded();
+
+    for (int i = startIdx; i < endIdx; ++i) {
+        System *system = vrv_cast<System *>(page->GetChild(i));
+        assert(system);
+        // No measure has been processed before the first system of the document
+        const bool firstSystem = (params->m_previousMeasure == NULL);
+        system->Process(&unsetCurrentScoreDef, &unsetCurrentScoreDefParams);
+        system->Process(&setCurrentScoreDef, params);
+        if (optimize) {
+            OptimizeScoreDefParams optimizeScoreDefParams(this, &optimizeScoreDef, &optimizeScoreDefEnd);
+            optimizeScoreDefParams.m_firstScoreDef = firstSystem;
+            system->Process(&optimizeScoreDef, &optimizeScoreDefParams, &optimizeScoreDefEnd);
+        }
+        system->ResetCachedDrawingX();
+    }
+}
+
+void Doc::ClearCastOffProgress()
+{
+    // The content page is owned by the pages, but not the objects pending at the end of the last system
+    if (m_castOffSystemsParams) {
+        for (Object *object : m_castOffSystemsParams->m_pendingObjects) {
+            m_castOffSystemsParams->m_currentSystem->AddChild(object);
+        }
+        delete m_castOffSystemsParams;
+        m_castOffSystemsParams = NULL;
+    }
+    m_castOffContentPage = NULL;
+
+    if (m_castOffPagesParams) delete m_castOffPagesParams;
+    m_castOffPagesParams = NULL;
+    if (m_castOffSystemsScoreDefParams) {
+        delete m_castOffSystemsScoreDefParams->m_upcomingScoreDef;
+        delete m_castOffSystemsScoreDefParams;
+    }
+    m_castOffSystemsScoreDefParams = NULL;
+    if (m_castOffPagesScoreDefParams) {
+        delete m_castOffPagesScoreDefParams->m_upcomingScoreDef;
+        delete m_castOffPagesScoreDefParams;
+    }
+    m_castOffPagesScoreDefParams = NULL;
+    for (Object *scoreDef : m_castOffScoreDefs) delete scoreDef;
+    m_castOffScoreDefs.clear();
+    m_castOffCurrentScoreDef = NULL;
+}
+
+void Doc::ResetLayoutDoc()
+{
+    Pages *pages = this->GetPages();
+    assert(pages);
+
+    for (auto child : *pages->GetChildren()) {
+        Page *page = vrv_cast<Page *>(child);
+        assert(page);
+        page->ResetLayoutDone();
+    }
+}
+
 void Doc::CastOffRunningElements(CastOffPagesParams *params)
 {
     Pages *pages = this->GetPages();
@@ -942,11 +1512,14 @@ void Doc::CastOffRunningElements(CastOffPagesParams *params)
     this->ResetDrawingPage();
 }
 
-void Doc::UnCastOffDoc()
+void Doc::UnCastOffDoc(bool resetCache)
 {
     Pages *pages = this->GetPages();
     assert(pages);
 
+    // A pending content page is one of the pages and its systems are uncast with the other ones
+    this->ClearCastOffProgress();
+
     Page *contentPage = new Page();
     System *contentSystem = new System();
     contentPage->AddChild(contentSystem);
@@ -966,6 +1539,21 @@ void Doc::UnCastOffDoc()
     // because idx will still be 0 but contentPage is dead!
     this->ResetDrawingPage();
     this->SetCurrentScoreDefDoc(true);
+
+    m_useCachedHorizontalLayout = false;
+    if (resetCache) {
+        m_hasCachedHorizontalLayout = false;
+    }
+    else if (m_hasCachedHorizontalLayout) {
+        // Put back the measures as they were laid out in the content page before being cast off
+        CacheHorizontalLayoutParams cacheHorizontalLayoutParams(true, m_options->GetHorizontalLayoutHash());
+        Functor cacheHorizontalLayout(&Object::CacheHorizontalLayout);
+        contentPage->Process(&cacheHorizontalLayout, &cacheHorizontalLayoutParams);
+        contentPage->ResetCachedDrawingX();
+        // The content or the options of one of the measures changed - the whole content page is laid out again
+        m_hasCachedHorizontalLayout = !cacheHorizontalLayoutParams.m_changed;
+        m_useCachedHorizontalLayout = m_hasCachedHorizontalLayout;
+    }
 }
 
 void Doc::CastOffEncodingDoc()
@@ -1179,6 +1767,18 @@ void Doc::ConvertMarkupDoc(bool permanent)
 
     if ((m_markup & MARKUP_ANALYTICAL_FERMATA) || (m_markup & MARKUP_ANALYTICAL_TIE)) {
 
+        // Remove the elements of a previous conversion since the visible readings might have changed
+        if (m_markupConversionDone) {
+            ListOfObjects converted;
+            IsAttributeComparison isFermata(FERMATA);
+            IsAttributeComparison isTie(TIE);
+            this->FindAllDescendantByComparison(&converted, &isFermata);
+            this->FindAllDescendantByComparison(&converted, &isTie, UNLIMITED_DEPTH, FORWARD, false);
+            for (Object *object : converted) {
+                object->GetParent()->DeleteChild(object);
+            }
+        }
+
         /************ Prepare processing by staff/layer/verse ************/
 
         // We need to populate processing lists for processing the document by Layer (for matching @tie) and
@@ -1225,6 +1825,8 @@ void Doc::ConvertMarkupDoc(bool permanent)
             }
         }
     }
+
+    if (!permanent) m_markupConversionDone = true;
 }
 
 void Doc::TransposeDoc()
@@ -1301,6 +1903,12 @@ void Doc::ExpandExpansions()
     }
 
     xsdAnyURI_List expansionList = start->GetPlist();
+    // Only keep the references to the performed sections and leave the notated content untouched
+    if (this->GetOptions()->m_expandByReference.GetValue()) {
+        this->m_expansionMap.ExpandReferences(expansionList, start);
+        this->m_expansionMap.MapReferenceIds();
+        return;
+    }
     xsdAnyURI_List existingList;
     this->m_expansionMap.Expand(expansionList, existingList, start);
 
@@ -1327,6 +1935,312 @@ void Doc::ExpandExpansions()
     // }
 }
 
+void Doc::GetMemoryUsage(MapOfStrMemoryUsages &objects, MapOfStrMemoryUsages &layout)
+{
+    Functor getMemoryUsage(&Object::GetMemoryUsage);
+    getMemoryUsage.m_visibleOnly = false;
+    GetMemoryUsageParams getMemoryUsageParams(&getMemoryUsage);
+
+    m_mdivScoreDef.Process(&getMemoryUsage, &getMemoryUsageParams);
+    this->Process(&getMemoryUsage, &getMemoryUsageParams);
+
+    objects = getMemoryUsageParams.m_objects;
+    layout.clear();
+    layout["aligners"] = getMemoryUsageParams.m_aligners;
+    layout["floatingPositioners"] = getMemoryUsageParams.m_floatingPositioners;
+    layout["beamSegments"] = getMemoryUsageParams.m_beamSegments;
+}
+
+bool Doc::SelectMdiv()
+{
+    pugi::xml_node body = m_selectionSkeleton.first_element_by_path("/mei/music/body");
+    if (!body) return false;
+
+    // Select the first mdiv by default, or the one of the first score, as MEIInput::ReadDoc does
+    pugi::xml_node selectedNode = body.child("mdiv");
+    std::string xPathQuery = m_options->m_mdivXPathQuery.GetValue();
+    try {
+        if (!xPathQuery.empty()) {
+            selectedNode = body.select_node(xPathQuery.c_str()).node();
+        }
+        else if (pugi::xpath_node scoreMdiv = body.select_node(".//mdiv[count(score)>0]")) {
+            selectedNode = scoreMdiv.node();
+        }
+    }
+    catch (pugi::xpath_exception &e) {
+        LogError("The xpath query '%s' cannot be evaluated: %s", xPathQuery.c_str(), e.what());
+        return false;
+    }
+
+    if (!selectedNode || (std::string(selectedNode.name()) != "mdiv")) {
+        LogError("The <mdiv> requested with the xpath query '%s' could not be found", xPathQuery.c_str());
+        return false;
+    }
+    if (selectedNode.select_nodes(".//score").size() + selectedNode.select_nodes(".//pages").size() != 1) {
+        LogError("An <mdiv> with only one <pages> or one <score> descendant must be selected");
+        return false;
+    }
+
+    // Look for the objects of the mdivs, including the hidden ones
+    ListOfObjects mdivs;
+    ClassIdComparison isMdiv(MDIV);
+    FindAllByComparisonParams findAllByComparisonParams(&isMdiv, &mdivs);
+    Functor findAllByComparison(&Object::FindAllByComparison);
+    findAllByComparison.m_visibleOnly = false;
+    this->Process(&findAllByComparison, &findAllByComparisonParams);
+
+    const std::string uuid = selectedNode.attribute("xml:id").value();
+    auto found = std::find_if(
+        mdivs.begin(), mdivs.end(), [&uuid](Object *object) { return (object->GetUuid() == uuid); });
+    if (found == mdivs.end()) {
+        LogError("The <mdiv> selected was not loaded");
+        return false;
+    }
+    Mdiv *selectedMdiv = vrv_cast<Mdiv *>(*found);
+    assert(selectedMdiv);
+
+    Pages *pages = this->GetPages();
+    if (pages && (selectedMdiv->m_visibility == Visible) && selectedMdiv->HasDescendant(pages)) return false;
+
+    // Put the scoreDef of the doc back at the beginning of the content it was taken from
+    System *system = (pages) ? vrv_cast<System *>(pages->FindDescendantByType(SYSTEM)) : NULL;
+    if (system) {
+        ScoreDef *scoreDef = new ScoreDef();
+        this->MoveScoreDef(&m_mdivScoreDef, scoreDef);
+        scoreDef->SetParent(system);
+        system->InsertChild(scoreDef, 0);
+    }
+
+    // The pages of the previous content are kept as they are
+    this->ClearCastOffProgress();
+
+    for (Object *object : mdivs) {
+        Mdiv *mdiv = vrv_cast<Mdiv *>(object);
+        assert(mdiv);
+        mdiv->m_visibility = ((mdiv == selectedMdiv) || selectedMdiv->HasDescendant(mdiv)) ? Visible : Hidden;
+    }
+    selectedMdiv->MakeVisible();
+
+    Score *score = this->GetScore();
+    pages = this->GetPages();
+    Object *content = (score) ? static_cast<Object *>(score) : pages;
+    assert(content);
+
+    // The first scoreDef of the content is the one of the doc, as when reading it
+    ScoreDef *scoreDef = vrv_cast<ScoreDef *>(content->FindDescendantByType(SCOREDEF));
+    if (scoreDef) {
+        this->MoveScoreDef(scoreDef, &m_mdivScoreDef);
+        scoreDef->GetParent()->DeleteChild(scoreDef);
+    }
+    else {
+        LogWarning("No scoreDef provided, trying to generate one...");
+        this->GenerateDocumentScoreDef();
+    }
+
+    if (score) {
+        this->ConvertToPageBasedDoc();
+        this->ConvertMarkupDoc();
+    }
+    else {
+        // The content was cast off when visible before
+        this->UnCastOffDoc();
+        if (m_markupConversionDone) this->ConvertMarkupDoc();
+    }
+
+    this->ResetDrawingPage();
+    m_currentScoreDefDone = false;
+    m_hasCachedHorizontalLayout = false;
+    m_useCachedHorizontalLayout = false;
+    m_MIDITimemapTempo = 0.0;
+
+    return true;
+}
+
+bool Doc::SelectReadings()
+{
+    pugi::xml_node body = m_selectionSkeleton.first_element_by_path("/mei/music/body");
+    if (!body) return false;
+
+    std::list<pugi::xpath_query> appQueries;
+    std::list<pugi::xpath_query> choiceQueries;
+    std::list<pugi::xpath_query> substQueries;
+    Doc::CompileXPathQueries(m_options->m_appXPathQuery.GetValue(), appQueries);
+    Doc::CompileXPathQueries(m_options->m_choiceXPathQuery.GetValue(), choiceQueries);
+    Doc::CompileXPathQueries(m_options->m_substXPathQuery.GetValue(), substQueries);
+
+    // Look for the editorial elements, including the hidden ones and the ones in the scoreDef of the doc
+    ListOfObjects objects;
+    IsEditorialElementComparison isEditorialElement;
+    FindAllByComparisonParams findAllByComparisonParams(&isEditorialElement, &objects);
+    Functor findAllByComparison(&Object::FindAllByComparison);
+    findAllByComparison.m_visibleOnly = false;
+    this->Process(&findAllByComparison, &findAllByComparisonParams);
+    m_mdivScoreDef.Process(&findAllByComparison, &findAllByComparisonParams);
+
+    std::map<std::string, Object *> editorialElements;
+    for (Object *object : objects) {
+        editorialElements[object->GetUuid()] = object;
+    }
+
+    bool hasChanged = false;
+    for (pugi::xpath_node selectionNode : body.select_nodes(".//app | .//choice | .//subst")) {
+        pugi::xml_node node = selectionNode.node();
+        auto found = editorialElements.find(node.attribute("xml:id").value());
+        if (found == editorialElements.end()) continue;
+        Object *parent = found->second;
+
+        const std::string name = node.name();
+        const std::list<pugi::xpath_query> &queries
+            = (name == "app") ? appQueries : ((name == "choice") ? choiceQueries : substQueries);
+        const std::string selectedUuid = Doc::SelectXPathNode(node, queries).attribute("xml:id").value();
+
+        // Make the child selected visible, or the first one if none is, as MEIInput does
+        Object *selected = NULL;
+        for (Object *child : *parent->GetChildren()) {
+            if (child->GetUuid() == selectedUuid) selected = child;
+        }
+        if (!selected) selected = parent->GetFirst();
+
+        bool isChanged = false;
+        for (Object *child : *parent->GetChildren()) {
+            EditorialElement *element = dynamic_cast<EditorialElement *>(child);
+            if (element && (element->m_visibility != ((element == selected) ? Visible : Hidden))) isChanged = true;
+        }
+        if (!isChanged) continue;
+
+        // Readings with sections are converted to page-based only when visible
+        EditorialLevel level = EDITORIAL_UNDEFINED;
+        if (parent->Is(APP)) {
+            level = vrv_cast<App *>(parent)->GetLevel();
+        }
+        else if (parent->Is(CHOICE)) {
+            level = vrv_cast<Choice *>(parent)->GetLevel();
+        }
+        else if (parent->Is(SUBST)) {
+            level = vrv_cast<Subst *>(parent)->GetLevel();
+        }
+        if ((level == EDITORIAL_TOPLEVEL) && !parent->GetFirstAncestor(SCORE)) {
+            LogWarning("The reading of <%s> '%s' with sections can be changed only by loading the data again",
+                name.c_str(), parent->GetUuid().c_str());
+            continue;
+        }
+
+        for (Object *child : *parent->GetChildren()) {
+            EditorialElement *element = dynamic_cast<EditorialElement *>(child);
+            if (element) element->m_visibility = (element == selected) ? Visible : Hidden;
+        }
+        hasChanged = true;
+    }
+
+    if (!hasChanged) return false;
+
+    if (m_markupConversionDone) this->ConvertMarkupDoc();
+    m_MIDITimemapTempo = 0.0;
+
+    return true;
+}
+
+void Doc::BuildSelectionSkeleton()
+{
+    if (m_selectionSkeleton.first_child()) return;
+
+    pugi::xml_node skeletonBody = m_selectionSkeleton.append_child("mei").append_child("music").append_child("body");
+
+    // The objects of the hidden mdivs and readings are written too, with their uuid as xml:id
+    MEIOutput meiOutput(this);
+    meiOutput.SetScoreBasedMEI(true);
+    meiOutput.SetIndent(0);
+    pugi::xml_document mei;
+    if (!mei.load_string(meiOutput.GetOutput().c_str())) {
+        LogError("The selection skeleton could not be built");
+        return;
+    }
+
+    pugi::xml_node body = mei.first_element_by_path("/mei/music/body");
+    if (body.select_node("(.//mdiv)[2] | .//app | .//choice | .//subst")) {
+        this->CopySelectionSkeleton(body, skeletonBody);
+    }
+}
+
+std::pair<int, size_t> Doc::GetSelectionSkeletonMemoryUsage() const
+{
+    // pugixml nodes hold eight pointers and attributes five, plus their strings
+    int count = 0;
+    size_t bytes = sizeof(m_selectionSkeleton);
+    for (pugi::xpath_node node : m_selectionSkeleton.select_nodes("//node()")) {
+        ++count;
+        bytes += 8 * sizeof(void *) + strlen(node.node().name()) + strlen(node.node().value());
+        for (pugi::xml_attribute attribute : node.node().attributes()) {
+            bytes += 5 * sizeof(void *) + strlen(attribute.name()) + strlen(attribute.value());
+        }
+    }
+    return { count, bytes };
+}
+
+void Doc::CopySelectionSkeleton(pugi::xml_node node, pugi::xml_node skeletonParent)
+{
+    for (pugi::xml_node current = node.first_child(); current; current = current.next_sibling()) {
+        if (current.type() != pugi::node_element) continue;
+        const std::string name = current.name();
+        if ((name == "app") || (name == "choice") || (name == "subst")) {
+            // The complete content is kept for the queries to be evaluated as when reading the data
+            skeletonParent.append_copy(current);
+        }
+        else if ((name == "mdiv") || (name == "score") || (name == "pages")) {
+            pugi::xml_node skeletonNode = skeletonParent.append_child(current.name());
+            for (pugi::xml_attribute attribute : current.attributes()) {
+                skeletonNode.append_copy(attribute);
+            }
+            this->CopySelectionSkeleton(current, skeletonNode);
+        }
+        else {
+            this->CopySelectionSkeleton(current, skeletonParent);
+        }
+    }
+}
+
+void Doc::MoveScoreDef(ScoreDef *scoreDef, ScoreDef *destination)
+{
+    assert(scoreDef);
+    assert(destination);
+
+    // Copy the attributes without the children, which cannot all be cloned, and move them afterwards
+    ScoreDef children;
+    children.MoveChildrenFrom(scoreDef);
+    scoreDef->ClearRelinquishedChildren();
+    *destination = *scoreDef;
+    destination->MoveChildrenFrom(&children);
+    children.ClearRelinquishedChildren();
+    destination->SwapUuid(scoreDef);
+}
+
+void Doc::CompileXPathQueries(const std::vector<std::string> &queries, std::list<pugi::xpath_query> &compiled)
+{
+    compiled.clear();
+    for (const std::string &query : queries) {
+        try {
+            compiled.emplace_back(query.c_str());
+        }
+        catch (pugi::xpath_exception &e) {
+            LogError("The xpath query '%s' cannot be compiled: %s", query.c_str(), e.what());
+            continue;
+        }
+        if (compiled.back().return_type() != pugi::xpath_type_node_set) {
+            LogError("The xpath query '%s' does not select nodes", query.c_str());
+            compiled.pop_back();
+        }
+    }
+}
+
+pugi::xml_node Doc::SelectXPathNode(pugi::xml_node node, const std::list<pugi::xpath_query> &queries)
+{
+    for (const pugi::xpath_query &query : queries) {
+        pugi::xpath_node selection = query.evaluate_node(node);
+        if (selection) return selection.node();
+    }
+    return pugi::xml_node();
+}
+
 bool Doc::HasPage(int pageIdx)
 {
     Pages *pages = this->GetPages();
@@ -1350,6 +2264,46 @@ int Doc::GetPageCount()
     return ((pages) ? pages->GetChildCount() : 0);
 }
 
+int Doc::GetEstimatedPageCount()
+{
+    if (!m_castOffContentPage) return this->GetPageCount();
+
+    Pages *pages = this->GetPages();
+    assert(pages);
+
+    // Use the number of systems per page in the complete pages, i.e., all but the last one and the content page
+    const int completePages = pages->GetChildCount() - 2;
+    int completeSystems = 0;
+    int castOffSystems = 0;
+    int castOffMeasures = 0;
+    for (int i = 0; i < completePages + 1; ++i) {
+        Object *page = pages->GetChild(i);
+        const int systems = page->GetChildCount(SYSTEM);
+        if (i < completePages) completeSystems += systems;
+        castOffSystems += systems;
+        for (auto system : *page->GetChildren()) castOffMeasures += system->GetChildCount(MEASURE);
+    }
+    int pendingSystems = m_castOffContentPage->GetChildCount(SYSTEM);
+    // The content system with the measures not cast off into systems yet is the last one
+    if (m_castOffSystemsParams) {
+        System *contentSystem = vrv_cast<System *>(m_castOffContentPage->GetLast());
+        assert(contentSystem);
+        const int pendingMeasures = contentSystem->GetChildCount(MEASURE);
+        pendingSystems -= 1;
+        if (castOffMeasures > 0) {
+            pendingSystems += ceil((double)pendingMeasures * castOffSystems / castOffMeasures);
+        }
+        else if (pendingMeasures > 0) {
+            pendingSystems += 1;
+        }
+    }
+    if (completeSystems == 0) return completePages + 2;
+
+    const double systemsPerPage = (double)completeSystems / completePages;
+    const int estimation = completePages + ceil((castOffSystems - completeSystems + pendingSystems) / systemsPerPage);
+    return std::max(estimation, completePages + 1);
+}
+
 int Doc::GetGlyphHeight(wchar_t code, int staffSize, bool graceSize) const
 {
     int x, y, w, h;
@@ -1647,6 +2601,13 @@ double Doc::GetTopMargin(const ClassId classId) const
     return margin;
 }
 
+TextExtentCache *Doc::GetTextExtentCache()
+{
+    // The glyphs missing in the text font are taken from the music font
+    m_textExtentCache.SetFontName(m_options->m_font.GetValue());
+    return &m_textExtentCache;
+}
+
 Page *Doc::SetDrawingPage(int pageIdx)
 {
     // out of range
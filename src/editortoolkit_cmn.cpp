@@ -109,6 +109,10 @@ bool EditorToolkitCMN::ParseEditorAction(const std::string &json_editorAction, b
     else if (action == "insert") {
         std::string elementType, startid, endid;
         if (this->ParseInsertAction(json.get<jsonxx::Object>("param"), elementType, startid, endid)) {
+            // The repetitions of an expansion by reference are edited in the notated elements
+            int repeat = 1;
+            startid = m_doc->m_expansionMap.GetNotatedReferenceId(startid, repeat);
+            if (endid != "") endid = m_doc->m_expansionMap.GetNotatedReferenceId(endid, repeat);
             if (endid == "") {
                 return this->Insert(elementType, startid);
             }
@@ -235,6 +239,7 @@ bool EditorToolkitCMN::Drag(std::string &elementId, int x, int y)
             = (data_PITCHNAME)m_view->CalculatePitchCode(layer, m_view->ToLogicalY(y), element->GetDrawingX(), &oct);
         element->GetPitchInterface()->SetPname(pname);
         element->GetPitchInterface()->SetOct(oct);
+        element->Modify();
 
         return true;
     }
@@ -257,6 +262,7 @@ bool EditorToolkitCMN::KeyDown(std::string &elementId, int key, bool shiftKey, b
             default: step = 0;
         }
         interface->AdjustPitchByOffset(step);
+        element->Modify();
         return true;
     }
     return false;
@@ -393,6 +399,7 @@ bool EditorToolkitCMN::Set(std::string &elementId, std::string const &attribute,
     else if (Att::SetVisual(element, attribute, value))
         success = true;
     if (success) {
+        element->Modify();
         return true;
     }
     return false;
@@ -409,6 +416,10 @@ Object *EditorToolkitCMN::GetElement(std::string &elementId)
 
     Object *element = NULL;
 
+    // The repetitions of an expansion by reference are edited in the notated element
+    int repeat = 1;
+    elementId = m_doc->m_expansionMap.GetNotatedReferenceId(elementId, repeat);
+
     // Try to get the element on the current drawing page
     if (m_doc->GetDrawingPage()) {
         element = m_doc->GetDrawingPage()->FindDescendantByUuid(elementId);
@@ -26,6 +26,7 @@
 #include "neume.h"
 #include "page.h"
 #include "rend.h"
+#include "spatialindex.h"
 #include "staff.h"
 #include "staffdef.h"
 #include "surface.h"
@@ -61,6 +62,9 @@ bool EditorToolkitNeume::ParseEditorAction(const std::string &json_editorAction)
         return false;
     }
 
+    // A previous action (e.g., in a chain) might have changed the zones in the spatial index of the page
+    if (m_doc->GetDrawingPage()) m_doc->GetDrawingPage()->ResetSpatialIndex();
+
     std::string action = json.get<jsonxx::String>("action");
 
     if (action != "chain" && json.has<jsonxx::Array>("param")) {
@@ -592,22 +596,7 @@ bool EditorToolkitNeume::Insert(std::string elementType, std::string staffId, in
 
     // Find closest valid staff
     if (staffId == "auto") {
-        ListOfObjects staves;
-        ClassIdComparison ac(STAFF);
-        m_doc->FindAllDescendantByComparison(&staves, &ac);
-        std::vector<Object *> stavesVector(staves.begin(), staves.end());
-
-        ClosestBB comp;
-        comp.x = ulx;
-        comp.y = uly;
-
-        if (staves.size() > 0) {
-            std::sort(stavesVector.begin(), stavesVector.end(), comp);
-            staff = dynamic_cast<Staff *>(stavesVector.at(0));
-        }
-        else {
-            staff = NULL;
-        }
+        staff = this->GetClosestStaff(ulx, uly);
     }
     else {
         staff = dynamic_cast<Staff *>(m_doc->FindDescendantByUuid(staffId));
@@ -2370,12 +2359,6 @@ bool EditorToolkitNeume::ChangeStaff(std::string elementId)
         return false;
     }
 
-    ListOfObjects stavesList;
-    ClassIdComparison ac(STAFF);
-    m_doc->FindAllDescendantByComparison(&stavesList, &ac);
-
-    std::vector<Object *> staves(stavesList.begin(), stavesList.end());
-
     ClosestBB comp;
 
     if (dynamic_cast<FacsimileInterface *>(element)->HasFacs()) {
@@ -2403,13 +2386,9 @@ bool EditorToolkitNeume::ChangeStaff(std::string elementId)
         return false;
     }
 
-    Staff *staff = NULL;
+    Staff *staff = this->GetClosestStaff(comp.x, comp.y);
 
-    if (staves.size() > 0) {
-        std::sort(staves.begin(), staves.end(), comp);
-        staff = dynamic_cast<Staff *>(staves.front());
-    }
-    else {
+    if (!staff) {
         LogError("Could not find any staves. This should not happen");
         m_infoObject.import("status", "FAILURE");
         m_infoObject.import("message", "Could not find any staves. This should not happen");
@@ -2929,4 +2908,28 @@ bool EditorToolkitNeume::AdjustClefLineFromPosition(Clef *clef, Staff *staff)
     return true;
 }
 
+Staff *EditorToolkitNeume::GetClosestStaff(int x, int y)
+{
+    ClosestBB comp;
+    comp.x = x;
+    comp.y = y;
+
+    // The spatial index of the drawing page has the staves with their zone
+    Page *page = m_doc->GetDrawingPage();
+    if (page) {
+        return vrv_cast<Staff *>(page->GetSpatialIndex()->FindClosest(
+            x, y, STAFF, [&comp](Object *object) { return comp.distanceToZone(object); }));
+    }
+
+    // Otherwise look at all the staves of the document
+    ListOfObjects staves;
+    ClassIdComparison ac(STAFF);
+    m_doc->FindAllDescendantByComparison(&staves, &ac);
+    if (staves.empty()) return NULL;
+
+    std::vector<Object *> stavesVector(staves.begin(), staves.end());
+    std::sort(stavesVector.begin(), stavesVector.end(), comp);
+    return vrv_cast<Staff *>(stavesVector.front());
+}
+
 } // namespace vrv
@@ -301,7 +301,7 @@ void Stem::AdjustOverlappingLayers(Doc *doc, const std::vector<LayerElement *> &
         isUnison = false;
         return;
     }
-    Staff *staff = vrv_cast<Staff *>(GetFirstAncestor(STAFF));
+    Staff *staff = this->GetAncestorStaff();
     assert(staff);
     // check if there is an overlap on the left or on the right and displace stem's parent correspondigly
     for (auto element : otherElements) {
@@ -14,6 +14,7 @@
 
 //----------------------------------------------------------------------------
 
+#include "comparison.h"
 #include "editorial.h"
 #include "expansion.h"
 #include "linkinginterface.h"
@@ -34,6 +35,7 @@ ExpansionMap::~ExpansionMap() {}
 void ExpansionMap::Reset()
 {
     m_map.clear();
+    m_references.clear();
 }
 
 void ExpansionMap::Expand(const xsdAnyURI_List &expansionList, xsdAnyURI_List &existingList, Object *prevSect)
@@ -122,6 +124,61 @@ void ExpansionMap::Expand(const xsdAnyURI_List &expansionList, xsdAnyURI_List &e
     }
 }
 
+void ExpansionMap::ExpandReferences(const xsdAnyURI_List &expansionList, Object *prevSect)
+{
+    assert(prevSect);
+    assert(prevSect->GetParent());
+
+    for (std::string s : expansionList) {
+        if (s.rfind("#", 0) == 0) s = s.substr(1, s.size() - 1); // remove trailing hash from reference
+        Object *currSect = prevSect->GetParent()->FindDescendantByUuid(s); // find section pointer of reference string
+        if (!currSect) {
+            return;
+        }
+        if (currSect->Is(EXPANSION)) { // if reference is itself an expansion, resolve it recursively
+            Expansion *currExpansion = vrv_cast<Expansion *>(currSect);
+            assert(currExpansion);
+            ExpandReferences(currExpansion->GetPlist(), currSect);
+        }
+        else {
+            // the performed measures and scoreDef changes and breaks point to the notated ones
+            ListOfObjects content;
+            ClassIdsComparison matchType({ MEASURE, SCOREDEF, SB, PB });
+            currSect->FindAllDescendantByComparison(&content, &matchType);
+            if (matchType(currSect)) content.push_front(currSect);
+            m_references.insert(m_references.end(), content.begin(), content.end());
+        }
+    }
+}
+
+void ExpansionMap::MapReferenceIds()
+{
+    std::map<Object *, int> repeats;
+    for (Object *reference : m_references) {
+        const int repeat = ++repeats[reference];
+        if (repeat < 2) continue;
+        std::vector<std::string> ids;
+        ids.push_back(reference->GetUuid());
+        this->GetUuidList(reference, ids);
+        for (const std::string &id : ids) {
+            this->AddExpandedIdToExpansionMap(id, id + "-rend" + std::to_string(repeat));
+        }
+    }
+}
+
+std::string ExpansionMap::GetNotatedReferenceId(const std::string &xmlId, int &repeat) const
+{
+    repeat = 1;
+    if (m_references.empty()) return xmlId;
+
+    auto list = m_map.find(xmlId);
+    if (list == m_map.end()) return xmlId;
+    // The notated id is first and the repetitions follow in order
+    auto iter = std::find(list->second.begin(), list->second.end(), xmlId);
+    repeat = (int)(iter - list->second.begin()) + 1;
+    return list->second.front();
+}
+
 bool ExpansionMap::UpdateIds(Object *object)
 {
     for (Object *o : *object->GetChildren()) {
@@ -235,7 +292,19 @@ std::vector<std::string> ExpansionMap::GetExpansionIdsForElement(const std::stri
 
 bool ExpansionMap::HasExpansionMap()
 {
-    return (m_map.empty()) ? false : true;
+    return (m_map.empty() && m_references.empty()) ? false : true;
+}
+
+size_t ExpansionMap::GetMemorySize() const
+{
+    size_t bytes = sizeof(*this) + m_references.capacity() * sizeof(Object *);
+    for (const auto &entry : m_map) {
+        // A map node has three pointers and a color besides its value
+        bytes += 4 * sizeof(void *) + sizeof(entry) + entry.first.capacity();
+        bytes += entry.second.capacity() * sizeof(std::string);
+        for (const std::string &id : entry.second) bytes += id.capacity();
+    }
+    return bytes;
 }
 
 void ExpansionMap::GetUuidList(Object *object, std::vector<std::string> &idList)
@@ -417,6 +417,12 @@ FloatingCurvePositioner::~FloatingCurvePositioner()
     ClearSpannedElements();
 }
 
+size_t FloatingCurvePositioner::GetMemorySize() const
+{
+    return sizeof(*this) + m_spannedElements.capacity() * sizeof(CurveSpannedElement *)
+        + m_spannedElements.size() * sizeof(CurveSpannedElement);
+}
+
 void FloatingCurvePositioner::ResetPositioner()
 {
     FloatingPositioner::ResetPositioner();
@@ -99,7 +99,7 @@ void FTrem::FilterList(ArrayOfObjects *childList)
         ++iter;
     }
 
-    Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *staff = this->GetAncestorStaff();
     assert(staff);
 
     InitCoords(childList, staff, BEAMPLACE_NONE);
@@ -180,7 +180,7 @@ int FTrem::CalcStem(FunctorParams *functorParams)
 
     this->m_beamSegment.InitCoordRefs(this->GetElementCoords());
 
-    Layer *layer = vrv_cast<Layer *>(this->GetFirstAncestor(LAYER));
+    Layer *layer = this->GetAncestorLayer();
     assert(layer);
     Staff *staff = vrv_cast<Staff *>(layer->GetFirstAncestor(STAFF));
     assert(staff);
@@ -220,4 +220,16 @@ int FTrem::GenerateMIDI(FunctorParams *functorParams)
     return FUNCTOR_CONTINUE;
 }
 
+
+int FTrem::GetMemoryUsage(FunctorParams *functorParams)
+{
+    GetMemoryUsageParams *params = vrv_params_cast<GetMemoryUsageParams *>(functorParams);
+    assert(params);
+
+    params->m_beamSegments.first++;
+    params->m_beamSegments.second += m_beamSegment.GetMemorySize();
+
+    return Object::GetMemoryUsage(functorParams);
+}
+
 } // namespace vrv
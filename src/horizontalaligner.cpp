@@ -515,8 +515,8 @@ bool Alignment::AddLayerElementRef(LayerElement *element)
         }
         // Non cross staff normal case
         else {
-            layerRef = dynamic_cast<Layer *>(element->GetFirstAncestor(LAYER));
-            if (layerRef) staffRef = dynamic_cast<Staff *>(layerRef->GetFirstAncestor(STAFF));
+            layerRef = element->GetAncestorLayer();
+            if (layerRef) staffRef = element->GetAncestorStaff();
             if (staffRef) {
                 layerN = layerRef->GetN();
                 staffN = staffRef->GetN();
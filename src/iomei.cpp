@@ -143,6 +143,7 @@ MEIOutput::MEIOutput(Doc *doc) : Output(doc)
     m_indent = 5;
     m_scoreBasedMEI = false;
     m_removeIds = false;
+    m_outputFlags = pugi::format_default;
 }
 
 MEIOutput::~MEIOutput() {}
@@ -151,12 +152,21 @@ bool MEIOutput::Export()
 {
 
     if (m_removeIds) {
-        FindAllReferencedObjectsParams findAllReferencedObjectsParams(&m_referredObjects);
+        ListOfObjects referredObjects;
+        FindAllReferencedObjectsParams findAllReferencedObjectsParams(&referredObjects);
         Functor findAllReferencedObjects(&Object::FindAllReferencedObjects);
         m_doc->Process(&findAllReferencedObjects, &findAllReferencedObjectsParams);
-        m_referredObjects.unique();
+        m_referredObjects.clear();
+        m_referredObjects.insert(referredObjects.begin(), referredObjects.end());
     }
 
+    m_outputFlags = pugi::format_default;
+    if (m_doc->GetOptions()->m_outputSmuflXmlEntities.GetValue()) {
+        m_outputFlags |= pugi::format_no_escapes;
+    }
+    m_indentString = (m_indent == -1) ? "\t" : std::string(m_indent, ' ');
+    m_streamedNodes.clear();
+
     try {
         pugi::xml_document meiDoc;
 
@@ -219,13 +229,13 @@ bool MEIOutput::Export()
             page->Save(this);
         }
 
-        unsigned int output_flags = pugi::format_default;
-        if (m_doc->GetOptions()->m_outputSmuflXmlEntities.GetValue()) {
-            output_flags |= pugi::format_no_escapes;
+        if (!m_streamedNodes.empty()) {
+            // Write what was not streamed yet
+            this->StreamDocEnd(meiDoc);
+        }
+        else {
+            meiDoc.save(m_streamStringOutput, m_indentString.c_str(), m_outputFlags);
         }
-
-        std::string indent = (m_indent == -1) ? "\t" : std::string(m_indent, ' ');
-        meiDoc.save(m_streamStringOutput, indent.c_str(), output_flags);
     }
     catch (char *str) {
         LogError("%s", str);
@@ -780,9 +790,116 @@ bool MEIOutput::WriteObjectEnd(Object *object)
         m_currentNode.append_child(pugi::node_comment).set_value(object->GetClosingComment().c_str());
     }
 
+    pugi::xml_node node = m_nodeStack.back();
     m_nodeStack.pop_back();
     m_currentNode = m_nodeStack.back();
 
+    if (object->Is(MEASURE)) {
+        this->StreamMeasure(node);
+    }
+    else if (!m_streamedNodes.empty() && (m_streamedNodes.back() == node)) {
+        this->StreamNodeEnd(node);
+    }
+
+    return true;
+}
+
+void MEIOutput::StreamMeasure(pugi::xml_node measure)
+{
+    // The ancestors of the measure, from the root element
+    std::vector<pugi::xml_node> ancestors;
+    for (pugi::xml_node node = measure.parent(); node.type() == pugi::node_element; node = node.parent()) {
+        ancestors.insert(ancestors.begin(), node);
+    }
+    if (ancestors.size() < m_streamedNodes.size()) return;
+    if (!std::equal(m_streamedNodes.begin(), m_streamedNodes.end(), ancestors.begin())) return;
+    // The ancestors not opened yet must only have element children for keeping the indentation
+    for (int i = (int)m_streamedNodes.size(); i < (int)ancestors.size(); ++i) {
+        if (!this->IsStreamable(ancestors.at(i))) return;
+    }
+
+    if (m_streamedNodes.empty()) {
+        // Add the declaration pugi::xml_document::save would add (e.g., for the output by page)
+        pugi::xml_node document = measure.root();
+        pugi::xml_node child = document.first_child();
+        while (child && (child.type() != pugi::node_declaration) && (child.type() != pugi::node_element)) {
+            child = child.next_sibling();
+        }
+        if (!child || (child.type() != pugi::node_declaration)) {
+            m_streamStringOutput << "<?xml version=\"1.0\"?>\n";
+        }
+    }
+
+    for (int i = (int)m_streamedNodes.size(); i < (int)ancestors.size(); ++i) {
+        pugi::xml_node parent = ancestors.at(i).parent();
+        // Write the previous siblings and the start tag
+        this->StreamChildren(parent, ancestors.at(i).previous_sibling(), i);
+        this->StreamStartTag(ancestors.at(i), i);
+        m_streamedNodes.push_back(ancestors.at(i));
+    }
+
+    this->StreamChildren(measure.parent(), measure, (int)ancestors.size());
+}
+
+void MEIOutput::StreamNodeEnd(pugi::xml_node node)
+{
+    // The node can have been pushed more than once
+    if (std::find(m_nodeStack.begin(), m_nodeStack.end(), node) != m_nodeStack.end()) return;
+
+    const int depth = (int)m_streamedNodes.size() - 1;
+    this->StreamChildren(node, node.last_child(), depth + 1);
+    for (int i = 0; i < depth; ++i) m_streamStringOutput << m_indentString;
+    m_streamStringOutput << "</" << node.name() << ">\n";
+
+    m_streamedNodes.pop_back();
+    node.parent().remove_child(node);
+}
+
+void MEIOutput::StreamDocEnd(pugi::xml_document &meiDoc)
+{
+    while (!m_streamedNodes.empty()) {
+        m_nodeStack.remove(m_streamedNodes.back());
+        this->StreamNodeEnd(m_streamedNodes.back());
+    }
+    this->StreamChildren(meiDoc, meiDoc.last_child(), 0);
+}
+
+void MEIOutput::StreamChildren(pugi::xml_node parent, pugi::xml_node last, int depth)
+{
+    if (!last) return;
+
+    // Each node printed ends with a new line, as between the nodes of the document saved as a whole
+    pugi::xml_node child = parent.first_child();
+    while (child) {
+        pugi::xml_node next = (child == last) ? pugi::xml_node() : child.next_sibling();
+        child.print(m_streamStringOutput, m_indentString.c_str(), m_outputFlags, pugi::encoding_auto, depth);
+        parent.remove_child(child);
+        child = next;
+    }
+}
+
+void MEIOutput::StreamStartTag(pugi::xml_node node, int depth)
+{
+    // Print a copy of the node without children and turn the empty element tag "<name ... />" into a start tag
+    pugi::xml_document tag;
+    pugi::xml_node copy = tag.append_child(node.name());
+    for (pugi::xml_attribute attr : node.attributes()) {
+        copy.append_copy(attr);
+    }
+    std::ostringstream stream;
+    copy.print(stream, m_indentString.c_str(), m_outputFlags, pugi::encoding_auto, depth);
+    std::string startTag = stream.str();
+    assert(startTag.size() > 4);
+    startTag.resize(startTag.size() - 4);
+    m_streamStringOutput << startTag << ">\n";
+}
+
+bool MEIOutput::IsStreamable(pugi::xml_node node)
+{
+    if (node.value()[0] != '\0') return false;
+    for (pugi::xml_node child : node.children()) {
+        if ((child.type() == pugi::node_pcdata) || (child.type() == pugi::node_cdata)) return false;
+    }
     return true;
 }
 
@@ -795,11 +912,7 @@ std::string MEIOutput::UuidToMeiStr(Object *element)
 
 void MEIOutput::WriteXmlId(pugi::xml_node currentNode, Object *object)
 {
-    if (m_removeIds) {
-        ListOfObjects::iterator it = std::find(m_referredObjects.begin(), m_referredObjects.end(), object);
-        if (it == m_referredObjects.end()) return;
-        m_referredObjects.erase(it);
-    }
+    if (m_removeIds && (m_referredObjects.count(object) == 0)) return;
     currentNode.append_attribute("xml:id") = UuidToMeiStr(object).c_str();
 }
 
@@ -2373,6 +2486,7 @@ MEIInput::MEIInput(Doc *doc) : Input(doc)
     m_hasScoreDef = false;
     m_useScoreDefForDoc = false;
     m_readingScoreBased = false;
+    m_releaseConsumedNodes = false;
     m_version = MEI_UNDEFINED;
 }
 
@@ -2383,6 +2497,7 @@ bool MEIInput::Import(const std::string &mei)
     try {
         m_doc->Reset();
         m_doc->SetType(Raw);
+        m_releaseConsumedNodes = m_doc->GetOptions()->m_incrementalImport.GetValue();
         pugi::xml_document doc;
         doc.load_string(mei.c_str(), (pugi::parse_comments | pugi::parse_default) & ~pugi::parse_eol);
         pugi::xml_node root = doc.first_child();
@@ -2394,6 +2509,15 @@ bool MEIInput::Import(const std::string &mei)
     }
 }
 
+void MEIInput::ReleaseConsumedNode(pugi::xml_node parentNode, pugi::xml_node node)
+{
+    if (!m_releaseConsumedNodes) return;
+
+    // The content of the node has been copied to the Doc and it is not accessed anymore.
+    // Removing it only gives the node back to the pugixml allocator; the parsed buffer is kept until the end.
+    parentNode.remove_child(node);
+}
+
 bool MEIInput::IsAllowed(std::string element, Object *filterParent)
 {
     if (!filterParent || (element == "")) {
@@ -2857,6 +2981,10 @@ bool MEIInput::ReadDoc(pugi::xml_node root)
         return false;
     }
 
+    Doc::CompileXPathQueries(m_doc->GetOptions()->m_appXPathQuery.GetValue(), m_appXPathQueries);
+    Doc::CompileXPathQueries(m_doc->GetOptions()->m_choiceXPathQuery.GetValue(), m_choiceXPathQueries);
+    Doc::CompileXPathQueries(m_doc->GetOptions()->m_substXPathQuery.GetValue(), m_substXPathQueries);
+
     // Select the first mdiv by default
     m_selectedMdiv = body.child("mdiv");
     if (m_selectedMdiv.empty()) {
@@ -2910,6 +3038,10 @@ bool MEIInput::ReadDoc(pugi::xml_node root)
 
     if (success && m_readingScoreBased) {
         m_doc->ConvertToPageBasedDoc();
+    }
+
+    // The analytical markup is converted also in page-based MEI, where the converted elements are not written either
+    if (success) {
         m_doc->ConvertMarkupDoc();
     }
 
@@ -3001,8 +3133,9 @@ bool MEIInput::ReadPages(Object *parent, pugi::xml_node pages)
     this->m_hasLayoutInformation = true;
 
     bool success = true;
-    // We require to have s <scoreDef> as first child of <score>
+    // We require to have s <scoreDef> as first child of <score> - comments are skipped
     pugi::xml_node scoreDef = pages.first_child();
+    while (scoreDef && (scoreDef.type() == pugi::node_comment)) scoreDef = scoreDef.next_sibling();
     if (!scoreDef || (std::string(scoreDef.name()) != "scoreDef")) {
         LogWarning("No <scoreDef> provided, trying to proceed... ");
     }
@@ -3015,7 +3148,9 @@ bool MEIInput::ReadPages(Object *parent, pugi::xml_node pages)
 
     // No need to have ReadPagesChildren for this...
     pugi::xml_node current;
-    for (current = pages.first_child(); current; current = current.next_sibling()) {
+    pugi::xml_node next;
+    for (current = pages.first_child(); current; current = next) {
+        next = current.next_sibling();
         if (!success) break;
         // page
         if (std::string(current.name()) == "page") {
@@ -3032,6 +3167,7 @@ bool MEIInput::ReadPages(Object *parent, pugi::xml_node pages)
         else {
             LogWarning("Unsupported '<%s>' within <pages>", current.name());
         }
+        this->ReleaseConsumedNode(pages, current);
     }
 
     ReadUnsupportedAttr(pages, vrvPages);
@@ -3064,7 +3200,9 @@ bool MEIInput::ReadScore(Object *parent, pugi::xml_node score)
     if (!success) return false;
 
     pugi::xml_node current;
-    for (current = scoreDef.next_sibling(); current; current = current.next_sibling()) {
+    pugi::xml_node next;
+    for (current = scoreDef.next_sibling(); current; current = next) {
+        next = current.next_sibling();
         if (!success) break;
         std::string elementName = std::string(current.name());
         // editorial
@@ -3085,6 +3223,7 @@ bool MEIInput::ReadScore(Object *parent, pugi::xml_node score)
         else {
             LogWarning("Element <%s> within <score> is not supported and will be ignored ", elementName.c_str());
         }
+        this->ReleaseConsumedNode(score, current);
     }
 
     ReadUnsupportedAttr(score, vrvScore);
@@ -3103,9 +3242,11 @@ bool MEIInput::ReadSection(Object *parent, pugi::xml_node section)
     if (m_readingScoreBased) {
         return ReadSectionChildren(vrvSection, section);
     }
-    else {
-        return ReadSystemChildren(vrvSection, section);
+    // In page-based MEI, the section is a milestone closed by a <boundaryEnd> and has no content
+    else if (section.first_child()) {
+        LogWarning("The content of a <section> within <system> is not supported and will be ignored");
     }
+    return true;
 }
 
 bool MEIInput::ReadSectionChildren(Object *parent, pugi::xml_node parentNode)
@@ -3116,7 +3257,9 @@ bool MEIInput::ReadSectionChildren(Object *parent, pugi::xml_node parentNode)
     bool success = true;
     pugi::xml_node current;
     Measure *unmeasured = NULL;
-    for (current = parentNode.first_child(); current; current = current.next_sibling()) {
+    pugi::xml_node next;
+    for (current = parentNode.first_child(); current; current = next) {
+        next = current.next_sibling();
         if (!success) break;
         // editorial
         else if (IsEditorialElementName(current.name())) {
@@ -3174,6 +3317,7 @@ bool MEIInput::ReadSectionChildren(Object *parent, pugi::xml_node parentNode)
         else {
             LogWarning("Unsupported '<%s>' within <section>", current.name());
         }
+        this->ReleaseConsumedNode(parentNode, current);
     }
     return success;
 }
@@ -3303,7 +3447,9 @@ bool MEIInput::ReadPageChildren(Object *parent, pugi::xml_node parentNode)
     assert(dynamic_cast<Page *>(parent));
 
     pugi::xml_node current;
-    for (current = parentNode.first_child(); current; current = current.next_sibling()) {
+    pugi::xml_node next;
+    for (current = parentNode.first_child(); current; current = next) {
+        next = current.next_sibling();
         if (std::string(current.name()) == "system") {
             ReadSystem(parent, current);
         }
@@ -3325,6 +3471,7 @@ bool MEIInput::ReadPageChildren(Object *parent, pugi::xml_node parentNode)
         else {
             LogWarning("Unsupported '<%s>' within <page>", current.name());
         }
+        this->ReleaseConsumedNode(parentNode, current);
     }
 
     return true;
@@ -3365,7 +3512,9 @@ bool MEIInput::ReadSystemChildren(Object *parent, pugi::xml_node parentNode)
     bool success = true;
     pugi::xml_node current;
     Measure *unmeasured = NULL;
-    for (current = parentNode.first_child(); current; current = current.next_sibling()) {
+    pugi::xml_node next;
+    for (current = parentNode.first_child(); current; current = next) {
+        next = current.next_sibling();
         if (!success) break;
         // editorial
         else if (IsEditorialElementName(current.name())) {
@@ -3375,6 +3524,22 @@ bool MEIInput::ReadSystemChildren(Object *parent, pugi::xml_node parentNode)
         else if (std::string(current.name()) == "boundaryEnd") {
             success = ReadBoundaryEnd(parent, current);
         }
+        // system elements - as milestones for ending and section
+        else if (std::string(current.name()) == "ending") {
+            success = ReadEnding(parent, current);
+        }
+        else if (std::string(current.name()) == "expansion") {
+            success = ReadExpansion(parent, current);
+        }
+        else if (std::string(current.name()) == "section") {
+            success = ReadSection(parent, current);
+        }
+        else if (std::string(current.name()) == "pb") {
+            success = ReadPb(parent, current);
+        }
+        else if (std::string(current.name()) == "sb") {
+            success = ReadSb(parent, current);
+        }
         // content
         else if (std::string(current.name()) == "scoreDef") {
             // we should not have scoredef with unmeasured music within a system... (?)
@@ -3413,6 +3578,7 @@ bool MEIInput::ReadSystemChildren(Object *parent, pugi::xml_node parentNode)
         else {
             LogWarning("Unsupported '<%s>' within <system>", current.name());
         }
+        this->ReleaseConsumedNode(parentNode, current);
     }
     return success;
 }
@@ -3434,6 +3600,17 @@ bool MEIInput::ReadBoundaryEnd(Object *parent, pugi::xml_node boundaryEnd)
 
     BoundaryEnd *vrvBoundaryEnd = new BoundaryEnd(start);
     ReadSystemElement(boundaryEnd, vrvBoundaryEnd);
+    // The type is written by MEIOutput::WriteBoundaryEnd for the name of the start element and is not a @type
+    std::string meiElementName = start->GetClassName();
+    std::transform(meiElementName.begin(), meiElementName.begin() + 1, meiElementName.begin(), ::tolower);
+    if (vrvBoundaryEnd->GetType() == meiElementName) {
+        vrvBoundaryEnd->ResetTyped();
+    }
+    // The start element needs its end for preparing the boundaries, as with BoundaryStartInterface::ConvertToPageBasedBoundary
+    BoundaryStartInterface *interface = dynamic_cast<BoundaryStartInterface *>(start);
+    if (interface && !interface->IsBoundary()) {
+        interface->SetEnd(vrvBoundaryEnd);
+    }
 
     parent->AddChild(vrvBoundaryEnd);
     return true;
@@ -5666,13 +5843,7 @@ bool MEIInput::ReadAppChildren(Object *parent, pugi::xml_node parentNode, Editor
     assert(dynamic_cast<App *>(parent));
 
     // Check if one child node matches the m_appXPathQuery
-    pugi::xml_node selectedLemOrRdg;
-    std::vector<std::string> xPathQueries = m_doc->GetOptions()->m_appXPathQuery.GetValue();
-    if (xPathQueries.size() > 0) {
-        auto i = std::find_if(xPathQueries.begin(), xPathQueries.end(),
-            [parentNode](std::string &query) { return (parentNode.select_node(query.c_str())); });
-        if (i != xPathQueries.end()) selectedLemOrRdg = parentNode.select_node(i->c_str()).node();
-    }
+    pugi::xml_node selectedLemOrRdg = Doc::SelectXPathNode(parentNode, m_appXPathQueries);
 
     bool success = true;
     bool hasXPathSelected = false;
@@ -5735,15 +5906,7 @@ bool MEIInput::ReadChoiceChildren(Object *parent, pugi::xml_node parentNode, Edi
     assert(dynamic_cast<Choice *>(parent));
 
     // Check if one child node matches a value in m_choiceXPathQueries
-    pugi::xml_node selectedChild;
-    std::vector<std::string> xPathQueries = m_doc->GetOptions()->m_choiceXPathQuery.GetValue();
-    if (xPathQueries.size() > 0) {
-        auto i = std::find_if(xPathQueries.begin(), xPathQueries.end(),
-            [parentNode](std::string &query) { return (parentNode.select_node(query.c_str())); });
-        if (i != xPathQueries.end()) {
-            selectedChild = parentNode.select_node(i->c_str()).node();
-        }
-    }
+    pugi::xml_node selectedChild = Doc::SelectXPathNode(parentNode, m_choiceXPathQueries);
 
     bool success = true;
     bool hasXPathSelected = false;
@@ -5968,15 +6131,7 @@ bool MEIInput::ReadSubstChildren(Object *parent, pugi::xml_node parentNode, Edit
     assert(dynamic_cast<Subst *>(parent));
 
     // Check if one child node matches a value in m_substXPathQueries
-    pugi::xml_node selectedChild;
-    std::vector<std::string> xPathQueries = m_doc->GetOptions()->m_substXPathQuery.GetValue();
-    if (xPathQueries.size() > 0) {
-        auto i = std::find_if(xPathQueries.begin(), xPathQueries.end(),
-            [parentNode](std::string &query) { return (parentNode.select_node(query.c_str())); });
-        if (i != xPathQueries.end()) {
-            selectedChild = parentNode.select_node(i->c_str()).node();
-        }
-    }
+    pugi::xml_node selectedChild = Doc::SelectXPathNode(parentNode, m_substXPathQueries);
 
     bool success = true;
     bool hasXPathSelected = false;
@@ -258,7 +258,7 @@ data_STEMDIRECTION Layer::GetDrawingStemDir(const ArrayOfBeamElementCoords *coor
     assert(alignmentLast);
 
     // We are ignoring cross-staff situation here because this should not be called if we have one
-    Staff *staff = vrv_cast<Staff *>(first->GetFirstAncestor(STAFF));
+    Staff *staff = first->GetAncestorStaff();
     assert(staff);
 
     double time = alignmentFirst->GetTime();
@@ -286,7 +286,7 @@ int Layer::GetLayerCountForTimeSpanOf(LayerElement *element)
     Layer *layer = NULL;
     Staff *staff = element->GetCrossStaff(layer);
     if (!staff) {
-        staff = dynamic_cast<Staff *>(element->GetFirstAncestor(STAFF));
+        staff = element->GetAncestorStaff();
     }
     // At this stage we have the parent or the cross-staff
     assert(staff);
@@ -326,7 +326,7 @@ ListOfObjects Layer::GetLayerElementsForTimeSpanOf(LayerElement *element)
     Layer *layer = NULL;
     Staff *staff = element->GetCrossStaff(layer);
     if (!staff) {
-        staff = static_cast<Staff *>(element->GetFirstAncestor(STAFF));
+        staff = element->GetAncestorStaff();
     }
     // At this stage we have the parent or the cross-staff
     assert(staff);
@@ -49,6 +49,7 @@
 #include "space.h"
 #include "staff.h"
 #include "syl.h"
+#include "system.h"
 #include "tie.h"
 #include "timeinterface.h"
 #include "timestamp.h"
@@ -105,6 +106,12 @@ void LayerElement::Reset()
 
     m_crossStaff = NULL;
     m_crossLayer = NULL;
+
+    m_ancestorStaff = NULL;
+    m_ancestorLayer = NULL;
+    m_ancestorMeasure = NULL;
+    m_ancestorsParent = NULL;
+    m_ancestorsVersion = 0;
 }
 
 LayerElement::~LayerElement() {}
@@ -120,6 +127,8 @@ void LayerElement::CloneReset()
 
     m_crossStaff = NULL;
     m_crossLayer = NULL;
+
+    m_ancestorsVersion = 0;
 }
 
 LayerElement *LayerElement::ThisOrSameasAsLink()
@@ -229,6 +238,56 @@ Staff *LayerElement::GetCrossStaff(Layer *&layer) const
     return NULL;
 }
 
+Staff *LayerElement::GetAncestorStaff() const
+{
+    if (!this->HasValidAncestors()) this->UpdateAncestors();
+    return m_ancestorStaff;
+}
+
+Layer *LayerElement::GetAncestorLayer() const
+{
+    if (!this->HasValidAncestors()) this->UpdateAncestors();
+    return m_ancestorLayer;
+}
+
+Measure *LayerElement::GetAncestorMeasure() const
+{
+    if (!this->HasValidAncestors()) this->UpdateAncestors();
+    return m_ancestorMeasure;
+}
+
+System *LayerElement::GetAncestorSystem() const
+{
+    Measure *measure = this->GetAncestorMeasure();
+    Object *object = (measure) ? measure->GetFirstAncestor(SYSTEM) : this->GetFirstAncestor(SYSTEM);
+    return vrv_cast<System *>(object);
+}
+
+void LayerElement::UpdateAncestors() const
+{
+    m_ancestorStaff = NULL;
+    m_ancestorLayer = NULL;
+    m_ancestorMeasure = NULL;
+
+    // One walk for the three of them, stopping at the measure
+    for (Object *ancestor = this->GetParent(); ancestor; ancestor = ancestor->GetParent()) {
+        const ClassId classId = ancestor->GetClassId();
+        if (classId == LAYER) {
+            if (!m_ancestorLayer) m_ancestorLayer = vrv_cast<Layer *>(ancestor);
+        }
+        else if (classId == STAFF) {
+            if (!m_ancestorStaff) m_ancestorStaff = vrv_cast<Staff *>(ancestor);
+        }
+        else if (classId == MEASURE) {
+            m_ancestorMeasure = vrv_cast<Measure *>(ancestor);
+            break;
+        }
+    }
+
+    m_ancestorsParent = this->GetParent();
+    m_ancestorsVersion = Object::GetStructureVersion();
+}
+
 Alignment *LayerElement::GetGraceAlignment() const
 {
     assert(m_graceAlignment);
@@ -260,7 +319,7 @@ int LayerElement::GetDrawingX() const
     if (!m_alignment) {
         // assert(this->Is({ BEAM, FTREM, TUPLET }));
         // Here we just get the measure position - no cast to Measure is necessary
-        Object *measure = this->GetFirstAncestor(MEASURE);
+        Object *measure = this->GetAncestorMeasure();
         assert(measure);
         m_cachedDrawingX = measure->GetDrawingX();
         return m_cachedDrawingX;
@@ -275,7 +334,7 @@ int LayerElement::GetDrawingX() const
     }
 
     // Otherwise get the measure - no cast to Measure is necessary
-    Object *measure = this->GetFirstAncestor(MEASURE);
+    Object *measure = this->GetAncestorMeasure();
     assert(measure);
 
     int graceNoteShift = 0;
@@ -308,9 +367,9 @@ int LayerElement::GetDrawingY() const
     // artic, syl)
     if (!object && !this->IsRelativeToStaff()) object = this->GetFirstAncestorInRange(LAYER_ELEMENT, LAYER_ELEMENT_max);
     // Otherwise get the first staff
-    if (!object) object = this->GetFirstAncestor(STAFF);
+    if (!object) object = this->GetAncestorStaff();
     // Otherwise the first measure (this is the case with barLineAttr
-    if (!object) object = this->GetFirstAncestor(MEASURE);
+    if (!object) object = this->GetAncestorMeasure();
 
     assert(object);
 
@@ -379,7 +438,7 @@ void LayerElement::CenterDrawingX()
 
     SetDrawingXRel(0);
 
-    Measure *measure = vrv_cast<Measure *>(this->GetFirstAncestor(MEASURE));
+    Measure *measure = this->GetAncestorMeasure();
     assert(measure);
 
     SetDrawingXRel(measure->GetInnerCenterX() - this->GetDrawingX());
@@ -459,7 +518,7 @@ int LayerElement::GetDrawingRadius(Doc *doc, bool isInLigature)
 
     wchar_t code = 0;
     int dur = DUR_4;
-    Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *staff = this->GetAncestorStaff();
     assert(staff);
     if (this->Is(NOTE)) {
         Note *note = vrv_cast<Note *>(this);
@@ -871,7 +930,7 @@ int LayerElement::AlignHorizontally(FunctorParams *functorParams)
         m_alignment = note->GetAlignment();
     }
     else if (this->Is(SYL)) {
-        Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
+        Staff *staff = this->GetAncestorStaff();
         assert(staff);
 
         if (staff->m_drawingNotationType == NOTATIONTYPE_neume) {
@@ -922,7 +981,7 @@ int LayerElement::AlignHorizontally(FunctorParams *functorParams)
     else {
         assert(this->IsGraceNote());
         if (this->Is(CHORD) || (this->Is(NOTE) && !chordParent)) {
-            Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
+            Staff *staff = this->GetAncestorStaff();
             assert(staff);
             int graceAlignerId = params->m_doc->GetOptions()->m_graceRhythmAlign.GetValue() ? 0 : staff->GetN();
             GraceAligner *graceAligner = m_alignment->GetGraceAligner(graceAlignerId);
@@ -950,9 +1009,9 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
     if (this->IsScoreDefElement()) return FUNCTOR_SIBLINGS;
 
     LayerElement *layerElementY = this;
-    Staff *staffY = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *staffY = this->GetAncestorStaff();
     assert(staffY);
-    Layer *layerY = vrv_cast<Layer *>(this->GetFirstAncestor(LAYER));
+    Layer *layerY = this->GetAncestorLayer();
     assert(layerY);
 
     if (m_crossStaff && m_crossLayer) {
@@ -1029,7 +1088,7 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
         // Automatically calculate rest position
         else {
             // set default location to the middle of the staff
-            Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
+            Staff *staff = this->GetAncestorStaff();
             assert(staff);
             loc = staff->m_drawingLines - 1;
             // Limitation: GetLayerCount does not take into account editorial markup
@@ -1067,7 +1126,7 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
         // Automatically calculate rest position
         else {
             // set default location to the middle of the staff
-            Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
+            Staff *staff = this->GetAncestorStaff();
             assert(staff);
             loc = staff->m_drawingLines - 1;
 
@@ -1205,7 +1264,7 @@ int LayerElement::AdjustBeams(FunctorParams *functorParams)
         return FUNCTOR_SIBLINGS;
     if (Is({ GRACEGRP, TUPLET, TUPLET_NUM, TUPLET_BRACKET })) return FUNCTOR_CONTINUE;
 
-    Staff *staff = vrv_cast<Staff *>(GetFirstAncestor(STAFF));
+    Staff *staff = this->GetAncestorStaff();
     assert(staff);
 
     // check if top/bottom of the element overlaps with beam coordinates
@@ -1419,7 +1478,7 @@ int LayerElement::PrepareDrawingCueSize(FunctorParams *functorParams)
     }
     // This cover the case when the @size is given on the element
     else if (this->HasAttClass(ATT_CUE)) {
-        AttCue *att = dynamic_cast<AttCue *>(this);
+        AttCue *att = this->GetAttClass<AttCue>(ATT_CUE);
         assert(att);
         if (att->HasCue()) m_drawingCueSize = (att->GetCue() == BOOLEAN_true);
     }
@@ -1495,7 +1554,7 @@ int LayerElement::PrepareCrossStaff(FunctorParams *functorParams)
         return FUNCTOR_CONTINUE;
     }
 
-    Staff *parentStaff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *parentStaff = this->GetAncestorStaff();
     assert(parentStaff);
     // Check if we have a cross-staff to itself...
     if (m_crossStaff == parentStaff) {
@@ -1505,7 +1564,7 @@ int LayerElement::PrepareCrossStaff(FunctorParams *functorParams)
         return FUNCTOR_CONTINUE;
     }
 
-    Layer *parentLayer = vrv_cast<Layer *>(this->GetFirstAncestor(LAYER));
+    Layer *parentLayer = this->GetAncestorLayer();
     assert(parentLayer);
     // Now try to get the corresponding layer - for now look for the same layer @n
     int layerN = parentLayer->GetN();
@@ -1692,7 +1751,7 @@ int LayerElement::LayerElementsInTimeSpan(FunctorParams *functorParams)
     LayerElementsInTimeSpanParams *params = vrv_params_cast<LayerElementsInTimeSpanParams *>(functorParams);
     assert(params);
 
-    Layer *currentLayer = vrv_cast<Layer *>(GetFirstAncestor(LAYER));
+    Layer *currentLayer = this->GetAncestorLayer();
     if (!currentLayer || (currentLayer != params->m_layer) || IsScoreDefElement() || Is(MREST)) return FUNCTOR_SIBLINGS;
     if (!GetDurationInterface() || Is(MSPACE) || Is(SPACE) || HasSameasLink()) return FUNCTOR_CONTINUE;
 
@@ -123,7 +123,7 @@ int Ligature::CalcLigatureNotePos(FunctorParams *functorParams)
     m_drawingShapes.clear();
 
     Note *lastNote = dynamic_cast<Note *>(this->GetList(this)->back());
-    Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *staff = this->GetAncestorStaff();
     assert(staff);
 
     const ArrayOfObjects *notes = this->GetList(this);
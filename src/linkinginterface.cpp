@@ -113,7 +113,7 @@ int LinkingInterface::InterfaceFillStaffCurrentTimeSpanning(FunctorParams *funct
 
     // if @extender is available, the explicit "true" is required
     if (object->HasAttClass(ATT_EXTENDER)) {
-        AttExtender *att = dynamic_cast<AttExtender *>(object);
+        AttExtender *att = object->GetAttClass<AttExtender>(ATT_EXTENDER);
         assert(att);
         if (att->GetExtender() != BOOLEAN_true) return FUNCTOR_CONTINUE;
     }
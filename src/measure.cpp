@@ -135,6 +135,12 @@ void Measure::Reset()
     m_scoreTimeOffset.clear();
     m_realTimeOffsetMilliseconds.clear();
     m_currentTempo = 120;
+
+    m_cachedXRel = 0;
+    m_cachedWidth = 0;
+    m_cachedOverflow = 0;
+    m_cachedLayoutKey = 0;
+    m_cachedAlignments.clear();
 }
 
 bool Measure::IsSupportedChild(Object *child)
@@ -409,6 +415,13 @@ double Measure::GetRealTimeOffsetMilliseconds(int repeat) const
     return m_realTimeOffsetMilliseconds.at(repeat - 1);
 }
 
+double Measure::GetScoreTimeOffset(int repeat) const
+{
+    if (m_scoreTimeOffset.empty()) return 0.0;
+    if ((repeat < 1) || repeat > (int)m_scoreTimeOffset.size()) return m_scoreTimeOffset.back();
+    return m_scoreTimeOffset.at(repeat - 1);
+}
+
 void Measure::SetDrawingBarLines(Measure *previous, bool systemBreak, bool scoreDefInsert)
 {
     // First set the right barline. If none then set a single one.
@@ -914,13 +927,90 @@ int Measure::ResetDrawing(FunctorParams *functorParams)
     return FUNCTOR_CONTINUE;
 }
 
+int Measure::CacheHorizontalLayout(FunctorParams *functorParams)
+{
+    CacheHorizontalLayoutParams *params = vrv_params_cast<CacheHorizontalLayoutParams *>(functorParams);
+    assert(params);
+
+    if (params->m_restore) {
+        // The alignments have been rebuilt when the page was laid out - the content or the options have changed if the
+        // key does not match and the cache cannot be restored
+        if (this->CalcHorizontalLayoutKey(params->m_optionsHash) != m_cachedLayoutKey) {
+            params->m_changed = true;
+            return FUNCTOR_STOP;
+        }
+        this->SetDrawingXRel(m_cachedXRel);
+        // The alignments of the scoreDef of the system keep their page position when they are not cached
+        int cachedIdx = 0;
+        const int cachedCount = (int)m_cachedAlignments.size();
+        for (Object *child : *m_measureAligner.GetChildren()) {
+            Alignment *alignment = vrv_cast<Alignment *>(child);
+            assert(alignment);
+            for (int i = cachedIdx; i < cachedCount; ++i) {
+                if ((std::get<0>(m_cachedAlignments.at(i)) != alignment->GetTime())
+                    || (std::get<1>(m_cachedAlignments.at(i)) != alignment->GetType())) {
+                    continue;
+                }
+                alignment->SetXRel(std::get<2>(m_cachedAlignments.at(i)));
+                cachedIdx = i + 1;
+                break;
+            }
+        }
+    }
+    else {
+        m_cachedXRel = this->GetDrawingXRel();
+        m_cachedWidth = this->GetWidth();
+        m_cachedOverflow = this->GetDrawingOverflow();
+        m_cachedLayoutKey = this->CalcHorizontalLayoutKey(params->m_optionsHash);
+        m_cachedAlignments.clear();
+        m_cachedAlignments.reserve(m_measureAligner.GetChildCount());
+        for (Object *child : *m_measureAligner.GetChildren()) {
+            Alignment *alignment = vrv_cast<Alignment *>(child);
+            assert(alignment);
+            m_cachedAlignments.push_back({ alignment->GetTime(), alignment->GetType(), alignment->GetXRel() });
+        }
+    }
+
+    return FUNCTOR_SIBLINGS;
+}
+
+uint64_t Measure::CalcHorizontalLayoutKey(uint64_t optionsHash) const
+{
+    // FNV-1a over the bytes of the alignment values, starting with the hash of the options
+    uint64_t hash = optionsHash;
+    auto hashBytes = [&hash](const void *value, size_t size) {
+        const unsigned char *bytes = static_cast<const unsigned char *>(value);
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ULL;
+        }
+    };
+    for (Object *child : *m_measureAligner.GetChildren()) {
+        Alignment *alignment = vrv_cast<Alignment *>(child);
+        assert(alignment);
+        const AlignmentType type = alignment->GetType();
+        if (((type >= ALIGNMENT_SCOREDEF_CLEF) && (type <= ALIGNMENT_SCOREDEF_METERSIG))
+            || ((type >= ALIGNMENT_SCOREDEF_CAUTION_CLEF) && (type <= ALIGNMENT_SCOREDEF_CAUTION_METERSIG))) {
+            continue;
+        }
+        const double time = alignment->GetTime();
+        const int count = alignment->GetChildCount();
+        hashBytes(&time, sizeof(time));
+        hashBytes(&type, sizeof(type));
+        hashBytes(&count, sizeof(count));
+    }
+    return hash;
+}
+
 int Measure::CastOffSystems(FunctorParams *functorParams)
 {
     CastOffSystemsParams *params = vrv_params_cast<CastOffSystemsParams *>(functorParams);
     assert(params);
 
     // Check if the measure has some overlfowing control elements
-    int overflow = this->GetDrawingOverflow();
+    // With the cached layout the measure has not been laid out again and the values are the ones of the cache
+    const int overflow = (params->m_useCachedLayout) ? m_cachedOverflow : this->GetDrawingOverflow();
+    const int width = (params->m_useCachedLayout) ? m_cachedWidth : this->GetWidth();
 
     if (params->m_currentSystem->GetChildCount() > 0) {
         // We have overflowing content (dir, dynam, tempo) larger than 5 units, keep it as pending
@@ -933,7 +1023,7 @@ int Measure::CastOffSystems(FunctorParams *functorParams)
             return FUNCTOR_SIBLINGS;
         }
         // Break it if necessary
-        else if (this->m_drawingXRel + this->GetWidth() + params->m_currentScoreDefWidth - params->m_shift
+        else if (this->m_drawingXRel + width + params->m_currentScoreDefWidth - params->m_shift
             > params->m_systemWidth) {
             params->m_currentSystem = new System();
             params->m_page->AddChild(params->m_currentSystem);
@@ -1187,10 +1277,10 @@ int Measure::GenerateMIDI(FunctorParams *functorParams)
     assert(params);
 
     // Here we need to update the m_totalTime from the starting time of the measure.
-    params->m_totalTime = m_scoreTimeOffset.back();
+    params->m_totalTime = this->GetScoreTimeOffset(params->m_repeat);
 
     if (m_currentTempo != params->m_currentTempo) {
-        params->m_midiFile->addTempo(0, m_scoreTimeOffset.back() * params->m_midiFile->getTPQ(), m_currentTempo);
+        params->m_midiFile->addTempo(0, params->m_totalTime * params->m_midiFile->getTPQ(), m_currentTempo);
         params->m_currentTempo = m_currentTempo;
     }
 
@@ -1202,9 +1292,9 @@ int Measure::GenerateTimemap(FunctorParams *functorParams)
     GenerateTimemapParams *params = vrv_params_cast<GenerateTimemapParams *>(functorParams);
     assert(params);
 
-    // Deal with repeated music later, for now get the last times.
-    params->m_scoreTimeOffset = m_scoreTimeOffset.back();
-    params->m_realTimeOffsetMilliseconds = m_realTimeOffsetMilliseconds.back();
+    // With an expansion by reference, get the times of the current repeat
+    params->m_scoreTimeOffset = this->GetScoreTimeOffset(params->m_repeat);
+    params->m_realTimeOffsetMilliseconds = this->GetRealTimeOffsetMilliseconds(params->m_repeat);
     params->m_currentTempo = m_currentTempo;
 
     return FUNCTOR_CONTINUE;
@@ -1215,7 +1305,8 @@ int Measure::CalcMaxMeasureDuration(FunctorParams *functorParams)
     CalcMaxMeasureDurationParams *params = vrv_params_cast<CalcMaxMeasureDurationParams *>(functorParams);
     assert(params);
 
-    m_scoreTimeOffset.clear();
+    // With an expansion by reference, the offsets of each repeat are added
+    if (params->m_repeat <= 1) m_scoreTimeOffset.clear();
     m_scoreTimeOffset.push_back(params->m_maxCurrentScoreTime);
     params->m_maxCurrentScoreTime += m_measureAligner.GetRightAlignment()->GetTime() * DURATION_4 / DUR_MAX;
 
@@ -1237,7 +1328,7 @@ int Measure::CalcMaxMeasureDuration(FunctorParams *functorParams)
     }
     m_currentTempo = params->m_currentTempo * params->m_tempoAdjustment;
 
-    m_realTimeOffsetMilliseconds.clear();
+    if (params->m_repeat <= 1) m_realTimeOffsetMilliseconds.clear();
     // m_realTimeOffsetMilliseconds.push_back(int(params->m_maxCurrentRealTimeSeconds * 1000.0 + 0.5));
     m_realTimeOffsetMilliseconds.push_back(params->m_maxCurrentRealTimeSeconds * 1000.0);
     params->m_maxCurrentRealTimeSeconds
@@ -1256,4 +1347,17 @@ int Measure::CalcOnsetOffset(FunctorParams *functorParams)
     return FUNCTOR_CONTINUE;
 }
 
+
+int Measure::GetMemoryUsage(FunctorParams *functorParams)
+{
+    GetMemoryUsageParams *params = vrv_params_cast<GetMemoryUsageParams *>(functorParams);
+    assert(params);
+
+    if (m_drawingScoreDef) m_drawingScoreDef->Process(params->m_functor, params);
+    m_measureAligner.Process(params->m_functor, params);
+    m_timestampAligner.Process(params->m_functor, params);
+
+    return Object::GetMemoryUsage(functorParams);
+}
+
 } // namespace vrv
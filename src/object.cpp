@@ -13,10 +13,12 @@
 #include <climits>
 #include <iostream>
 #include <math.h>
+#include <mutex>
 #include <sstream>
 
 //----------------------------------------------------------------------------
 
+#include "att.h"
 #include "boundary.h"
 #include "chord.h"
 #include "clef.h"
@@ -52,11 +54,49 @@
 
 namespace vrv {
 
+//----------------------------------------------------------------------------
+// ClassIdDescriptor
+//----------------------------------------------------------------------------
+
+ClassIdDescriptor::ClassIdDescriptor(
+    const Object *object, const std::vector<AttClassId> &attClasses, const std::vector<InterfaceId> &interfaces)
+    : m_attOffsets(ATT_CLASS_max, VRV_UNSET)
+{
+    for (const InterfaceId interfaceId : interfaces) {
+        m_interfaces.set(interfaceId);
+    }
+
+    // The offsets are looked for in all the modules and kept only for the att classes registered
+    std::vector<int> offsets(ATT_CLASS_max, VRV_UNSET);
+    Att::GetAnalyticalOffsets(object, &offsets);
+    Att::GetCmnOffsets(object, &offsets);
+    Att::GetCmnornamentsOffsets(object, &offsets);
+    Att::GetCritappOffsets(object, &offsets);
+    Att::GetExternalsymbolsOffsets(object, &offsets);
+    Att::GetFacsimileOffsets(object, &offsets);
+    Att::GetGesturalOffsets(object, &offsets);
+    Att::GetMeiOffsets(object, &offsets);
+    Att::GetMensuralOffsets(object, &offsets);
+    Att::GetMidiOffsets(object, &offsets);
+    Att::GetNeumesOffsets(object, &offsets);
+    Att::GetPagebasedOffsets(object, &offsets);
+    Att::GetSharedOffsets(object, &offsets);
+    Att::GetVisualOffsets(object, &offsets);
+
+    for (const AttClassId attClassId : attClasses) {
+        m_attClasses.set(attClassId);
+        assert(offsets.at(attClassId) != VRV_UNSET);
+        m_attOffsets.at(attClassId) = offsets.at(attClassId);
+    }
+}
+
 //----------------------------------------------------------------------------
 // Object
 //----------------------------------------------------------------------------
 
 unsigned long Object::s_objectCounter = 0;
+std::atomic<unsigned long> Object::s_structureVersion(1);
+std::atomic<const ClassIdDescriptor *> Object::s_classIdDescriptors[UNSPECIFIED + 1];
 
 Object::Object() : BoundingBox()
 {
@@ -612,6 +652,37 @@ void Object::SetParent(Object *parent)
 {
     assert(!m_parent);
     m_parent = parent;
+    // Without children, only the cached ancestors of the object itself change, which is detected through its parent
+    if (!m_children.empty()) this->UpdateStructureVersion();
+}
+
+void Object::ResetParent()
+{
+    m_parent = NULL;
+    this->UpdateStructureVersion();
+}
+
+void Object::UpdateStructureVersion()
+{
+    // Measures and above can be moved (e.g., by the cast-off) without changing the cached ancestors
+    if (this->IsLayerElement() || this->IsEditorialElement() || this->Is(LAYER) || this->Is(STAFF)) {
+        s_structureVersion.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+const ClassIdDescriptor *Object::CreateClassIdDescriptor() const
+{
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const ClassId classId = this->GetClassId();
+    // Another thread might have created it in the meantime
+    const ClassIdDescriptor *descriptor = s_classIdDescriptors[classId].load(std::memory_order_relaxed);
+    if (!descriptor) {
+        descriptor = new ClassIdDescriptor(this, m_attClasses, m_interfaces);
+        s_classIdDescriptors[classId].store(descriptor, std::memory_order_release);
+    }
+    return descriptor;
 }
 
 bool Object::IsSupportedChild(Object *child)
@@ -1799,4 +1870,28 @@ int Object::FindPreviousChildByComparison(FunctorParams *functorparams)
     return FUNCTOR_CONTINUE;
 }
 
+int Object::GetMemoryUsage(FunctorParams *functorParams)
+{
+    GetMemoryUsageParams *params = vrv_params_cast<GetMemoryUsageParams *>(functorParams);
+    assert(params);
+
+    // The containers of the Object are not in the size returned by the derived classes
+    const size_t bytes = this->GetMemorySize() + m_children.capacity() * sizeof(Object *) + m_uuid.capacity()
+        + m_attClasses.capacity() * sizeof(AttClassId) + m_interfaces.capacity() * sizeof(InterfaceId);
+
+    if (this->Is({ ALIGNMENT, ALIGNMENT_REFERENCE, GRACE_ALIGNER, MEASURE_ALIGNER, STAFF_ALIGNMENT, SYSTEM_ALIGNER,
+            TIMESTAMP_ALIGNER, TIMESTAMP_ATTR })) {
+        params->m_aligners.first++;
+        params->m_aligners.second += bytes;
+    }
+    else {
+        std::pair<int, size_t> &usage = params->m_objects[this->GetClassName()];
+        usage.first++;
+        usage.second += bytes;
+    }
+
+    // The children of a reference object are counted with their owner
+    return (this->IsReferenceObject()) ? FUNCTOR_SIBLINGS : FUNCTOR_CONTINUE;
+}
+
 } // namespace vrv
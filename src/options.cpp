@@ -12,6 +12,7 @@
 #include <assert.h>
 #include <fstream>
 #include <functional>
+#include <set>
 #include <sstream>
 
 //----------------------------------------------------------------------------
@@ -647,10 +648,22 @@ Options::Options()
     m_humType.Init(false);
     this->Register(&m_humType, "humType", &m_general);
 
+    m_incrementalImport.SetInfo("Incremental import",
+        "Remove the MEI XML nodes of each measure once they have been read; the data is still parsed as a whole "
+        "beforehand and the peak memory usage is not reduced");
+    m_incrementalImport.Init(false);
+    this->Register(&m_incrementalImport, "incrementalImport", &m_general);
+
     m_justifyVertically.SetInfo("Justify vertically", "Justify spacing vertically to fill the page");
     m_justifyVertically.Init(false);
     this->Register(&m_justifyVertically, "justifyVertically", &m_general);
 
+    m_keepLoadedData.SetInfo("Keep loaded data",
+        "Keep a copy of the loaded data for applying the options requiring to load it again when they are changed; "
+        "otherwise these options are applied when the data is loaded next");
+    m_keepLoadedData.Init(false);
+    this->Register(&m_keepLoadedData, "keepLoadedData", &m_general);
+
     m_landscape.SetInfo("Landscape orientation", "The landscape paper orientation flag");
     m_landscape.Init(false);
     this->Register(&m_landscape, "landscape", &m_general);
@@ -729,6 +742,17 @@ Options::Options()
     m_expand.Init("");
     this->Register(&m_expand, "expand", &m_general);
 
+    m_expandByReference.SetInfo("Expand expansion by reference",
+        "Expand the expansion only for the MIDI and timemap output, without duplicating the content; the repeated "
+        "elements get their notated id with a -rend2, -rend3, etc. suffix");
+    m_expandByReference.Init(false);
+    this->Register(&m_expandByReference, "expandByReference", &m_general);
+
+    m_progressiveCastOff.SetInfo("Progressive cast-off",
+        "Cast off the pages only when they are rendered (the page count is an estimation until the end is reached)");
+    m_progressiveCastOff.Init(false);
+    this->Register(&m_progressiveCastOff, "progressiveCastOff", &m_general);
+
     m_shrinkToFit.SetInfo("Shrink content to fit page", "Scale down page content to fit the page height if needed");
     m_shrinkToFit.Init(false);
     this->Register(&m_shrinkToFit, "shrinkToFit", &m_general);
@@ -746,6 +770,12 @@ Options::Options()
     m_svgHtml5.Init(false);
     this->Register(&m_svgHtml5, "svgHtml5", &m_general);
 
+    m_svgCacheSize.SetInfo("Svg cache size",
+        "The size in bytes of the cache of the rendered SVG pages, with the least recently used pages discarded first "
+        "(0 for no cache)");
+    m_svgCacheSize.Init(0, 0, 1000000000);
+    this->Register(&m_svgCacheSize, "svgCacheSize", &m_general);
+
     m_unit.SetInfo("Unit", "The MEI unit (1⁄2 of the distance between the staff lines)");
     m_unit.Init(9, 6, 20, true);
     this->Register(&m_unit, "unit", &m_general);
@@ -1031,6 +1061,12 @@ Options::Options()
     m_transposeSelectedOnly.Init(false);
     this->Register(&m_transposeSelectedOnly, "transposeSelectedOnly", &m_selectors);
 
+    m_work.SetInfo("Work",
+        "Load only the work with this number (1-based) of an ABC tunebook, of a Humdrum file with segments or of an MEI "
+        "file with several top-level <mdiv> elements; by default the input is loaded as a whole");
+    m_work.Init(0, 0, 1000000);
+    this->Register(&m_work, "work", &m_selectors);
+
     /********* The layout left margin by element *********/
 
     m_elementMargins.SetLabel("Element margins", "4-elementMargins");
@@ -1217,6 +1253,42 @@ Options::Options()
     m_tieThickness.Init(0.5, 0.2, 1.0);
     this->Register(&m_tieThickness, "tieThickness", &m_deprecated);
 
+    /********* Invalidation levels *********/
+
+    // Options changing the horizontal layout or the page size, and thus the cast-off
+    for (OptionGrp *grp : { &m_generalLayout, &m_elementMargins, &m_deprecated }) {
+        for (Option *option : *grp->GetOptions()) {
+            option->SetInvalidation(INVALIDATION_castOff);
+        }
+    }
+    for (Option *option : { (Option *)&m_condense, (Option *)&m_condenseFirstPage, (Option *)&m_condenseTempoPages,
+             (Option *)&m_evenNoteSpacing, (Option *)&m_landscape, (Option *)&m_minLastJustification,
+             (Option *)&m_pageHeight, (Option *)&m_pageMarginBottom, (Option *)&m_pageMarginLeft,
+             (Option *)&m_pageMarginRight, (Option *)&m_pageMarginTop, (Option *)&m_pageWidth,
+             (Option *)&m_progressiveCastOff, (Option *)&m_unit, (Option *)&m_usePgFooterForAll,
+             (Option *)&m_usePgHeaderForAll }) {
+        option->SetInvalidation(INVALIDATION_castOff);
+    }
+    // Options used by Page::LayOut after the cast-off or drawn in the bounding boxes of the layout
+    for (Option *option : { (Option *)&m_adjustPageWidth, (Option *)&m_justifyVertically,
+             (Option *)&m_noJustification, (Option *)&m_svgBoundingBoxes, (Option *)&m_systemDivider,
+             (Option *)&m_useBraceGlyph }) {
+        option->SetInvalidation(INVALIDATION_layout);
+    }
+    // Options only used when writing the output are left to render
+    m_midiTempoAdjustment.SetInvalidation(INVALIDATION_render);
+    // Options used by Doc::PrepareDrawing
+    m_openControlEvents.SetInvalidation(INVALIDATION_prepare);
+    // Options used when loading the data
+    for (Option *option : { (Option *)&m_adjustPageHeight, (Option *)&m_breaks, (Option *)&m_expand,
+             (Option *)&m_expandByReference, (Option *)&m_footer, (Option *)&m_header, (Option *)&m_humType,
+             (Option *)&m_incrementalImport, (Option *)&m_mensuralToMeasure, (Option *)&m_useFacsimile }) {
+        option->SetInvalidation(INVALIDATION_reload);
+    }
+    for (Option *option : *m_selectors.GetOptions()) {
+        option->SetInvalidation(INVALIDATION_reload);
+    }
+
     /*
     // Example of a staffRel param
     OptionStaffrel rel;
@@ -1290,6 +1362,77 @@ void Options::Sync()
     }
 }
 
+uint64_t Options::GetHash(option_INVALIDATION invalidation) const
+{
+    // FNV-1a over the key / value pairs - the map is sorted by key so the order is always the same
+    uint64_t hash = 14695981039346656037ULL;
+    for (auto const &item : m_items) {
+        if (item.second->GetInvalidation() < invalidation) continue;
+        std::string keyValue = item.first + "=" + item.second->GetStrValue() + ";";
+        for (unsigned char c : keyValue) {
+            hash ^= c;
+            hash *= 1099511628211ULL;
+        }
+    }
+    return hash;
+}
+
+uint64_t Options::GetHorizontalLayoutHash() const
+{
+    const std::set<const Option *> pageOptions = { &m_condense, &m_condenseFirstPage, &m_condenseTempoPages,
+        &m_landscape, &m_minLastJustification, &m_pageHeight, &m_pageMarginBottom, &m_pageMarginLeft,
+        &m_pageMarginRight, &m_pageMarginTop, &m_pageWidth, &m_progressiveCastOff, &m_usePgFooterForAll,
+        &m_usePgHeaderForAll };
+
+    // FNV-1a over the key / value pairs as in Options::GetHash
+    uint64_t hash = 14695981039346656037ULL;
+    for (auto const &item : m_items) {
+        if (item.second->GetInvalidation() < INVALIDATION_castOff) continue;
+        if (pageOptions.count(item.second)) continue;
+        std::string keyValue = item.first + "=" + item.second->GetStrValue() + ";";
+        for (unsigned char c : keyValue) {
+            hash ^= c;
+            hash *= 1099511628211ULL;
+        }
+    }
+    return hash;
+}
+
+std::vector<std::string> Options::GetValues() const
+{
+    std::vector<std::string> values;
+    values.reserve(m_items.size());
+    for (auto const &item : m_items) {
+        values.push_back(item.second->GetStrValue());
+    }
+    return values;
+}
+
+option_INVALIDATION Options::GetInvalidation(const std::vector<std::string> &values) const
+{
+    assert(values.size() == m_items.size());
+
+    option_INVALIDATION invalidation = INVALIDATION_render;
+    int i = 0;
+    for (auto const &item : m_items) {
+        if ((item.second->GetInvalidation() > invalidation) && (item.second->GetStrValue() != values.at(i))) {
+            invalidation = item.second->GetInvalidation();
+        }
+        ++i;
+    }
+    return invalidation;
+}
+
+void Options::RestoreValues(const Options &options, option_INVALIDATION invalidation)
+{
+    for (auto const &item : m_items) {
+        if (item.second->GetInvalidation() != invalidation) continue;
+        Option *option = options.GetItems()->at(item.first);
+        assert(option);
+        option->CopyTo(item.second);
+    }
+}
+
 void Options::Register(Option *option, const std::string &key, OptionGrp *grp)
 {
     assert(option);
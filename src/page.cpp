@@ -22,6 +22,7 @@
 #include "pgfoot2.h"
 #include "pghead.h"
 #include "pghead2.h"
+#include "spatialindex.h"
 #include "staff.h"
 #include "system.h"
 #include "view.h"
@@ -35,10 +36,15 @@ namespace vrv {
 
 Page::Page() : Object("page-")
 {
+    m_spatialIndex = NULL;
+
     Reset();
 }
 
-Page::~Page() {}
+Page::~Page()
+{
+    this->ResetSpatialIndex();
+}
 
 void Page::Reset()
 {
@@ -46,6 +52,7 @@ void Page::Reset()
 
     m_drawingScoreDef.Reset();
     m_layoutDone = false;
+    this->ResetSpatialIndex();
     this->ResetUuid();
 
     // by default we have no values and use the document ones
@@ -151,6 +158,8 @@ void Page::LayOutTranscription(bool force)
     // Make sure we have the correct page
     assert(this == doc->GetDrawingPage());
 
+    this->ResetSpatialIndex();
+
     // Reset the horizontal alignment
     Functor resetHorizontalAlignment(&Object::ResetHorizontalAlignment);
     this->Process(&resetHorizontalAlignment, NULL);
@@ -219,6 +228,8 @@ void Page::LayOutHorizontally()
     // Make sure we have the correct page
     assert(this == doc->GetDrawingPage());
 
+    this->ResetSpatialIndex();
+
     // Reset the horizontal alignment
     Functor resetHorizontalAlignment(&Object::ResetHorizontalAlignment);
     this->Process(&resetHorizontalAlignment, NULL);
@@ -370,6 +381,8 @@ void Page::LayOutVertically()
     // Make sure we have the correct page
     assert(this == doc->GetDrawingPage());
 
+    this->ResetSpatialIndex();
+
     // Reset the vertical alignment
     Functor resetVerticalAlignment(&Object::ResetVerticalAlignment);
     this->Process(&resetVerticalAlignment, NULL);
@@ -392,6 +405,7 @@ void Page::LayOutVertically()
     this->Process(&calcArtic, &calcArticParams);
 
     // Render it for filling the bounding box
+    // This is the only full drawing of the vertical layout since all the elements have moved vertically
     View view;
     BBoxDeviceContext bBoxDC(&view, 0, 0);
     view.SetDoc(doc);
@@ -420,10 +434,10 @@ void Page::LayOutVertically()
     AdjustSlursParams adjustSlursParams(doc, &adjustSlurs);
     this->Process(&adjustSlurs, &adjustSlursParams);
 
-    // If slurs were adjusted we need to redraw to adjust the bounding boxes
-    if (adjustSlursParams.m_adjusted) {
+    // If slurs were adjusted (or moved) we need to redraw them to adjust their bounding boxes
+    if (!adjustSlursParams.m_adjustedPositioners.empty()) {
         view.SetPage(this->GetIdx(), false);
-        view.DrawCurrentPage(&bBoxDC, false);
+        view.DrawCurrentPagePositioners(&bBoxDC, adjustSlursParams.m_adjustedPositioners);
     }
 
     // Fill the arrays of bounding boxes (above and below) for each staff alignment for which the box overflows.
@@ -564,6 +578,8 @@ void Page::LayOutPitchPos()
     // Make sure we have the correct page
     assert(this == doc->GetDrawingPage());
 
+    this->ResetSpatialIndex();
+
     // Set the pitch / pos alignement
     SetAlignmentPitchPosParams setAlignmentPitchPosParams(doc);
     Functor setAlignmentPitchPos(&Object::SetAlignmentPitchPos);
@@ -574,6 +590,25 @@ void Page::LayOutPitchPos()
     this->Process(&calcStem, &calcStemParams);
 }
 
+SpatialIndex *Page::GetSpatialIndex()
+{
+    if (!m_spatialIndex) {
+        Doc *doc = vrv_cast<Doc *>(GetFirstAncestor(DOC));
+        assert(doc);
+        m_spatialIndex = new SpatialIndex();
+        m_spatialIndex->FillFromPage(doc, this);
+    }
+    return m_spatialIndex;
+}
+
+void Page::ResetSpatialIndex()
+{
+    if (m_spatialIndex) {
+        delete m_spatialIndex;
+        m_spatialIndex = NULL;
+    }
+}
+
 int Page::GetContentHeight() const
 {
     Doc *doc = vrv_cast<Doc *>(GetFirstAncestor(DOC));
@@ -252,7 +252,7 @@ void Rest::UpdateFromTransLoc(const TransPitch &tp)
 
 int Rest::GetOptimalLayerLocation(Staff *staff, Layer *layer, int defaultLocation)
 {
-    Layer *parentLayer = vrv_cast<Layer *>(this->GetFirstAncestor(LAYER));
+    Layer *parentLayer = this->GetAncestorLayer();
     if (!layer) return defaultLocation;
     const int layerCount = parentLayer->GetLayerCountForTimeSpanOf(this);
     // handle rest positioning for 2 layers. 3 layers and more are much more complex to solve
@@ -352,10 +352,10 @@ int Rest::GetLocationRelativeToCurrentLayer(Staff *currentStaff, Layer *currentL
 int Rest::GetFirstRelativeElementLocation(Staff *currentStaff, Layer *currentLayer, bool isPrevious, bool isTopLayer)
 {
     // current system
-    System *system = vrv_cast<System *>(GetFirstAncestor(SYSTEM));
+    System *system = this->GetAncestorSystem();
     assert(system);
     // current measure
-    Measure *measure = vrv_cast<Measure *>(GetFirstAncestor(MEASURE));
+    Measure *measure = this->GetAncestorMeasure();
     assert(measure);
 
     const int index = system->GetChildIndex(measure);
@@ -485,7 +485,7 @@ int Rest::CalcDots(FunctorParams *functorParams)
         return FUNCTOR_SIBLINGS;
     }
 
-    Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *staff = this->GetAncestorStaff();
     assert(staff);
 
     if (this->m_crossStaff) staff = this->m_crossStaff;
@@ -556,10 +556,10 @@ int Rest::Transpose(FunctorParams *functorParams)
     if ((!HasOloc() || !HasPloc()) && !HasLoc()) return FUNCTOR_SIBLINGS;
 
     // Find whether current layer is top, middle (either one if multiple) or bottom
-    Staff *parentStaff = vrv_cast<Staff *>(GetFirstAncestor(STAFF));
+    Staff *parentStaff = this->GetAncestorStaff();
     assert(parentStaff);
 
-    Layer *parentLayer = vrv_cast<Layer *>(GetFirstAncestor(LAYER));
+    Layer *parentLayer = this->GetAncestorLayer();
     assert(parentLayer);
 
     ListOfObjects objects;
@@ -0,0 +1,331 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        spatialindex.cpp
+// Author:      Laurent Pugin
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "spatialindex.h"
+
+//----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <assert.h>
+#include <climits>
+#include <math.h>
+
+//----------------------------------------------------------------------------
+
+#include "comparison.h"
+#include "doc.h"
+#include "facsimileinterface.h"
+#include "floatingobject.h"
+#include "page.h"
+#include "view.h"
+#include "vrv.h"
+#include "zone.h"
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// SpatialIndex
+//----------------------------------------------------------------------------
+
+SpatialIndex::SpatialIndex()
+{
+    this->Reset();
+}
+
+SpatialIndex::~SpatialIndex() {}
+
+void SpatialIndex::Reset()
+{
+    m_entries.clear();
+    m_gridIsBuilt = false;
+    m_gridX = 0;
+    m_gridY = 0;
+    m_cellSize = 1;
+    m_columns = 0;
+    m_rows = 0;
+    m_cells.clear();
+}
+
+void SpatialIndex::FillFromPage(Doc *doc, Page *page)
+{
+    assert(doc);
+    assert(page);
+
+    this->Reset();
+
+    // With facsimile documents, the objects are added with their zone
+    if (doc->GetType() == Facs) {
+        ListOfObjects objects;
+        InterfaceComparison comparison(INTERFACE_FACSIMILE);
+        page->FindAllDescendantByComparison(&objects, &comparison);
+        for (Object *object : objects) {
+            FacsimileInterface *interface = object->GetFacsimileInterface();
+            assert(interface);
+            if (!interface->HasFacs() || !interface->GetZone()) continue;
+            Zone *zone = interface->GetZone();
+            // A rotated zone rises (or falls) over its width
+            const int rise = (zone->GetLrx() - zone->GetUlx()) * tan(zone->GetRotate() * M_PI / 180.0);
+            this->Add(object, zone->GetUlx(), zone->GetUly() - std::max(0, rise), zone->GetLrx(),
+                zone->GetLry() - std::min(0, rise));
+        }
+        return;
+    }
+
+    // Otherwise draw the page for getting the bounding boxes, as Page::LayOut does
+    View view;
+    view.SetDoc(doc);
+    SpatialIndexDeviceContext spatialIndexDC(&view, this);
+    // Do not do the layout in this view - the page is expected to be laid out
+    view.SetPage(page->GetIdx(), false);
+    view.DrawCurrentPage(&spatialIndexDC, false);
+    spatialIndexDC.AddToIndex();
+}
+
+void SpatialIndex::Add(Object *object, int x1, int y1, int x2, int y2)
+{
+    assert(object);
+
+    m_entries.push_back({ object, std::min(x1, x2), std::min(y1, y2), std::max(x1, x2), std::max(y1, y2) });
+    m_gridIsBuilt = false;
+}
+
+void SpatialIndex::FindAtPoint(int x, int y, ArrayOfObjects *objects)
+{
+    assert(objects);
+
+    if (!m_gridIsBuilt) this->BuildGrid();
+    if (m_entries.empty()) return;
+
+    for (int i : m_cells.at(this->GetRow(y) * m_columns + this->GetColumn(x))) {
+        const Entry &entry = m_entries.at(i);
+        if ((x >= entry.m_x1) && (x <= entry.m_x2) && (y >= entry.m_y1) && (y <= entry.m_y2)) {
+            objects->push_back(entry.m_object);
+        }
+    }
+}
+
+void SpatialIndex::FindInRect(int x1, int y1, int x2, int y2, ArrayOfObjects *objects)
+{
+    assert(objects);
+
+    if (!m_gridIsBuilt) this->BuildGrid();
+    if (m_entries.empty()) return;
+
+    if (x1 > x2) std::swap(x1, x2);
+    if (y1 > y2) std::swap(y1, y2);
+
+    // The entries intersecting several cells are listed in each of them
+    std::vector<int> candidates;
+    for (int row = this->GetRow(y1); row <= this->GetRow(y2); ++row) {
+        for (int column = this->GetColumn(x1); column <= this->GetColumn(x2); ++column) {
+            const std::vector<int> &cell = m_cells.at(row * m_columns + column);
+            candidates.insert(candidates.end(), cell.begin(), cell.end());
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    for (int i : candidates) {
+        const Entry &entry = m_entries.at(i);
+        if ((x1 <= entry.m_x2) && (x2 >= entry.m_x1) && (y1 <= entry.m_y2) && (y2 >= entry.m_y1)) {
+            objects->push_back(entry.m_object);
+        }
+    }
+}
+
+Object *SpatialIndex::FindClosest(int x, int y, ClassId classId, const std::function<int(Object *)> &distance)
+{
+    if (!m_gridIsBuilt) this->BuildGrid();
+    if (m_entries.empty()) return NULL;
+
+    const int column = this->GetColumn(x);
+    const int row = this->GetRow(y);
+
+    int closest = -1;
+    int closestDistance = INT_MAX;
+    std::vector<int> visited;
+
+    // Look at the cells in growing rings around the one of the point
+    for (int ring = 0;; ++ring) {
+        const int column1 = column - ring;
+        const int column2 = column + ring;
+        const int row1 = row - ring;
+        const int row2 = row + ring;
+        for (int r = std::max(0, row1); r <= std::min(m_rows - 1, row2); ++r) {
+            // Only the first and last column of the ring on the rows in-between
+            const int step = ((r == row1) || (r == row2)) ? 1 : std::max(1, column2 - column1);
+            for (int c = column1; c <= column2; c += step) {
+                if ((c < 0) || (c >= m_columns)) continue;
+                for (int i : m_cells.at(r * m_columns + c)) {
+                    const Entry &entry = m_entries.at(i);
+                    if (entry.m_object->GetClassId() != classId) continue;
+                    if (std::find(visited.begin(), visited.end(), i) != visited.end()) continue;
+                    visited.push_back(i);
+                    int entryDistance = SpatialIndex::GetDistance(entry, x, y);
+                    if (distance) entryDistance = std::max(entryDistance, distance(entry.m_object));
+                    if ((entryDistance < closestDistance) || ((entryDistance == closestDistance) && (i < closest))) {
+                        closest = i;
+                        closestDistance = entryDistance;
+                    }
+                }
+            }
+        }
+
+        // The entries not visited yet are outside the cells covered so far, which can include the whole grid
+        int margin = INT_MAX;
+        if (column1 > 0) margin = std::min(margin, x - (m_gridX + column1 * m_cellSize));
+        if (column2 < m_columns - 1) margin = std::min(margin, m_gridX + (column2 + 1) * m_cellSize - x);
+        if (row1 > 0) margin = std::min(margin, y - (m_gridY + row1 * m_cellSize));
+        if (row2 < m_rows - 1) margin = std::min(margin, m_gridY + (row2 + 1) * m_cellSize - y);
+        if ((margin == INT_MAX) || ((closest != -1) && (closestDistance <= margin))) break;
+    }
+
+    return (closest != -1) ? m_entries.at(closest).m_object : NULL;
+}
+
+void SpatialIndex::BuildGrid()
+{
+    m_gridIsBuilt = true;
+    m_cells.clear();
+    m_columns = 0;
+    m_rows = 0;
+
+    if (m_entries.empty()) return;
+
+    int x2 = INT_MIN;
+    int y2 = INT_MIN;
+    m_gridX = INT_MAX;
+    m_gridY = INT_MAX;
+    for (const Entry &entry : m_entries) {
+        m_gridX = std::min(m_gridX, entry.m_x1);
+        m_gridY = std::min(m_gridY, entry.m_y1);
+        x2 = std::max(x2, entry.m_x2);
+        y2 = std::max(y2, entry.m_y2);
+    }
+
+    // Aim at about four objects per cell, without more cells than objects along a side
+    const double width = std::max(1.0, (double)x2 - m_gridX);
+    const double height = std::max(1.0, (double)y2 - m_gridY);
+    const double cellCount = std::max(1.0, m_entries.size() / 4.0);
+    double cellSize = sqrt(width * height / cellCount);
+    cellSize = std::max(cellSize, std::max(width, height) / cellCount);
+    m_cellSize = std::max(1, (int)ceil(cellSize));
+    m_columns = (int)(width / m_cellSize) + 1;
+    m_rows = (int)(height / m_cellSize) + 1;
+
+    m_cells.resize(m_columns * m_rows);
+    for (int i = 0; i < (int)m_entries.size(); ++i) {
+        const Entry &entry = m_entries.at(i);
+        for (int row = this->GetRow(entry.m_y1); row <= this->GetRow(entry.m_y2); ++row) {
+            for (int column = this->GetColumn(entry.m_x1); column <= this->GetColumn(entry.m_x2); ++column) {
+                m_cells.at(row * m_columns + column).push_back(i);
+            }
+        }
+    }
+}
+
+int SpatialIndex::GetColumn(int x) const
+{
+    if (x <= m_gridX) return 0;
+    return std::min(m_columns - 1, (x - m_gridX) / m_cellSize);
+}
+
+int SpatialIndex::GetRow(int y) const
+{
+    if (y <= m_gridY) return 0;
+    return std::min(m_rows - 1, (y - m_gridY) / m_cellSize);
+}
+
+size_t SpatialIndex::GetMemorySize() const
+{
+    size_t bytes = sizeof(*this) + m_entries.capacity() * sizeof(Entry);
+    bytes += m_cells.capacity() * sizeof(std::vector<int>);
+    for (const std::vector<int> &cell : m_cells) bytes += cell.capacity() * sizeof(int);
+    return bytes;
+}
+
+int SpatialIndex::GetDistance(const Entry &entry, int x, int y)
+{
+    const double xDiff = std::max({ entry.m_x1 - x, 0, x - entry.m_x2 });
+    const double yDiff = std::max({ entry.m_y1 - y, 0, y - entry.m_y2 });
+    return sqrt(xDiff * xDiff + yDiff * yDiff);
+}
+
+//----------------------------------------------------------------------------
+// SpatialIndexDeviceContext
+//----------------------------------------------------------------------------
+
+SpatialIndexDeviceContext::SpatialIndexDeviceContext(View *view, SpatialIndex *spatialIndex)
+    : BBoxDeviceContext(view, 0, 0)
+{
+    assert(spatialIndex);
+
+    m_spatialIndex = spatialIndex;
+}
+
+SpatialIndexDeviceContext::~SpatialIndexDeviceContext() {}
+
+void SpatialIndexDeviceContext::AddToIndex()
+{
+    for (const DrawnBox &drawnBox : m_drawnBoxes) {
+        if (!drawnBox.m_hasBox) continue;
+        m_spatialIndex->Add(drawnBox.m_object, drawnBox.m_x1, drawnBox.m_y1, drawnBox.m_x2, drawnBox.m_y2);
+    }
+    m_drawnBoxes.clear();
+}
+
+void SpatialIndexDeviceContext::StartGraphic(
+    Object *object, std::string gClass, std::string gId, bool primary, bool prepend)
+{
+    BBoxDeviceContext::StartGraphic(object, gClass, gId, primary, prepend);
+
+    // Keep the place of the object in z-order, before the one of its children
+    m_startedBoxes.push_back((int)m_drawnBoxes.size());
+    m_drawnBoxes.push_back({ object, false, 0, 0, 0, 0 });
+}
+
+void SpatialIndexDeviceContext::EndGraphic(Object *object, View *view)
+{
+    BBoxDeviceContext::EndGraphic(object, view);
+
+    assert(!m_startedBoxes.empty());
+    DrawnBox &drawnBox = m_drawnBoxes.at(m_startedBoxes.back());
+    m_startedBoxes.pop_back();
+    assert(drawnBox.m_object == object);
+
+    // Ignore the objects created by the view only for drawing
+    if (!this->IsChildOfParent(object)) return;
+
+    BoundingBox *box = object;
+    // Floating objects have their bounding box in the positioner of the system being drawn
+    if (object->IsFloatingObject()) {
+        box = vrv_cast<FloatingObject *>(object)->GetCurrentFloatingPositioner();
+        if (!box) return;
+    }
+    if (!box->HasContentBB()) return;
+
+    drawnBox.m_hasBox = true;
+    drawnBox.m_x1 = box->GetContentLeft();
+    drawnBox.m_y1 = box->GetContentBottom();
+    drawnBox.m_x2 = box->GetContentRight();
+    drawnBox.m_y2 = box->GetContentTop();
+}
+
+bool SpatialIndexDeviceContext::IsChildOfParent(Object *object)
+{
+    Object *parent = object->GetParent();
+    if (!parent) return false;
+
+    auto iter = m_parentChildren.find(parent);
+    if (iter == m_parentChildren.end()) {
+        const ArrayOfObjects *children = parent->GetChildren();
+        iter = m_parentChildren.emplace(parent, std::unordered_set<Object *>(children->begin(), children->end())).first;
+    }
+    return (iter->second.count(object) > 0);
+}
+
+} // namespace vrv
@@ -158,7 +158,7 @@ void SvgDeviceContext::Commit(bool xml_declaration)
 void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::string gId, bool primary, bool prepend)
 {
     if (object->HasAttClass(ATT_TYPED)) {
-        AttTyped *att = dynamic_cast<AttTyped *>(object);
+        AttTyped *att = object->GetAttClass<AttTyped>(ATT_TYPED);
         assert(att);
         if (att->HasType()) {
             gClass.append((gClass.empty() ? "" : " ") + att->GetType());
@@ -200,7 +200,7 @@ void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::str
     }
 
     if (object->HasAttClass(ATT_COLOR)) {
-        AttColor *att = dynamic_cast<AttColor *>(object);
+        AttColor *att = object->GetAttClass<AttColor>(ATT_COLOR);
         assert(att);
         if (att->HasColor()) {
             if (object->IsControlElement()) {
@@ -211,7 +211,7 @@ void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::str
     }
 
     if (object->HasAttClass(ATT_LABELLED)) {
-        AttLabelled *att = dynamic_cast<AttLabelled *>(object);
+        AttLabelled *att = object->GetAttClass<AttLabelled>(ATT_LABELLED);
         assert(att);
         if (att->HasLabel()) {
             pugi::xml_node svgTitle = m_currentNode.prepend_child("title");
@@ -221,7 +221,7 @@ void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::str
     }
 
     if (object->HasAttClass(ATT_LANG)) {
-        AttLang *att = dynamic_cast<AttLang *>(object);
+        AttLang *att = object->GetAttClass<AttLang>(ATT_LANG);
         assert(att);
         if (att->HasLang()) {
             m_currentNode.append_attribute("xml:lang") = att->GetLang().c_str();
@@ -229,7 +229,7 @@ void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::str
     }
 
     if (object->HasAttClass(ATT_TYPOGRAPHY)) {
-        AttTypography *att = dynamic_cast<AttTypography *>(object);
+        AttTypography *att = object->GetAttClass<AttTypography>(ATT_TYPOGRAPHY);
         assert(att);
         if (att->HasFontname()) m_currentNode.append_attribute("font-family") = att->GetFontname().c_str();
         if (att->HasFontstyle())
@@ -241,7 +241,7 @@ void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::str
     }
 
     if (object->HasAttClass(ATT_VISIBILITY)) {
-        AttVisibility *att = dynamic_cast<AttVisibility *>(object);
+        AttVisibility *att = object->GetAttClass<AttVisibility>(ATT_VISIBILITY);
         assert(att);
         if (att->HasVisible()) {
             if (att->GetVisible() == BOOLEAN_true) {
@@ -254,7 +254,7 @@ void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::str
     }
 
     if (object->HasAttClass(ATT_LINKING)) {
-        AttLinking *att = dynamic_cast<AttLinking *>(object);
+        AttLinking *att = object->GetAttClass<AttLinking>(ATT_LINKING);
         assert(att);
         if (att->HasFollows()) {
             m_currentNode.append_attribute("mei:follows") = att->GetFollows().c_str();
@@ -284,13 +284,13 @@ void SvgDeviceContext::StartTextGraphic(Object *object, std::string gClass, std:
     AppendIdAndClass(gId, object->GetClassName(), gClass);
 
     if (object->HasAttClass(ATT_COLOR)) {
-        AttColor *att = dynamic_cast<AttColor *>(object);
+        AttColor *att = object->GetAttClass<AttColor>(ATT_COLOR);
         assert(att);
         if (att->HasColor()) m_currentNode.append_attribute("fill") = att->GetColor().c_str();
     }
 
     if (object->HasAttClass(ATT_LABELLED)) {
-        AttLabelled *att = dynamic_cast<AttLabelled *>(object);
+        AttLabelled *att = object->GetAttClass<AttLabelled>(ATT_LABELLED);
         assert(att);
         if (att->HasLabel()) {
             pugi::xml_node svgTitle = m_currentNode.prepend_child("title");
@@ -300,7 +300,7 @@ void SvgDeviceContext::StartTextGraphic(Object *object, std::string gClass, std:
     }
 
     if (object->HasAttClass(ATT_LANG)) {
-        AttLang *att = dynamic_cast<AttLang *>(object);
+        AttLang *att = object->GetAttClass<AttLang>(ATT_LANG);
         assert(att);
         if (att->HasLang()) {
             m_currentNode.append_attribute("xml:lang") = att->GetLang().c_str();
@@ -308,7 +308,7 @@ void SvgDeviceContext::StartTextGraphic(Object *object, std::string gClass, std:
     }
 
     if (object->HasAttClass(ATT_TYPOGRAPHY)) {
-        AttTypography *att = dynamic_cast<AttTypography *>(object);
+        AttTypography *att = object->GetAttClass<AttTypography>(ATT_TYPOGRAPHY);
         assert(att);
         if (att->HasFontname()) m_currentNode.append_attribute("font-family") = att->GetFontname().c_str();
         if (att->HasFontstyle())
@@ -320,7 +320,7 @@ void SvgDeviceContext::StartTextGraphic(Object *object, std::string gClass, std:
     }
 
     if (object->HasAttClass(ATT_WHITESPACE)) {
-        AttWhitespace *att = dynamic_cast<AttWhitespace *>(object);
+        AttWhitespace *att = object->GetAttClass<AttWhitespace>(ATT_WHITESPACE);
         assert(att);
         if (att->HasSpace()) {
             m_currentNode.append_attribute("xml:space") = att->GetSpace().c_str();
@@ -968,6 +968,17 @@ std::string SvgDeviceContext::GetStringSVG(bool xml_declaration)
     return m_outdata.str();
 }
 
+std::string SvgDeviceContext::GetGraphicStringSVG(const std::string &gId)
+{
+    pugi::xml_node node = m_pageNode.find_child_by_attribute("g", (m_html5) ? "data-id" : "id", gId.c_str());
+    if (!node) return "";
+
+    std::ostringstream out;
+    std::string indent = (m_indent == -1) ? "\t" : std::string(m_indent, ' ');
+    node.print(out, indent.c_str(), pugi::format_default | pugi::format_no_declaration);
+    return out.str();
+}
+
 void SvgDeviceContext::DrawSvgBoundingBoxRectangle(int x, int y, int width, int height)
 {
     std::string s;
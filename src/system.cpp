@@ -880,4 +880,16 @@ int System::CastOffSystemsEnd(FunctorParams *functorParams)
     return FUNCTOR_STOP;
 }
 
+
+int System::GetMemoryUsage(FunctorParams *functorParams)
+{
+    GetMemoryUsageParams *params = vrv_params_cast<GetMemoryUsageParams *>(functorParams);
+    assert(params);
+
+    if (m_drawingScoreDef) m_drawingScoreDef->Process(params->m_functor, params);
+    m_systemAligner.Process(params->m_functor, params);
+
+    return Object::GetMemoryUsage(functorParams);
+}
+
 } // namespace vrv
@@ -0,0 +1,77 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        textextentcache.cpp
+// Author:      Laurent Pugin
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "textextentcache.h"
+
+//----------------------------------------------------------------------------
+
+namespace vrv {
+
+// The maximum number of extents, which is well above the number of distinct syllables of a long vocal score
+#define TEXT_EXTENT_CACHE_MAX_COUNT 20000
+
+//----------------------------------------------------------------------------
+// TextExtentCache
+//----------------------------------------------------------------------------
+
+TextExtentCache::TextExtentCache()
+{
+    this->Reset();
+}
+
+TextExtentCache::~TextExtentCache() {}
+
+void TextExtentCache::Reset()
+{
+    m_extents.clear();
+    m_count = 0;
+}
+
+void TextExtentCache::SetFontName(const std::string &fontName)
+{
+    if (fontName == m_fontName) return;
+
+    this->Reset();
+    m_fontName = fontName;
+}
+
+bool TextExtentCache::Find(const std::wstring &text, int pointSize, const Resources::StyleAttributes &style,
+    bool typeSize, TextExtend &extend) const
+{
+    auto iter = m_extents.find(text);
+    if (iter == m_extents.end()) return false;
+
+    for (const Entry &entry : iter->second) {
+        if ((entry.m_pointSize == pointSize) && (entry.m_style == style) && (entry.m_typeSize == typeSize)) {
+            extend = entry.m_extend;
+            return true;
+        }
+    }
+    return false;
+}
+
+void TextExtentCache::Add(const std::wstring &text, int pointSize, const Resources::StyleAttributes &style,
+    bool typeSize, const TextExtend &extend)
+{
+    if (m_count >= TEXT_EXTENT_CACHE_MAX_COUNT) this->Reset();
+
+    m_extents[text].push_back({ pointSize, style, typeSize, extend });
+    ++m_count;
+}
+
+size_t TextExtentCache::GetMemorySize() const
+{
+    size_t bytes = sizeof(*this) + m_extents.bucket_count() * sizeof(void *);
+    for (const auto &extents : m_extents) {
+        // A hash node has a pointer to the next one and the hash code besides its value
+        bytes += 2 * sizeof(void *) + sizeof(extents) + extents.first.capacity() * sizeof(wchar_t);
+        bytes += extents.second.capacity() * sizeof(Entry);
+    }
+    return bytes;
+}
+
+} // namespace vrv
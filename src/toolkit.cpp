@@ -10,11 +10,13 @@
 //----------------------------------------------------------------------------
 
 #include <assert.h>
+#include <set>
 
 //----------------------------------------------------------------------------
 
 #include "comparison.h"
 #include "custos.h"
+#include "displaylistdevicecontext.h"
 #include "editortoolkit_cmn.h"
 #include "editortoolkit_mensural.h"
 #include "editortoolkit_neume.h"
@@ -32,9 +34,14 @@
 #include "note.h"
 #include "options.h"
 #include "page.h"
+#include "pages.h"
 #include "slur.h"
+#include "spatialindex.h"
 #include "staff.h"
 #include "svgdevicecontext.h"
+#include "system.h"
+#include "timeinterface.h"
+#include "verticalaligner.h"
 #include "vrv.h"
 
 //----------------------------------------------------------------------------
@@ -49,6 +56,12 @@ namespace vrv {
 const char *UTF_16_BE_BOM = "\xFE\xFF";
 const char *UTF_16_LE_BOM = "\xFF\xFE";
 
+// The name of the processing instruction identifying a cast-off cache
+const char *CASTOFF_CACHE_PI = "verovio-cast-off";
+
+// The number of pages for which the state of Toolkit::RenderToSVGDiff is kept
+const size_t SVG_DIFF_PAGES = 16;
+
 std::map<std::string, ClassId> Toolkit::s_MEItoClassIdMap
     = { { "chord", CHORD }, { "rest", REST }, { "mRest", MREST }, { "mRpt", MRPT }, { "mRpt2", MRPT2 },
           { "multiRest", MULTIREST }, { "mulitRpt", MULTIRPT }, { "note", NOTE }, { "space", SPACE } };
@@ -63,6 +76,7 @@ Toolkit::Toolkit(bool initFont)
 {
     m_scale = DEFAULT_SCALE;
     m_inputFrom = AUTO;
+    m_workIndexFormat = UNKNOWN;
 
     m_humdrumBuffer = NULL;
     m_cString = NULL;
@@ -72,6 +86,12 @@ Toolkit::Toolkit(bool initFont)
     }
 
     m_options = m_doc.GetOptions();
+    m_invalidation = INVALIDATION_render;
+
+    m_svgCacheSize = 0;
+    m_svgCacheHits = 0;
+    m_svgCacheMisses = 0;
+    m_svgCacheEvictions = 0;
 
     m_editorToolkit = NULL;
 }
@@ -95,6 +115,7 @@ Toolkit::~Toolkit()
 bool Toolkit::SetResourcePath(const std::string &path)
 {
     Resources::SetPath(path);
+    this->ClearSVGCache();
     return Resources::InitFonts();
 }
 
@@ -390,10 +411,40 @@ bool Toolkit::LoadData(const std::string &data)
     std::string newData;
     Input *input = NULL;
 
+    // The data is kept for loading it again when options requiring it change, only if requested since it doubles
+    // the memory used by the input
+    if (m_options->m_keepLoadedData.GetValue()) {
+        m_loadedData = data;
+    }
+    else {
+        m_loadedData.clear();
+        m_loadedData.shrink_to_fit();
+    }
+
+    // The options changed so far are all applied by the loading
+    m_invalidation = INVALIDATION_render;
+    this->ClearSVGCache();
+    m_svgDiffPages.clear();
+
     auto inputFormat = m_inputFrom;
     if (inputFormat == AUTO) {
         inputFormat = IdentifyInputFrom(data);
     }
+
+    // With a work selected, only its part of the data is imported (with the header of the data)
+    std::string workData;
+    const int work = m_options->m_work.GetValue();
+    if (work > 0) {
+        if (!this->IndexWorks(data, inputFormat, work)) {
+            LogWarning("Works cannot be selected in this input format; the input is loaded as a whole");
+        }
+        else if (!m_workIndex.ExtractWork(data, work, workData)) {
+            LogError("Work %d not found in the input", work);
+            return false;
+        }
+    }
+    const std::string &content = (workData.empty()) ? data : workData;
+
     if (inputFormat == ABC) {
 #ifndef NO_ABC_SUPPORT
         input = new ABCInput(&m_doc);
@@ -429,7 +480,7 @@ bool Toolkit::LoadData(const std::string &data)
             tempinput->SetOutputFormat("humdrum");
         }
 
-        if (!tempinput->Import(data)) {
+        if (!tempinput->Import(content)) {
             LogError("Error importing Humdrum data (1)");
             delete tempinput;
             return false;
@@ -464,7 +515,7 @@ bool Toolkit::LoadData(const std::string &data)
         // This is the indirect converter from MusicXML to MEI using iohumdrum:
         hum::Tool_musicxml2hum converter;
         pugi::xml_document xmlfile;
-        xmlfile.load_string(data.c_str());
+        xmlfile.load_string(content.c_str());
         stringstream conversion;
         bool status = converter.convert(conversion, xmlfile);
         if (!status) {
@@ -494,7 +545,7 @@ bool Toolkit::LoadData(const std::string &data)
         // This is the indirect converter from MusicXML to MEI using iohumdrum:
         hum::Tool_mei2hum converter;
         pugi::xml_document xmlfile;
-        xmlfile.load_string(data.c_str());
+        xmlfile.load_string(content.c_str());
         stringstream conversion;
         bool status = converter.convert(conversion, xmlfile);
         if (!status) {
@@ -524,7 +575,7 @@ bool Toolkit::LoadData(const std::string &data)
         // This is the indirect converter from MuseData to MEI using iohumdrum:
         hum::Tool_musedata2hum converter;
         stringstream conversion;
-        bool status = converter.convertString(conversion, data);
+        bool status = converter.convertString(conversion, content);
         if (!status) {
             LogError("Error converting MuseData data");
             return false;
@@ -552,7 +603,7 @@ bool Toolkit::LoadData(const std::string &data)
         // This is the indirect converter from EsAC to MEI using iohumdrum:
         hum::Tool_esac2hum converter;
         stringstream conversion;
-        bool status = converter.convert(conversion, data);
+        bool status = converter.convert(conversion, content);
         if (!status) {
             LogError("Error converting EsAC data");
             return false;
@@ -588,74 +639,29 @@ bool Toolkit::LoadData(const std::string &data)
     }
 
     // load the file
-    if (!input->Import(newData.size() ? newData : data)) {
+    if (!input->Import(newData.size() ? newData : content)) {
         LogError("Error importing data");
         delete input;
         return false;
     }
 
-    bool adjustPageHeight = m_options->m_adjustPageHeight.GetValue();
-    int footerOption = m_options->m_footer.GetValue();
-    // With adjusted page height, show the footer if explicitly set (i.e., not with "auto")
-    // generate the page header and footer if necessary
-    if ((!adjustPageHeight && (footerOption == FOOTER_auto)) || (footerOption == FOOTER_always)) {
-        m_doc.GenerateFooter();
-    }
-    if (m_options->m_header.GetValue() == HEADER_auto) {
-        m_doc.GenerateHeader();
-    }
-
-    // generate missing measure numbers
-    m_doc.GenerateMeasureNumbers();
-
-    // transpose the content if necessary
+    // transpose the content if necessary - this only needs the loaded content and not the drawing preparation
     if (m_options->m_transpose.GetValue() != "") {
-        m_doc.PrepareDrawing();
         m_doc.TransposeDoc();
     }
 
-    m_doc.PrepareDrawing();
-
-    // Convert pseudo-measures into distinct segments based on barLine elements
-    if (m_doc.IsMensuralMusicOnly()) {
-        m_doc.ConvertToCastOffMensuralDoc();
-    }
-
-    // Do the layout? this depends on the options and the file. PAE and
-    // DARMS have no layout information. MEI files _can_ have it, but it
-    // might have been ignored because of the --breaks auto option.
-    // Regardless, we won't do layout if the --breaks none option was set.
-    int breaks = m_options->m_breaks.GetValue();
-    // Always set breaks to 'none' with Transcription or Facs rendering - rendering them differenty requires the MEI to
-    // be converted
-    if (m_doc.GetType() == Transcription || m_doc.GetType() == Facs) breaks = BREAKS_none;
-    if (breaks != BREAKS_none) {
-        if (input->HasLayoutInformation() && (breaks == BREAKS_encoded || breaks == BREAKS_line)) {
-            if (breaks == BREAKS_encoded) {
-                // LogElapsedTimeStart();
-                m_doc.CastOffEncodingDoc();
-                // LogElapsedTimeEnd("layout");
-            }
-            else if (breaks == BREAKS_line) {
-                m_doc.CastOffLineDoc();
-            }
-        }
-        else {
-            if (breaks == BREAKS_encoded) {
-                LogWarning("Requesting layout with encoded breaks but nothing provided in the data");
-            }
-            else if (breaks == BREAKS_line) {
-                LogWarning("Requesting layout with line breaks but nothing provided in the data");
-            }
-            // LogElapsedTimeStart();
-            m_doc.CastOffDoc();
-            // LogElapsedTimeEnd("layout");
-        }
-    }
+    this->PrepareLoadedDoc(input->HasLayoutInformation());
 
     delete input;
     m_view.SetDoc(&m_doc);
 
+    this->CreateEditorToolkit();
+
+    return true;
+}
+
+void Toolkit::CreateEditorToolkit()
+{
 #if defined NO_HUMDRUM_SUPPORT
     // Create editor toolkit based on notation type.
     if (m_editorToolkit != NULL) {
@@ -670,8 +676,46 @@ bool Toolkit::LoadData(const std::string &data)
         default: m_editorToolkit = new EditorToolkitCMN(&m_doc, &m_view);
     }
 #endif
+}
 
-    return true;
+std::string Toolkit::GetWorks(const std::string &data)
+{
+    jsonxx::Object o;
+    jsonxx::Array a;
+
+    auto inputFormat = m_inputFrom;
+    if (inputFormat == AUTO) {
+        inputFormat = IdentifyInputFrom(data);
+    }
+
+    if (this->IndexWorks(data, inputFormat)) {
+        int n = 1;
+        for (const WorkIndex::Work &work : m_workIndex.GetWorks()) {
+            jsonxx::Object w;
+            w << "n" << n++;
+            w << "offset" << work.m_offset;
+            w << "length" << work.m_length;
+            w << "id" << work.m_id;
+            w << "title" << work.m_title;
+            a << w;
+        }
+    }
+    o << "works" << a;
+
+    return o.json();
+}
+
+bool Toolkit::IndexWorks(const std::string &data, FileFormat inputFormat, int maxWorks)
+{
+    if ((inputFormat == m_workIndexFormat) && m_workIndex.IsIndexOf(data, maxWorks)) return true;
+
+    m_workIndexFormat = inputFormat;
+    switch (inputFormat) {
+        case ABC: m_workIndex.IndexABC(data, maxWorks); return true;
+        case HUMDRUM: m_workIndex.IndexHumdrum(data, maxWorks); return true;
+        case MEI: m_workIndex.IndexMEI(data, maxWorks); return true;
+        default: m_workIndex.Reset(); return false;
+    }
 }
 
 std::string Toolkit::GetMEI(const std::string &jsonOptions)
@@ -692,11 +736,16 @@ std::string Toolkit::GetMEI(const std::string &jsonOptions)
         if (json.has<jsonxx::Boolean>("removeIds")) removeIds = json.get<jsonxx::Boolean>("removeIds");
     }
 
+    this->ApplyInvalidation();
+
     if (GetPageCount() == 0) {
         LogWarning("No data loaded");
         return "";
     }
 
+    // The pages need to be all cast off for a page-based output
+    m_doc.ContinueCastOffDoc();
+
     int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
     // Page number is one-based - correct it to 0-based first
     pageNo--;
@@ -730,6 +779,127 @@ bool Toolkit::SaveFile(const std::string &filename, const std::string &jsonOptio
     return true;
 }
 
+static std::string GetPIAttribute(const std::string &pi, const std::string &attribute)
+{
+    const size_t start = pi.find(" " + attribute + "=\"");
+    if (start == std::string::npos) return "";
+    const size_t valueStart = start + attribute.size() + 3;
+    const size_t valueEnd = pi.find('"', valueStart);
+    if (valueEnd == std::string::npos) return "";
+    return pi.substr(valueStart, valueEnd - valueStart);
+}
+
+std::string Toolkit::GetCastOffCache()
+{
+    this->ApplyInvalidation();
+
+    if (GetPageCount() == 0) {
+        LogWarning("No data loaded");
+        return "";
+    }
+
+    m_doc.ContinueCastOffDoc();
+
+    int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
+
+    // The page-based MEI preserves the cast-off page and system structure
+    MEIOutput meioutput(&m_doc);
+    meioutput.SetScoreBasedMEI(false);
+    meioutput.SetIndent(0);
+    std::string cache = meioutput.GetOutput();
+    if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
+
+    if (cache.empty()) {
+        LogError("The cast-off cache could not be created");
+        return "";
+    }
+
+    // The processing instruction is added after the XML declaration and is ignored when reading the MEI
+    const std::string pi = StringFormat("<?%s version=\"%s\" options=\"%016llx\"?>\n", CASTOFF_CACHE_PI,
+        vrv::GetVersion().c_str(), (unsigned long long)m_options->GetHash(INVALIDATION_castOff));
+    const size_t declarationEnd = (cache.compare(0, 5, "<?xml") == 0) ? cache.find('\n') : std::string::npos;
+    cache.insert((declarationEnd == std::string::npos) ? 0 : declarationEnd + 1, pi);
+
+    return cache;
+}
+
+bool Toolkit::LoadCastOffCache(const std::string &cache)
+{
+    // The processing instruction has to be in the prolog, before the root element
+    const size_t piStart = cache.find(std::string("<?") + CASTOFF_CACHE_PI + " ");
+    const size_t piEnd = (piStart == std::string::npos) ? std::string::npos : cache.find("?>", piStart);
+    if ((piEnd == std::string::npos) || (piStart > cache.find("<mei"))) {
+        LogError("The data is not a cast-off cache");
+        return false;
+    }
+    const std::string pi = cache.substr(piStart, piEnd - piStart);
+
+    if (GetPIAttribute(pi, "version") != vrv::GetVersion()) {
+        LogWarning("The cast-off cache was made with another version and cannot be loaded");
+        return false;
+    }
+    const std::string options
+        = StringFormat("%016llx", (unsigned long long)m_options->GetHash(INVALIDATION_castOff));
+    if (GetPIAttribute(pi, "options") != options) {
+        LogWarning("The cast-off cache was made with different options and cannot be loaded");
+        return false;
+    }
+
+    m_doc.m_expansionMap.Reset();
+    // The options requiring to load the data again cannot be changed with the cast-off cache
+    m_loadedData.clear();
+    m_invalidation = INVALIDATION_render;
+    this->ClearSVGCache();
+    m_svgDiffPages.clear();
+
+    MEIInput input(&m_doc);
+    if (!input.Import(cache)) {
+        LogError("Error loading the cast-off cache");
+        return false;
+    }
+
+    // The content was already transposed when the cache was made
+    this->PrepareLoadedDoc(true, true);
+
+    m_view.SetDoc(&m_doc);
+    this->CreateEditorToolkit();
+
+    return true;
+}
+
+bool Toolkit::SaveCastOffCacheFile(const std::string &filename)
+{
+    std::string cache = GetCastOffCache();
+    if (cache.empty()) return false;
+
+    std::ofstream outfile(filename.c_str());
+    if (!outfile.is_open()) {
+        return false;
+    }
+
+    outfile << cache;
+    outfile.close();
+    return true;
+}
+
+bool Toolkit::LoadCastOffCacheFile(const std::string &filename)
+{
+    std::ifstream in(filename.c_str());
+    if (!in.is_open()) {
+        return false;
+    }
+
+    in.seekg(0, std::ios::end);
+    std::streamsize fileSize = (std::streamsize)in.tellg();
+    in.clear();
+    in.seekg(0, std::ios::beg);
+
+    std::string cache(fileSize, 0);
+    in.read(&cache[0], fileSize);
+
+    return LoadCastOffCache(cache);
+}
+
 std::string Toolkit::GetOptions(bool defaultValues) const
 {
     jsonxx::Object o;
@@ -882,6 +1052,15 @@ bool Toolkit::SetOptions(const std::string &jsonOptions)
         return false;
     }
 
+    // Keep the previous values for finding out what has to be computed again
+    std::vector<std::string> previousValues = m_options->GetValues();
+    // And the previous options when the loaded document cannot be loaded again for options needing it
+    Options *previousOptions = NULL;
+    if (!this->CanReload()) {
+        previousOptions = new Options();
+        *previousOptions = *m_options;
+    }
+
     std::map<std::string, jsonxx::Value *> jsonMap = json.kv_map();
     std::map<std::string, jsonxx::Value *>::const_iterator iter;
     for (iter = jsonMap.begin(); iter != jsonMap.end(); ++iter) {
@@ -1093,7 +1272,24 @@ bool Toolkit::SetOptions(const std::string &jsonOptions)
         LogWarning("Font '%s' could not be loaded", m_options->m_font.GetValue().c_str());
     }
 
-    return true;
+    // The changes are applied only when the pages are accessed
+    option_INVALIDATION invalidation = m_options->GetInvalidation(previousValues);
+    bool success = true;
+    if (previousOptions) {
+        if (invalidation == INVALIDATION_reload) {
+            LogError("Options requiring to load the data again cannot be changed after the document was edited or "
+                     "restored from a cast-off cache");
+            m_options->RestoreValues(*previousOptions, INVALIDATION_reload);
+            invalidation = m_options->GetInvalidation(previousValues);
+            success = false;
+        }
+        delete previousOptions;
+    }
+    // Without the loaded data kept, the options requiring it are applied when the data is loaded next
+    if ((invalidation == INVALIDATION_reload) && m_loadedData.empty()) invalidation = INVALIDATION_prepare;
+    m_invalidation = std::max(m_invalidation, invalidation);
+
+    return success;
 }
 
 std::string Toolkit::GetOption(const std::string &option, bool defaultValue) const
@@ -1115,22 +1311,125 @@ bool Toolkit::SetOption(const std::string &option, const std::string &value)
     }
     Option *opt = m_options->GetItems()->at(option);
     assert(opt);
-    return opt->SetValue(value);
+    if ((opt->GetInvalidation() == INVALIDATION_reload) && !this->CanReload()) {
+        LogError("Option '%s' cannot be changed after the document was edited or restored from a cast-off cache",
+            option.c_str());
+        return false;
+    }
+    std::string previousValue = opt->GetStrValue();
+    if (!opt->SetValue(value)) return false;
+    if (opt->GetStrValue() != previousValue) {
+        option_INVALIDATION invalidation = opt->GetInvalidation();
+        // Without the loaded data kept, the options requiring it are applied when the data is loaded next
+        if ((invalidation == INVALIDATION_reload) && m_loadedData.empty()) invalidation = INVALIDATION_prepare;
+        m_invalidation = std::max(m_invalidation, invalidation);
+    }
+    return true;
+}
+
+bool Toolkit::SwitchSelection(const std::string &jsonSelection)
+{
+    jsonxx::Object json;
+
+    // Read JSON selection
+    if (!json.parse(jsonSelection)) {
+        LogError("Cannot parse JSON std::string.");
+        return false;
+    }
+
+    if (m_doc.GetPageCount() == 0) {
+        LogWarning("No data loaded");
+        return false;
+    }
+    if (!m_options->m_expand.GetValue().empty()) {
+        LogError("The selection cannot be switched with an expansion; the data has to be loaded again");
+        return false;
+    }
+
+    // Check the selection options first, so nothing is changed when one is not supported
+    const std::vector<std::string> selectors = { "mdivXPathQuery", "appXPathQuery", "choiceXPathQuery",
+        "substXPathQuery" };
+    std::map<std::string, jsonxx::Value *> jsonMap = json.kv_map();
+    for (auto &item : jsonMap) {
+        if (std::find(selectors.begin(), selectors.end(), item.first) == selectors.end()) {
+            LogError("Unsupported selection option '%s'", item.first.c_str());
+            return false;
+        }
+        if (!json.has<jsonxx::String>(item.first) && !json.has<jsonxx::Array>(item.first)) {
+            LogError("Unsupported type for option '%s'", item.first.c_str());
+            return false;
+        }
+    }
+
+    // The selection skeleton is built from the whole content the first time the selection is switched
+    this->ApplyInvalidation();
+    if (!m_doc.m_selectionSkeleton.first_child()) {
+        m_doc.ContinueCastOffDoc();
+        int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
+        m_doc.BuildSelectionSkeleton();
+        if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
+    }
+
+    // Change the selection options without the invalidation of the data
+    for (auto &item : jsonMap) {
+        Option *opt = m_options->GetItems()->at(item.first);
+        assert(opt);
+        if (json.has<jsonxx::String>(item.first)) {
+            opt->SetValue(json.get<jsonxx::String>(item.first));
+        }
+        else if (json.has<jsonxx::Array>(item.first)) {
+            jsonxx::Array values = json.get<jsonxx::Array>(item.first);
+            std::vector<std::string> strValues;
+            for (int i = 0; i < (int)values.size(); ++i) {
+                if (values.has<jsonxx::String>(i)) strValues.push_back(values.get<jsonxx::String>(i));
+            }
+            opt->SetValueArray(strValues);
+        }
+    }
+
+    // Nothing to switch with only one mdiv and no reading
+    if (!m_doc.m_selectionSkeleton.first_element_by_path("/mei/music/body").first_child()) return true;
+
+    // The readings are selected first since the content of a new mdiv can be converted with them
+    const bool readingsChanged = m_doc.SelectReadings();
+    const bool mdivChanged = m_doc.SelectMdiv();
+    if (!readingsChanged && !mdivChanged) return true;
+
+    this->ClearSVGCache();
+    if (mdivChanged) {
+        // The content of the mdiv is laid out as after loading the data
+        Pages *pages = m_doc.GetPages();
+        assert(pages);
+        this->PrepareLoadedDoc(pages->FindDescendantByType(SB) || pages->FindDescendantByType(PB));
+        m_view.SetDoc(&m_doc);
+        if (m_invalidation != INVALIDATION_reload) m_invalidation = INVALIDATION_render;
+    }
+    else {
+        m_invalidation = std::max(m_invalidation, INVALIDATION_prepare);
+    }
+
+    return true;
 }
 
 std::string Toolkit::GetElementAttr(const std::string &xmlId)
 {
+    this->ApplyInvalidation();
+
     jsonxx::Object o;
 
     Object *element = NULL;
 
+    // The repetitions of an expansion by reference are the notated element
+    int repeat = 1;
+    const std::string notatedId = m_doc.m_expansionMap.GetNotatedReferenceId(xmlId, repeat);
+
     // Try to get the element on the current drawing page - it is usually the case and fast
     if (m_doc.GetDrawingPage()) {
-        element = m_doc.GetDrawingPage()->FindDescendantByUuid(xmlId);
+        element = m_doc.GetDrawingPage()->FindDescendantByUuid(notatedId);
     }
     // If it wasn't there, try on the whole doc
     if (!element) {
-        element = m_doc.FindDescendantByUuid(xmlId);
+        element = m_doc.FindDescendantByUuid(notatedId);
     }
     // If not found at all
     if (!element) {
@@ -1175,7 +1474,24 @@ std::string Toolkit::GetExpansionIdsForElement(const std::string &xmlId)
 
 bool Toolkit::Edit(const std::string &json_editorAction)
 {
-    return m_editorToolkit->ParseEditorAction(json_editorAction);
+    // Editing requires the final page structure with the options applied
+    this->ApplyInvalidation();
+    m_doc.ContinueCastOffDoc();
+    this->ClearSVGCache();
+
+    bool success = m_editorToolkit->ParseEditorAction(json_editorAction);
+    // The loaded data does not correspond to the document anymore
+    if (success) m_loadedData.clear();
+
+    // The action might have removed objects in the spatial indexes
+    Pages *pages = m_doc.GetPages();
+    if (pages) {
+        for (Object *child : *pages->GetChildren()) {
+            vrv_cast<Page *>(child)->ResetSpatialIndex();
+        }
+    }
+
+    return success;
 }
 
 std::string Toolkit::EditInfo()
@@ -1210,14 +1526,36 @@ void Toolkit::ResetLogBuffer()
 #endif
 }
 
-void Toolkit::RedoLayout()
+void Toolkit::RedoLayout(const std::string &jsonOptions)
 {
+    bool resetCache = true;
+
+    if (!jsonOptions.empty()) {
+        jsonxx::Object json;
+
+        // Read JSON options
+        if (!json.parse(jsonOptions)) {
+            LogWarning("Cannot parse JSON std::string. Using default options.");
+        }
+        else {
+            if (json.has<jsonxx::Boolean>("resetCache")) resetCache = json.get<jsonxx::Boolean>("resetCache");
+        }
+    }
+
+    // Option changes requiring more than a cast-off are applied first, which includes the cast-off
+    if (m_invalidation > INVALIDATION_castOff) {
+        this->ApplyInvalidation();
+        return;
+    }
+    m_invalidation = INVALIDATION_render;
+    this->ClearSVGCache();
+
     if ((GetPageCount() == 0) || (m_doc.GetType() == Transcription) || (m_doc.GetType() == Facs)) {
         LogWarning("No data to re-layout");
         return;
     }
 
-    m_doc.UnCastOffDoc();
+    m_doc.UnCastOffDoc(resetCache);
     if (m_options->m_breaks.GetValue() == BREAKS_line) {
         m_doc.CastOffLineDoc();
     }
@@ -1226,26 +1564,148 @@ void Toolkit::RedoLayout()
     }
 }
 
-void Toolkit::RedoPagePitchPosLayout()
+bool Toolkit::CanReload()
 {
-    Page *page = m_doc.GetDrawingPage();
+    return (!m_loadedData.empty() || (m_doc.GetPageCount() == 0) || !m_options->m_keepLoadedData.GetValue());
+}
 
-    if (!page) {
-        LogWarning("No page to re-layout");
+void Toolkit::ApplyInvalidation()
+{
+    if (m_invalidation == INVALIDATION_render) return;
+
+    option_INVALIDATION invalidation = m_invalidation;
+    m_invalidation = INVALIDATION_render;
+    this->ClearSVGCache();
+
+    if (m_doc.GetPageCount() == 0) return;
+
+    if (invalidation == INVALIDATION_reload) {
+        assert(!m_loadedData.empty());
+        m_doc.m_expansionMap.Reset();
+        // Loading it clears the member when the data is no longer to be kept
+        std::string data;
+        data.swap(m_loadedData);
+        this->LoadData(data);
         return;
     }
 
-    page->LayOutPitchPos();
+    // Only documents cast off with automatic breaks depend on the horizontal layout for their pages and systems.
+    // Otherwise the systems are laid out again with the pages.
+    int breaks = m_options->m_breaks.GetValue();
+    bool castOff = (breaks == BREAKS_auto || breaks == BREAKS_line) && (m_doc.GetType() != Transcription)
+        && (m_doc.GetType() != Facs);
+
+    if (castOff && (invalidation >= INVALIDATION_castOff)) {
+        m_doc.UnCastOffDoc();
+        if (invalidation == INVALIDATION_prepare) m_doc.PrepareDrawing();
+        if (breaks == BREAKS_line) {
+            m_doc.CastOffLineDoc();
+        }
+        else {
+            m_doc.CastOffDoc();
+        }
+        return;
+    }
+
+    if (invalidation == INVALIDATION_prepare) {
+        m_doc.PrepareDrawing();
+        m_doc.SetCurrentScoreDefDoc(true);
+    }
+    m_doc.ResetLayoutDoc();
 }
 
-bool Toolkit::RenderToDeviceContext(int pageNo, DeviceContext *deviceContext)
+void Toolkit::PrepareLoadedDoc(bool hasLayoutInformation, bool isCastOff)
 {
-    if (pageNo > GetPageCount()) {
-        LogWarning("Page %d does not exist", pageNo);
-        return false;
+    bool adjustPageHeight = m_options->m_adjustPageHeight.GetValue();
+    int footerOption = m_options->m_footer.GetValue();
+    // With adjusted page height, show the footer if explicitly set (i.e., not with "auto")
+    // generate the page header and footer if necessary
+    if ((!adjustPageHeight && (footerOption == FOOTER_auto)) || (footerOption == FOOTER_always)) {
+        m_doc.GenerateFooter();
+    }
+    if (m_options->m_header.GetValue() == HEADER_auto) {
+        m_doc.GenerateHeader();
     }
 
-    // Page number is one-based - correct it to 0-based first
+    // generate missing measure numbers
+    m_doc.GenerateMeasureNumbers();
+
+    m_doc.PrepareDrawing();
+
+    // Convert pseudo-measures into distinct segments based on barLine elements
+    if (m_doc.IsMensuralMusicOnly()) {
+        m_doc.ConvertToCastOffMensuralDoc();
+    }
+
+    // The pages and systems are already the ones of the cast-off document - we only need to reset the scoreDef as
+    // Doc::CastOffDoc does at the end
+    if (isCastOff) {
+        m_doc.SetCurrentScoreDefDoc(true);
+        if (m_doc.IsOptimizationNeeded()) {
+            m_doc.OptimizeScoreDefDoc();
+        }
+        return;
+    }
+
+    // Do the layout? this depends on the options and the file. PAE and
+    // DARMS have no layout information. MEI files _can_ have it, but it
+    // might have been ignored because of the --breaks auto option.
+    // Regardless, we won't do layout if the --breaks none option was set.
+    int breaks = m_options->m_breaks.GetValue();
+    // Always set breaks to 'none' with Transcription or Facs rendering - rendering them differenty requires the MEI to
+    // be converted
+    if (m_doc.GetType() == Transcription || m_doc.GetType() == Facs) breaks = BREAKS_none;
+    if (breaks != BREAKS_none) {
+        if (hasLayoutInformation && (breaks == BREAKS_encoded || breaks == BREAKS_line)) {
+            if (breaks == BREAKS_encoded) {
+                // LogElapsedTimeStart();
+                m_doc.CastOffEncodingDoc();
+                // LogElapsedTimeEnd("layout");
+            }
+            else if (breaks == BREAKS_line) {
+                m_doc.CastOffLineDoc();
+            }
+        }
+        else {
+            if (breaks == BREAKS_encoded) {
+                LogWarning("Requesting layout with encoded breaks but nothing provided in the data");
+            }
+            else if (breaks == BREAKS_line) {
+                LogWarning("Requesting layout with line breaks but nothing provided in the data");
+            }
+            // LogElapsedTimeStart();
+            m_doc.CastOffDoc();
+            // LogElapsedTimeEnd("layout");
+        }
+    }
+}
+
+void Toolkit::RedoPagePitchPosLayout()
+{
+    Page *page = m_doc.GetDrawingPage();
+
+    if (!page) {
+        LogWarning("No page to re-layout");
+        return;
+    }
+
+    page->LayOutPitchPos();
+    this->ClearSVGCache();
+}
+
+bool Toolkit::RenderToDeviceContext(int pageNo, DeviceContext *deviceContext)
+{
+    this->ApplyInvalidation();
+
+    // With a progressive cast-off, make sure the page exists and is complete
+    m_doc.ContinueCastOffDoc(pageNo - 1);
+
+    if (pageNo > m_doc.GetPageCount()) {
+        LogWarning("Page %d does not exist", pageNo);
+        return false;
+    }
+
+    // Page number is one-based - correct it to 0-based first
     pageNo--;
 
     // Get the current system for the SVG clipping size
@@ -1285,39 +1745,413 @@ bool Toolkit::RenderToDeviceContext(int pageNo, DeviceContext *deviceContext)
 
 std::string Toolkit::RenderToSVG(int pageNo, bool xml_declaration)
 {
+    // Option changes can empty the cache
+    this->ApplyInvalidation();
+
     int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
+
+    // Look for the page in the cache - the options changing the layout empty it, and all the other ones are in the key
+    size_t cacheMaxSize = m_options->m_svgCacheSize.GetValue();
+    std::string cacheKey;
+    if (cacheMaxSize > 0) {
+        cacheKey = StringFormat("%d;%d;%d;%016llx", pageNo, xml_declaration, m_scale,
+            (unsigned long long)m_options->GetHash(INVALIDATION_render));
+        auto entry = m_svgCacheIndex.find(cacheKey);
+        if (entry != m_svgCacheIndex.end()) {
+            ++m_svgCacheHits;
+            m_svgCache.splice(m_svgCache.begin(), m_svgCache, entry->second);
+            if (initialPageNo < 0) m_view.SetPage(pageNo - 1);
+            return entry->second->second;
+        }
+        ++m_svgCacheMisses;
+    }
+    else if (!m_svgCache.empty()) {
+        this->ClearSVGCache();
+    }
+
     // Create the SVG object, h & w come from the system
     // We will need to set the size of the page after having drawn it depending on the options
     SvgDeviceContext svg;
+    this->InitSVGDeviceContext(&svg);
+
+    // render the page
+    bool rendered = RenderToDeviceContext(pageNo, &svg);
+
+    std::string out_str = svg.GetStringSVG(xml_declaration);
+    if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
+
+    if (rendered && (cacheMaxSize > 0) && (out_str.size() + cacheKey.size() <= cacheMaxSize)) {
+        m_svgCache.push_front({ cacheKey, out_str });
+        m_svgCacheIndex[cacheKey] = m_svgCache.begin();
+        m_svgCacheSize += out_str.size() + cacheKey.size();
+        // Discard the least recently used pages
+        while (m_svgCacheSize > cacheMaxSize) {
+            m_svgCacheSize -= m_svgCache.back().first.size() + m_svgCache.back().second.size();
+            m_svgCacheIndex.erase(m_svgCache.back().first);
+            m_svgCache.pop_back();
+            ++m_svgCacheEvictions;
+        }
+    }
+
+    return out_str;
+}
+
+std::string Toolkit::RenderToSVGRegion(int pageNo, int x, int y, int width, int height, bool xml_declaration)
+{
+    int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
+
+    SvgDeviceContext svg;
+    this->InitSVGDeviceContext(&svg);
+
+    // render the page with only the region
+    m_view.SetDrawingRegion(x, y, width, height);
+    RenderToDeviceContext(pageNo, &svg);
+    m_view.ResetDrawingRegion();
+
+    std::string out_str = svg.GetStringSVG(xml_declaration);
+    if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
+
+    return out_str;
+}
+
+//----------------------------------------------------------------------------
+// SVG diff helpers
+//----------------------------------------------------------------------------
+
+/**
+ * Return the position of a system, of its staves and of its measures, which changes when it is laid out again
+ */
+static std::vector<int> GetSVGDiffLayout(System *system)
+{
+    std::vector<int> layout;
+    layout.push_back(system->GetDrawingX());
+    layout.push_back(system->GetDrawingY());
+    for (Object *child : *system->m_systemAligner.GetChildren()) {
+        StaffAlignment *alignment = vrv_cast<StaffAlignment *>(child);
+        assert(alignment);
+        layout.push_back(alignment->GetYRel());
+    }
+    for (Object *child : *system->GetChildren()) {
+        if (!child->Is(MEASURE)) continue;
+        Measure *measure = vrv_cast<Measure *>(child);
+        assert(measure);
+        layout.push_back(measure->GetDrawingX());
+        layout.push_back(measure->GetWidth());
+    }
+    return layout;
+}
+
+/**
+ * Return true if a time spanning element drawn in the system starts or ends in one of the systems
+ */
+static bool HasSVGDiffSpanningElement(System *system, const ArrayOfObjects &systems)
+{
+    for (Object *object : *system->GetDrawingList()) {
+        TimeSpanningInterface *interface = object->GetTimeSpanningInterface();
+        if (!interface) continue;
+        for (LayerElement *element : { interface->GetStart(), interface->GetEnd() }) {
+            if (!element) continue;
+            Object *elementSystem = element->GetFirstAncestor(SYSTEM);
+            if (std::find(systems.begin(), systems.end(), elementSystem) != systems.end()) return true;
+        }
+    }
+    return false;
+}
+
+std::string Toolkit::RenderToSVGDiff(int pageNo)
+{
+    this->ApplyInvalidation();
+
+    int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
+
+    jsonxx::Object o;
+    o << "page" << pageNo;
+
+    auto previous = m_svgDiffPages.begin();
+    for (; previous != m_svgDiffPages.end(); ++previous) {
+        if (previous->m_pageNo == pageNo) break;
+    }
+
+    // With a progressive cast-off, make sure the page exists and is complete
+    m_doc.ContinueCastOffDoc(pageNo - 1);
+    if ((pageNo < 1) || (pageNo > m_doc.GetPageCount())) {
+        LogWarning("Page %d does not exist", pageNo);
+        if (previous != m_svgDiffPages.end()) m_svgDiffPages.erase(previous);
+        o << "full" << true;
+        o << "svg" << "";
+        return o.json();
+    }
+
+    // Lay out the page for getting the position of its systems
+    m_view.SetPage(pageNo - 1);
+    Page *page = m_doc.GetDrawingPage();
+    assert(page);
+
+    SVGDiffPage current;
+    current.m_pageNo = pageNo;
+    current.m_key = StringFormat("%s;%d;%016llx", page->GetUuid().c_str(), m_scale,
+        (unsigned long long)m_options->GetHash(INVALIDATION_render));
+    ArrayOfObjects systems;
+    for (Object *child : *page->GetChildren()) {
+        if (!child->Is(SYSTEM)) continue;
+        System *system = vrv_cast<System *>(child);
+        assert(system);
+        systems.push_back(system);
+        current.m_systems.push_back({ system->GetUuid(), GetSVGDiffLayout(system) });
+    }
+
+    // The modifications are not tracked in facsimile and transcription documents
+    bool full = ((previous == m_svgDiffPages.end()) || (previous->m_key != current.m_key)
+        || (previous->m_systems.size() != current.m_systems.size()) || (m_doc.GetType() == Facs)
+        || (m_doc.GetType() == Transcription));
+    ArrayOfObjects changedSystems;
+    for (int i = 0; !full && (i < (int)systems.size()); ++i) {
+        if (previous->m_systems.at(i).first != current.m_systems.at(i).first) {
+            full = true;
+        }
+        else if (systems.at(i)->IsModified() || (previous->m_systems.at(i).second != current.m_systems.at(i).second)) {
+            changedSystems.push_back(systems.at(i));
+        }
+    }
+    // The systems sharing a time spanning element with a changed system are drawn again too
+    for (int i = 0; !full && !changedSystems.empty() && (i < (int)systems.size()); ++i) {
+        System *system = vrv_cast<System *>(systems.at(i));
+        assert(system);
+        if (std::find(changedSystems.begin(), changedSystems.end(), system) != changedSystems.end()) continue;
+        if (HasSVGDiffSpanningElement(system, changedSystems)) changedSystems.push_back(system);
+    }
+
+    jsonxx::Object changed;
+    if (!full && !changedSystems.empty()) {
+        SvgDeviceContext svg;
+        this->InitSVGDeviceContext(&svg);
+        m_view.SetDrawingSystems(changedSystems);
+        this->RenderToDeviceContext(pageNo, &svg);
+        m_view.ResetDrawingSystems();
+        current.m_size = StringFormat("%d;%d;%d", svg.GetWidth(), svg.GetHeight(), svg.GetContentHeight());
+        current.m_glyphs = previous->m_glyphs;
+        current.m_vrvTextFont = previous->m_vrvTextFont;
+        // The SVG needs to be replaced when its size or its definitions change
+        full = ((current.m_size != previous->m_size) || (svg.UsesVrvTextFont() && !previous->m_vrvTextFont)
+            || !std::includes(current.m_glyphs.begin(), current.m_glyphs.end(), svg.GetSmuflGlyphs().begin(),
+                svg.GetSmuflGlyphs().end()));
+        for (Object *system : changedSystems) {
+            changed << system->GetUuid() << svg.GetGraphicStringSVG(system->GetUuid());
+        }
+    }
+    else if (!full) {
+        current.m_size = previous->m_size;
+        current.m_glyphs = previous->m_glyphs;
+        current.m_vrvTextFont = previous->m_vrvTextFont;
+    }
+
+    o << "full" << full;
+    if (full) {
+        SvgDeviceContext svg;
+        this->InitSVGDeviceContext(&svg);
+        this->RenderToDeviceContext(pageNo, &svg);
+        current.m_size = StringFormat("%d;%d;%d", svg.GetWidth(), svg.GetHeight(), svg.GetContentHeight());
+        current.m_glyphs = svg.GetSmuflGlyphs();
+        current.m_vrvTextFont = svg.UsesVrvTextFont();
+        o << "svg" << svg.GetStringSVG();
+    }
+    else {
+        o << "changed" << changed;
+    }
+    if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
+
+    // The modifications are now the ones since this rendering
+    for (Object *system : systems) {
+        system->Modify(false);
+    }
+
+    if (previous != m_svgDiffPages.end()) m_svgDiffPages.erase(previous);
+    m_svgDiffPages.push_front(current);
+    if (m_svgDiffPages.size() > SVG_DIFF_PAGES) m_svgDiffPages.pop_back();
+
+    return o.json();
+}
+
+bool Toolkit::RenderToDisplayList(int pageNo, DisplayListDeviceContext *displayList)
+{
+    assert(displayList);
+
+    int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
+
+    displayList->Reset();
+    bool rendered = RenderToDeviceContext(pageNo, displayList);
+    if (rendered) displayList->SetPPUFactor(m_view.GetPPUFactor());
+
+    if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
+    return rendered;
+}
+
+std::string Toolkit::RenderDisplayListToSVG(DisplayListDeviceContext *displayList, bool xml_declaration)
+{
+    assert(displayList);
+
+    SvgDeviceContext svg;
+    this->InitSVGDeviceContext(&svg);
+
+    // The current scale is used and not the one of the recording, with the pixel per unit factor of the page recorded
+    double userScale = displayList->GetPPUFactor() * m_scale / 100;
+    svg.SetUserScale(userScale, userScale);
+    displayList->Replay(&svg);
+
+    return svg.GetStringSVG(xml_declaration);
+}
+
+void Toolkit::InitSVGDeviceContext(SvgDeviceContext *svg)
+{
+    assert(svg);
 
     int indent = (m_options->m_outputIndentTab.GetValue()) ? -1 : m_options->m_outputIndent.GetValue();
-    svg.SetIndent(indent);
+    svg->SetIndent(indent);
 
     if (m_options->m_mmOutput.GetValue()) {
-        svg.SetMMOutput(true);
+        svg->SetMMOutput(true);
     }
 
     if (m_doc.GetType() == Facs) {
-        svg.SetFacsimile(true);
+        svg->SetFacsimile(true);
     }
 
     // set the option to use viewbox on svg root
     if (m_options->m_svgBoundingBoxes.GetValue()) {
-        svg.SetSvgBoundingBoxes(true);
+        svg->SetSvgBoundingBoxes(true);
     }
 
     if (m_options->m_svgViewBox.GetValue()) {
-        svg.SetSvgViewBox(true);
+        svg->SetSvgViewBox(true);
     }
 
-    svg.SetHtml5(m_options->m_svgHtml5.GetValue());
+    svg->SetHtml5(m_options->m_svgHtml5.GetValue());
+}
 
-    // render the page
-    RenderToDeviceContext(pageNo, &svg);
+std::string Toolkit::GetSVGCacheStats() const
+{
+    jsonxx::Object o;
+    o << "hits" << m_svgCacheHits;
+    o << "misses" << m_svgCacheMisses;
+    o << "evictions" << m_svgCacheEvictions;
+    o << "pages" << (int)m_svgCache.size();
+    o << "size" << (int)m_svgCacheSize;
+    o << "maxSize" << m_options->m_svgCacheSize.GetValue();
+    return o.json();
+}
 
-    std::string out_str = svg.GetStringSVG(xml_declaration);
-    if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
-    return out_str;
+std::string Toolkit::GetMemoryUsage()
+{
+    auto usageToJson = [](int count, size_t bytes) {
+        jsonxx::Object u;
+        u << "count" << count;
+        u << "bytes" << bytes;
+        return u;
+    };
+
+    jsonxx::Object o;
+    size_t total = 0;
+
+    MapOfStrMemoryUsages objects;
+    MapOfStrMemoryUsages layout;
+    m_doc.GetMemoryUsage(objects, layout);
+
+    jsonxx::Object classes;
+    int docCount = 0;
+    size_t docBytes = 0;
+    for (const auto &usage : objects) {
+        classes << usage.first << usageToJson(usage.second.first, usage.second.second);
+        docCount += usage.second.first;
+        docBytes += usage.second.second;
+    }
+    jsonxx::Object doc = usageToJson(docCount, docBytes);
+    doc << "classes" << classes;
+    o << "doc" << doc;
+    total += docBytes;
+
+    jsonxx::Object layoutStructures;
+    for (const auto &usage : layout) {
+        layoutStructures << usage.first << usageToJson(usage.second.first, usage.second.second);
+        total += usage.second.second;
+    }
+    o << "layout" << layoutStructures;
+
+    const size_t expansionMapBytes = m_doc.m_expansionMap.GetMemorySize();
+    o << "expansionMap" << usageToJson((int)m_doc.m_expansionMap.m_map.size(), expansionMapBytes);
+    total += expansionMapBytes;
+
+    // The spatial indexes of the pages filled for hit-testing
+    int spatialIndexCount = 0;
+    size_t spatialIndexBytes = 0;
+    Pages *pages = m_doc.GetPages();
+    if (pages) {
+        for (Object *child : *pages->GetChildren()) {
+            const SpatialIndex *spatialIndex = vrv_cast<Page *>(child)->GetFilledSpatialIndex();
+            if (!spatialIndex) continue;
+            ++spatialIndexCount;
+            spatialIndexBytes += spatialIndex->GetMemorySize();
+        }
+    }
+    o << "spatialIndexes" << usageToJson(spatialIndexCount, spatialIndexBytes);
+    total += spatialIndexBytes;
+
+    // The skeleton of the mdivs and readings kept once the selection was switched
+    const std::pair<int, size_t> selectionSkeletonUsage = m_doc.GetSelectionSkeletonMemoryUsage();
+    o << "selectionSkeleton" << usageToJson(selectionSkeletonUsage.first, selectionSkeletonUsage.second);
+    total += selectionSkeletonUsage.second;
+
+    const size_t workIndexBytes = m_workIndex.GetMemorySize();
+    o << "workIndex" << usageToJson((int)m_workIndex.GetWorks().size(), workIndexBytes);
+    total += workIndexBytes;
+
+    const TextExtentCache *textExtentCache = m_doc.GetTextExtentCache();
+    const size_t textExtentCacheBytes = textExtentCache->GetMemorySize();
+    o << "textExtentCache" << usageToJson(textExtentCache->GetCount(), textExtentCacheBytes);
+    total += textExtentCacheBytes;
+
+    // The data kept for loading it again when options change
+    const size_t loadedDataBytes = m_loadedData.capacity();
+    o << "loadedData" << usageToJson((m_loadedData.empty()) ? 0 : 1, loadedDataBytes);
+    total += loadedDataBytes;
+
+    // The Humdrum buffer is shared by all the toolkits
+    const size_t humdrumBufferBytes = (m_humdrumBuffer) ? strlen(m_humdrumBuffer) + 1 : 0;
+    o << "humdrumBuffer" << usageToJson((m_humdrumBuffer) ? 1 : 0, humdrumBufferBytes);
+    total += humdrumBufferBytes;
+
+    // A list node and an index entry for each page, besides the key and the SVG counted in m_svgCacheSize
+    const size_t svgCacheBytes = m_svgCacheSize + m_svgCache.size() * (2 * sizeof(std::string) + 6 * sizeof(void *));
+    o << "svgCache" << usageToJson((int)m_svgCache.size(), svgCacheBytes);
+    total += svgCacheBytes;
+
+    size_t svgDiffBytes = 0;
+    for (const SVGDiffPage &page : m_svgDiffPages) {
+        svgDiffBytes += sizeof(page) + 2 * sizeof(void *) + page.m_key.capacity() + page.m_size.capacity();
+        for (const std::string &glyph : page.m_glyphs) {
+            svgDiffBytes += sizeof(glyph) + 4 * sizeof(void *) + glyph.capacity();
+        }
+        for (const auto &system : page.m_systems) {
+            svgDiffBytes += sizeof(system) + system.first.capacity() + system.second.capacity() * sizeof(int);
+        }
+    }
+    o << "svgDiffPages" << usageToJson((int)m_svgDiffPages.size(), svgDiffBytes);
+    total += svgDiffBytes;
+
+    // The last output returned through the C wrapper (e.g., a SVG page or a timemap)
+    const size_t cStringBytes = (m_cString) ? strlen(m_cString) + 1 : 0;
+    o << "cString" << usageToJson((m_cString) ? 1 : 0, cStringBytes);
+    total += cStringBytes;
+
+    o << "bytes" << total;
+
+    return o.json();
+}
+
+void Toolkit::ClearSVGCache()
+{
+    m_svgCache.clear();
+    m_svgCacheIndex.clear();
+    m_svgCacheSize = 0;
 }
 
 bool Toolkit::RenderToSVGFile(const std::string &filename, int pageNo)
@@ -1362,19 +2196,133 @@ void Toolkit::GetHumdrum(std::ostream &output)
     output << GetHumdrumBuffer();
 }
 
+//----------------------------------------------------------------------------
+// MIDI file writer
+//----------------------------------------------------------------------------
+
+/**
+ * First pass of the MIDI file writer for getting the size of the track data.
+ * The last three bytes are kept for checking if the data already ends with an end-of-track message.
+ */
+class MIDITrackSize {
+public:
+    MIDITrackSize() : m_size(0), m_last{ 0, 0, 0 } {}
+
+    void Append(unsigned char byte)
+    {
+        m_last[0] = m_last[1];
+        m_last[1] = m_last[2];
+        m_last[2] = byte;
+        ++m_size;
+    }
+
+    bool HasEndOfTrack() const { return (m_size >= 3) && (m_last[0] == 0xff) && (m_last[1] == 0x2f); }
+
+    unsigned int m_size;
+    unsigned char m_last[3];
+};
+
+template <class Output> static void AppendMIDIBigEndian(Output &output, unsigned int value, int bytes)
+{
+    for (int i = bytes - 1; i >= 0; --i) {
+        output.Append((unsigned char)((value >> (8 * i)) & 0xff));
+    }
+}
+
+template <class Output> static void AppendMIDIVLValue(Output &output, long value)
+{
+    // Same as smf::MidiFile::writeVLValue
+    if ((unsigned long)value >= (1 << 28)) value = 0x0FFFffff;
+
+    unsigned char bytes[4];
+    bytes[0] = (unsigned char)(((unsigned long)value >> 21) & 0x7f);
+    bytes[1] = (unsigned char)(((unsigned long)value >> 14) & 0x7f);
+    bytes[2] = (unsigned char)(((unsigned long)value >> 7) & 0x7f);
+    bytes[3] = (unsigned char)(((unsigned long)value) & 0x7f);
+
+    int start = 0;
+    while ((start < 4) && (bytes[start] == 0)) start++;
+    for (int i = start; i < 3; i++) {
+        output.Append(bytes[i] | 0x80);
+    }
+    output.Append(bytes[3]);
+}
+
+template <class Output> static void AppendMIDITrackData(Output &output, const smf::MidiEventList &events)
+{
+    // The events are in absolute ticks and the delta ticks are calculated on the fly
+    // The delta of an event not written is lost, as with smf::MidiFile::makeDeltaTicks
+    int previousTick = 0;
+    for (int i = 0; i < events.size(); ++i) {
+        const smf::MidiEvent &event = events[i];
+        const int delta = event.tick - previousTick;
+        previousTick = event.tick;
+        // Empty events and end-of-track messages are not written - the end-of-track is added after the data
+        if (event.empty() || event.isEndOfTrack()) continue;
+        AppendMIDIVLValue(output, delta);
+        if ((event.getCommandByte() == 0xf0) || (event.getCommandByte() == 0xf7)) {
+            // Sysex and raw byte messages are written with their length
+            output.Append(event[0]);
+            AppendMIDIVLValue(output, (int)event.size() - 1);
+            for (int k = 1; k < (int)event.size(); ++k) output.Append(event[k]);
+        }
+        else {
+            for (int k = 0; k < (int)event.size(); ++k) output.Append(event[k]);
+        }
+    }
+}
+
+/**
+ * Write a MIDI file with sorted tracks in absolute ticks as base64.
+ * The output is the one of smf::MidiFile::write encoded with Base64Encode, but the SMF bytes are encoded
+ * directly without being written to a stream and copied first.
+ */
+static std::string WriteMIDIBase64(const smf::MidiFile &midiFile)
+{
+    const int trackCount = midiFile.getNumTracks();
+    const unsigned char endOfTrack[4] = { 0, 0xff, 0x2f, 0x00 };
+
+    // First get the size of each track for the chunk headers and for reserving the output
+    std::vector<MIDITrackSize> trackSizes(trackCount);
+    unsigned int fileSize = 14;
+    for (int i = 0; i < trackCount; ++i) {
+        AppendMIDITrackData(trackSizes.at(i), midiFile[i]);
+        fileSize += 8 + trackSizes.at(i).m_size + (trackSizes.at(i).HasEndOfTrack() ? 0 : 4);
+    }
+
+    std::string output;
+    output.reserve((fileSize + 2) / 3 * 4);
+    Base64Encoder encoder(output);
+
+    // Header chunk with the format 0 or 1, the number of tracks and the ticks per quarter note
+    encoder.Append(reinterpret_cast<const unsigned char *>("MThd"), 4);
+    AppendMIDIBigEndian(encoder, 6, 4);
+    AppendMIDIBigEndian(encoder, (trackCount == 1) ? 0 : 1, 2);
+    AppendMIDIBigEndian(encoder, trackCount, 2);
+    AppendMIDIBigEndian(encoder, midiFile.getTicksPerQuarterNote(), 2);
+
+    for (int i = 0; i < trackCount; ++i) {
+        encoder.Append(reinterpret_cast<const unsigned char *>("MTrk"), 4);
+        const bool hasEndOfTrack = trackSizes.at(i).HasEndOfTrack();
+        AppendMIDIBigEndian(encoder, trackSizes.at(i).m_size + (hasEndOfTrack ? 0 : 4), 4);
+        AppendMIDITrackData(encoder, midiFile[i]);
+        if (!hasEndOfTrack) encoder.Append(endOfTrack, 4);
+    }
+    encoder.Finish();
+
+    return output;
+}
+
 std::string Toolkit::RenderToMIDI()
 {
+    this->ApplyInvalidation();
+
     smf::MidiFile outputfile;
     outputfile.absoluteTicks();
     m_doc.ExportMIDI(&outputfile);
     outputfile.sortTracks();
 
-    std::stringstream strstrem;
-    outputfile.write(strstrem);
-    std::string outputstr = Base64Encode(
-        reinterpret_cast<const unsigned char *>(strstrem.str().c_str()), (unsigned int)strstrem.str().length());
-
-    return outputstr;
+    return WriteMIDIBase64(outputfile);
 }
 
 std::string Toolkit::RenderToPAE()
@@ -1405,15 +2353,44 @@ bool Toolkit::RenderToPAEFile(const std::string &filename)
     return true;
 }
 
-std::string Toolkit::RenderToTimemap()
+static bool IsBinaryTimemap(const std::string &jsonOptions)
 {
+    if (jsonOptions.empty()) return false;
+
+    jsonxx::Object json;
+
+    // Read JSON options
+    if (!json.parse(jsonOptions)) {
+        LogWarning("Cannot parse JSON std::string. Using default options.");
+        return false;
+    }
+    if (!json.has<jsonxx::String>("format")) return false;
+
+    std::string format = json.get<jsonxx::String>("format");
+    if (format == "binary") return true;
+    if (format != "json") {
+        LogWarning("Unsupported timemap format '%s'. Using JSON.", format.c_str());
+    }
+    return false;
+}
+
+std::string Toolkit::RenderToTimemap(const std::string &jsonOptions)
+{
+    this->ApplyInvalidation();
+
     std::string output;
-    m_doc.ExportTimemap(output);
+    bool binary = IsBinaryTimemap(jsonOptions);
+    m_doc.ExportTimemap(output, binary);
+    if (binary) {
+        return Base64Encode(reinterpret_cast<const unsigned char *>(output.c_str()), (unsigned int)output.length());
+    }
     return output;
 }
 
 std::string Toolkit::GetElementsAtTime(int millisec)
 {
+    this->ApplyInvalidation();
+
     jsonxx::Object o;
     jsonxx::Array a;
 
@@ -1434,6 +2411,7 @@ std::string Toolkit::GetElementsAtTime(int millisec)
     int measureTimeOffset = measure->GetRealTimeOffsetMilliseconds(repeat);
 
     // Get the pageNo from the first note (if any)
+    m_doc.ContinueCastOffDoc();
     int pageNo = -1;
     Page *page = dynamic_cast<Page *>(measure->GetFirstAncestor(PAGE));
     if (page) pageNo = page->GetIdx() + 1;
@@ -1454,6 +2432,88 @@ std::string Toolkit::GetElementsAtTime(int millisec)
     return o.json();
 }
 
+std::string Toolkit::GetElementsAtPoint(int pageNo, int x, int y)
+{
+    jsonxx::Object o;
+    jsonxx::Array a;
+
+    int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
+
+    SpatialIndex *spatialIndex = this->GetPageSpatialIndex(pageNo);
+    if (spatialIndex) {
+        Point point = this->ToPageLogicalPoint(x, y);
+        ArrayOfObjects objects;
+        spatialIndex->FindAtPoint(point.x, point.y, &objects);
+        // An element drawn more than once (e.g., in several systems) is given once
+        std::set<Object *> found;
+        for (Object *object : objects) {
+            if (found.insert(object).second) a << object->GetUuid();
+        }
+    }
+    o << "elements" << a;
+    o << "page" << pageNo;
+
+    if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
+
+    return o.json();
+}
+
+std::string Toolkit::GetElementsInRect(int pageNo, int x, int y, int width, int height)
+{
+    jsonxx::Object o;
+    jsonxx::Array a;
+
+    int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
+
+    SpatialIndex *spatialIndex = this->GetPageSpatialIndex(pageNo);
+    if (spatialIndex) {
+        Point point1 = this->ToPageLogicalPoint(x, y);
+        Point point2 = this->ToPageLogicalPoint(x + width, y + height);
+        ArrayOfObjects objects;
+        spatialIndex->FindInRect(point1.x, point1.y, point2.x, point2.y, &objects);
+        // An element drawn more than once (e.g., in several systems) is given once
+        std::set<Object *> found;
+        for (Object *object : objects) {
+            if (found.insert(object).second) a << object->GetUuid();
+        }
+    }
+    o << "elements" << a;
+    o << "page" << pageNo;
+
+    if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
+
+    return o.json();
+}
+
+SpatialIndex *Toolkit::GetPageSpatialIndex(int pageNo)
+{
+    this->ApplyInvalidation();
+
+    // With a progressive cast-off, make sure the page exists and is complete
+    m_doc.ContinueCastOffDoc(pageNo - 1);
+
+    if ((pageNo < 1) || (pageNo > m_doc.GetPageCount())) {
+        LogWarning("Page %d does not exist", pageNo);
+        return NULL;
+    }
+
+    // Page number is one-based - this also lays out the page if necessary
+    m_view.SetPage(pageNo - 1);
+
+    Page *page = m_doc.GetDrawingPage();
+    assert(page);
+    return page->GetSpatialIndex();
+}
+
+Point Toolkit::ToPageLogicalPoint(int x, int y)
+{
+    if (m_doc.GetType() == Facs) return Point(x, y);
+
+    const double factor = DEFINITION_FACTOR / (m_view.GetPPUFactor() * m_scale / 100);
+    return Point(x * factor - m_doc.m_drawingPageMarginLeft,
+        m_view.ToLogicalY(y * factor - m_doc.m_drawingPageMarginTop));
+}
+
 bool Toolkit::RenderToMIDIFile(const std::string &filename)
 {
     smf::MidiFile outputfile;
@@ -1465,12 +2525,13 @@ bool Toolkit::RenderToMIDIFile(const std::string &filename)
     return true;
 }
 
-bool Toolkit::RenderToTimemapFile(const std::string &filename)
+bool Toolkit::RenderToTimemapFile(const std::string &filename, const std::string &jsonOptions)
 {
     std::string outputString;
-    m_doc.ExportTimemap(outputString);
+    bool binary = IsBinaryTimemap(jsonOptions);
+    m_doc.ExportTimemap(outputString, binary);
 
-    std::ofstream output(filename.c_str());
+    std::ofstream output(filename.c_str(), binary ? (std::ios::out | std::ios::binary) : std::ios::out);
     if (!output.is_open()) {
         return false;
     }
@@ -1481,12 +2542,25 @@ bool Toolkit::RenderToTimemapFile(const std::string &filename)
 
 int Toolkit::GetPageCount()
 {
-    return m_doc.GetPageCount();
+    this->ApplyInvalidation();
+
+    return m_doc.GetEstimatedPageCount();
+}
+
+bool Toolkit::IsPageCountFinal()
+{
+    this->ApplyInvalidation();
+
+    return !m_doc.IsCastOffPending();
 }
 
 int Toolkit::GetPageWithElement(const std::string &xmlId)
 {
-    Object *element = m_doc.FindDescendantByUuid(xmlId);
+    this->ApplyInvalidation();
+    m_doc.ContinueCastOffDoc();
+
+    int repeat = 1;
+    Object *element = m_doc.FindDescendantByUuid(m_doc.m_expansionMap.GetNotatedReferenceId(xmlId, repeat));
     if (!element) {
         return 0;
     }
@@ -1499,7 +2573,10 @@ int Toolkit::GetPageWithElement(const std::string &xmlId)
 
 int Toolkit::GetTimeForElement(const std::string &xmlId)
 {
-    Object *element = m_doc.FindDescendantByUuid(xmlId);
+    this->ApplyInvalidation();
+
+    int repeat = 1;
+    Object *element = m_doc.FindDescendantByUuid(m_doc.m_expansionMap.GetNotatedReferenceId(xmlId, repeat));
 
     if (!element) {
         LogWarning("Element '%s' not found", xmlId.c_str());
@@ -1519,8 +2596,8 @@ int Toolkit::GetTimeForElement(const std::string &xmlId)
         assert(note);
         Measure *measure = vrv_cast<Measure *>(note->GetFirstAncestor(MEASURE));
         assert(measure);
-        // For now ignore repeats and access always the first
-        timeofElement = measure->GetRealTimeOffsetMilliseconds(1);
+        // The repetition is the one of the id with an expansion by reference and the first one otherwise
+        timeofElement = measure->GetRealTimeOffsetMilliseconds(repeat);
         timeofElement += note->GetRealTimeOnsetMilliseconds();
     }
     return timeofElement;
@@ -1528,7 +2605,10 @@ int Toolkit::GetTimeForElement(const std::string &xmlId)
 
 std::string Toolkit::GetMIDIValuesForElement(const std::string &xmlId)
 {
-    Object *element = m_doc.FindDescendantByUuid(xmlId);
+    this->ApplyInvalidation();
+
+    int repeat = 1;
+    Object *element = m_doc.FindDescendantByUuid(m_doc.m_expansionMap.GetNotatedReferenceId(xmlId, repeat));
 
     if (!element) {
         LogWarning("Element '%s' not found", xmlId.c_str());
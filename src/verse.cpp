@@ -238,8 +238,8 @@ int Verse::PrepareProcessingLists(FunctorParams *functorParams)
     assert(params);
     // StaffN_LayerN_VerseN_t *tree = vrv_cast<StaffN_LayerN_VerseN_t*>((*params).at(0));
 
-    Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
-    Layer *layer = vrv_cast<Layer *>(this->GetFirstAncestor(LAYER));
+    Staff *staff = this->GetAncestorStaff();
+    Layer *layer = this->GetAncestorLayer();
     assert(staff && layer);
 
     params->m_verseTree.child[staff->GetN()].child[layer->GetN()].child[this->GetN()];
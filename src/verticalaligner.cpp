@@ -9,6 +9,7 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <assert.h>
 #include <math.h>
 #include <utility>
@@ -852,12 +853,21 @@ int StaffAlignment::AdjustSlurs(FunctorParams *functorParams)
         bool adjusted = slur->AdjustSlur(params->m_doc, curve, this->GetStaff());
         if (adjusted) {
             params->m_adjusted = true;
+            params->m_adjustedPositioners.push_back(curve);
         }
     }
 
     Staff *staff = GetStaff();
     if (staff) {
         const int slurShift = staff->m_drawingStaffSize / 2;
+        // Moved slurs need to be redrawn too, so reset their bounding box and add them to the adjusted ones
+        auto setMoved = [params](FloatingCurvePositioner *positioner) {
+            positioner->BoundingBox::ResetBoundingBox();
+            ArrayOfFloatingPositioners &adjusted = params->m_adjustedPositioners;
+            if (std::find(adjusted.begin(), adjusted.end(), positioner) == adjusted.end()) {
+                adjusted.push_back(positioner);
+            }
+        };
         for (size_t i = 0; i + 1 < positioners.size(); i++) {
             Slur *firstSlur = vrv_cast<Slur *>(positioners[i]->GetObject());
             for (auto j = i + 1; j < positioners.size(); j++) {
@@ -869,11 +879,13 @@ int StaffAlignment::AdjustSlurs(FunctorParams *functorParams)
                     FloatingCurvePositioner *positioner = positioners[points1[2].x > points2[2].x ? i : j];
                     positioner->MoveFrontVertical(
                         positioner->GetDir() == curvature_CURVEDIR_below ? -slurShift : slurShift);
+                    setMoved(positioner);
                 }
                 else if (firstSlur->GetEnd() == secondSlur->GetEnd()) {
                     FloatingCurvePositioner *positioner = positioners[points1[0].x < points2[0].x ? i : j];
                     positioner->MoveBackVertical(
                         positioner->GetDir() == curvature_CURVEDIR_below ? -slurShift : slurShift);
+                    setMoved(positioner);
                 }
             }
         }
@@ -978,4 +990,19 @@ int StaffAlignment::JustifyY(FunctorParams *functorParams)
     return FUNCTOR_CONTINUE;
 }
 
+
+int StaffAlignment::GetMemoryUsage(FunctorParams *functorParams)
+{
+    GetMemoryUsageParams *params = vrv_params_cast<GetMemoryUsageParams *>(functorParams);
+    assert(params);
+
+    // The floating positioners are owned by the staff alignment
+    for (FloatingPositioner *positioner : m_floatingPositioners) {
+        params->m_floatingPositioners.first++;
+        params->m_floatingPositioners.second += positioner->GetMemorySize() + sizeof(FloatingPositioner *);
+    }
+
+    return Object::GetMemoryUsage(functorParams);
+}
+
 } // namespace vrv
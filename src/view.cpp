@@ -38,6 +38,13 @@ View::View()
     m_currentMeasure = NULL;
     m_currentStaff = NULL;
     m_currentSystem = NULL;
+
+    this->ResetDrawingRegion();
+    m_hasDrawingRegion = false;
+    m_drawingRegionLeft = 0;
+    m_drawingRegionRight = 0;
+    m_drawingRegionTop = 0;
+    m_drawingRegionBottom = 0;
 }
 
 View::~View() {}
@@ -9,6 +9,7 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <assert.h>
 #include <math.h>
 
@@ -28,6 +29,7 @@
 #include "f.h"
 #include "fb.h"
 #include "fig.h"
+#include "floatingobject.h"
 #include "functorparams.h"
 #include "glyph.h"
 #include "keysig.h"
@@ -49,6 +51,7 @@
 #include "system.h"
 #include "text.h"
 #include "tuplet.h"
+#include "verticalaligner.h"
 #include "vrv.h"
 
 namespace vrv {
@@ -64,6 +67,8 @@ void View::DrawCurrentPage(DeviceContext *dc, bool background)
 
     m_currentPage = m_doc->SetDrawingPage(m_pageIdx);
 
+    dc->SetTextExtentCache(m_doc->GetTextExtentCache());
+
     int i;
 
     // Keep the width of the initial scoreDef
@@ -86,19 +91,115 @@ void View::DrawCurrentPage(DeviceContext *dc, bool background)
     Point origin = dc->GetLogicalOrigin();
     dc->SetLogicalOrigin(origin.x - m_doc->m_drawingPageMarginLeft, origin.y - m_doc->m_drawingPageMarginTop);
 
+    // Convert the drawing region (in pixels from the top left corner of the page) to logical coordinates
+    m_hasDrawingRegion = (m_drawingRegionWidth > 0) && (m_drawingRegionHeight > 0) && (dc->GetUserScaleX() > 0.0)
+        && !dc->Is(BBOX_DEVICE_CONTEXT);
+    if (m_hasDrawingRegion) {
+        const double factor = DEFINITION_FACTOR / dc->GetUserScaleX();
+        m_drawingRegionLeft = m_drawingRegionX * factor - m_doc->m_drawingPageMarginLeft;
+        m_drawingRegionRight = (m_drawingRegionX + m_drawingRegionWidth) * factor - m_doc->m_drawingPageMarginLeft;
+        m_drawingRegionTop = ToLogicalY(m_drawingRegionY * factor - m_doc->m_drawingPageMarginTop);
+        m_drawingRegionBottom
+            = ToLogicalY((m_drawingRegionY + m_drawingRegionHeight) * factor - m_doc->m_drawingPageMarginTop);
+    }
+
     dc->StartPage();
 
     for (i = 0; i < m_currentPage->GetSystemCount(); ++i) {
         // cast to System check in DrawSystem
         System *system = dynamic_cast<System *>(m_currentPage->GetChild(i));
+        if (system && !IsInDrawingRegion(system)) continue;
+        if (!m_drawingSystems.empty()
+            && (std::find(m_drawingSystems.begin(), m_drawingSystems.end(), system) == m_drawingSystems.end())) {
+            continue;
+        }
         DrawSystem(dc, system);
     }
 
-    DrawRunningElements(dc, m_currentPage);
+    if (m_drawingSystems.empty()) DrawRunningElements(dc, m_currentPage);
+
+    dc->EndPage();
+}
+
+void View::DrawCurrentPagePositioners(DeviceContext *dc, const ArrayOfFloatingPositioners &positioners)
+{
+    assert(dc);
+    assert(m_doc);
+
+    m_currentPage = m_doc->SetDrawingPage(m_pageIdx);
+
+    dc->SetTextExtentCache(m_doc->GetTextExtentCache());
+
+    // Same context as in DrawCurrentPage
+    m_drawingScoreDef = m_currentPage->m_drawingScoreDef;
+
+    Point origin = dc->GetLogicalOrigin();
+    dc->SetLogicalOrigin(origin.x - m_doc->m_drawingPageMarginLeft, origin.y - m_doc->m_drawingPageMarginTop);
+
+    dc->StartPage();
+
+    for (int i = 0; i < m_currentPage->GetSystemCount(); ++i) {
+        System *system = dynamic_cast<System *>(m_currentPage->GetChild(i));
+        if (!system) continue;
+        // The system is the parent graphic of the positioners, as in DrawSystem, so its content bounding box is
+        // extended with them
+        bool hasPositioners = false;
+        for (FloatingPositioner *positioner : positioners) {
+            assert(positioner->GetObject());
+            assert(positioner->GetAlignment());
+            if (positioner->GetAlignment()->GetParentSystem() != system) continue;
+            if (!hasPositioners) dc->StartGraphic(system, "", system->GetUuid());
+            hasPositioners = true;
+            // This will set the positioner as the current one of the object before drawing it
+            DrawTimeSpanningElement(dc, positioner->GetObject(), system);
+        }
+        if (hasPositioners) dc->EndGraphic(system, this);
+    }
 
     dc->EndPage();
 }
 
+void View::SetDrawingRegion(int x, int y, int width, int height)
+{
+    m_drawingRegionX = x;
+    m_drawingRegionY = y;
+    m_drawingRegionWidth = width;
+    m_drawingRegionHeight = height;
+}
+
+bool View::IsInDrawingRegion(System *system)
+{
+    assert(system);
+
+    if (!m_hasDrawingRegion) return true;
+
+    // The vertical aligner gives the staves with their overflow, the content bounding box what is drawn beyond
+    int top = system->GetDrawingY();
+    int bottom = top - system->GetHeight();
+    if (system->HasContentBB()) {
+        top = std::max(top, system->GetContentTop());
+        bottom = std::min(bottom, system->GetContentBottom());
+    }
+
+    return ((top >= m_drawingRegionBottom) && (bottom <= m_drawingRegionTop));
+}
+
+bool View::IsInDrawingRegion(Measure *measure)
+{
+    assert(measure);
+
+    if (!m_hasDrawingRegion) return true;
+
+    int left = measure->GetDrawingX();
+    int right = left + measure->GetWidth();
+    if (measure->HasContentBB()) {
+        left = std::min(left, measure->GetContentLeft());
+        right = std::max(right, measure->GetContentRight());
+    }
+
+    return ((right >= m_drawingRegionLeft) && (left <= m_drawingRegionRight));
+}
+
 double View::GetPPUFactor() const
 {
     if (!m_currentPage) return 1.0;
@@ -1382,7 +1483,11 @@ void View::DrawSystemChildren(DeviceContext *dc, Object *parent, System *system)
     for (auto current : *parent->GetChildren()) {
         if (current->Is(MEASURE)) {
             // cast to Measure check in DrawMeasure
-            DrawMeasure(dc, dynamic_cast<Measure *>(current), system);
+            Measure *measure = dynamic_cast<Measure *>(current);
+            // The time spanning elements starting in a measure outside the region are added to the drawing list by
+            // the staves of the following measures
+            if (measure && !IsInDrawingRegion(measure)) continue;
+            DrawMeasure(dc, measure, system);
         }
         // scoreDef are not drawn directly, but anything else should not be possible
         else if (current->Is(SCOREDEF)) {
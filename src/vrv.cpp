@@ -553,37 +553,49 @@ static const std::string base64Chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
 std::string Base64Encode(unsigned char const *bytesToEncode, unsigned int inLen)
 {
     std::string ret;
-    int i = 0;
-    unsigned char charArray3[3];
-    unsigned char charArray4[4];
+    ret.reserve((inLen + 2) / 3 * 4);
+    Base64Encoder encoder(ret);
+    encoder.Append(bytesToEncode, inLen);
+    encoder.Finish();
 
-    while (inLen--) {
-        charArray3[i++] = *(bytesToEncode++);
-        if (i == 3) {
-            charArray4[0] = (charArray3[0] & 0xfc) >> 2;
-            charArray4[1] = ((charArray3[0] & 0x03) << 4) + ((charArray3[1] & 0xf0) >> 4);
-            charArray4[2] = ((charArray3[1] & 0x0f) << 2) + ((charArray3[2] & 0xc0) >> 6);
-            charArray4[3] = charArray3[2] & 0x3f;
+    return ret;
+}
 
-            for (i = 0; (i < 4); i++) ret += base64Chars[charArray4[i]];
-            i = 0;
-        }
+void Base64Encoder::Append(unsigned char byte)
+{
+    m_bytes[m_count++] = byte;
+    if (m_count == 3) {
+        m_output += base64Chars[(m_bytes[0] & 0xfc) >> 2];
+        m_output += base64Chars[((m_bytes[0] & 0x03) << 4) + ((m_bytes[1] & 0xf0) >> 4)];
+        m_output += base64Chars[((m_bytes[1] & 0x0f) << 2) + ((m_bytes[2] & 0xc0) >> 6)];
+        m_output += base64Chars[m_bytes[2] & 0x3f];
+        m_count = 0;
+    }
+}
+
+void Base64Encoder::Append(unsigned char const *bytes, unsigned int len)
+{
+    while (len--) {
+        this->Append(*(bytes++));
     }
+}
 
-    if (i) {
-        for (int j = i; j < 3; j++) charArray3[j] = '\0';
+void Base64Encoder::Finish()
+{
+    if (!m_count) return;
 
-        charArray4[0] = (charArray3[0] & 0xfc) >> 2;
-        charArray4[1] = ((charArray3[0] & 0x03) << 4) + ((charArray3[1] & 0xf0) >> 4);
-        charArray4[2] = ((charArray3[1] & 0x0f) << 2) + ((charArray3[2] & 0xc0) >> 6);
-        charArray4[3] = charArray3[2] & 0x3f;
+    for (int j = m_count; j < 3; j++) m_bytes[j] = '\0';
 
-        for (int j = 0; (j < i + 1); j++) ret += base64Chars[charArray4[j]];
+    unsigned char charArray4[4];
+    charArray4[0] = (m_bytes[0] & 0xfc) >> 2;
+    charArray4[1] = ((m_bytes[0] & 0x03) << 4) + ((m_bytes[1] & 0xf0) >> 4);
+    charArray4[2] = ((m_bytes[1] & 0x0f) << 2) + ((m_bytes[2] & 0xc0) >> 6);
+    charArray4[3] = m_bytes[2] & 0x3f;
 
-        while ((i++ < 3)) ret += '=';
-    }
+    for (int j = 0; (j < m_count + 1); j++) m_output += base64Chars[charArray4[j]];
 
-    return ret;
+    while ((m_count++ < 3)) m_output += '=';
+    m_count = 0;
 }
 
 } // namespace vrv
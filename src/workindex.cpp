@@ -0,0 +1,292 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        workindex.cpp
+// Author:      Laurent Pugin
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "workindex.h"
+
+//----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <assert.h>
+#include <cctype>
+
+//----------------------------------------------------------------------------
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// WorkIndex
+//----------------------------------------------------------------------------
+
+WorkIndex::WorkIndex()
+{
+    this->Reset();
+}
+
+WorkIndex::~WorkIndex() {}
+
+void WorkIndex::Reset()
+{
+    m_works.clear();
+    m_headerLength = 0;
+    m_footerOffset = std::string::npos;
+    m_dataSize = 0;
+    m_dataHash = 0;
+    m_isComplete = false;
+}
+
+bool WorkIndex::IsIndexOf(const std::string &data, int maxWorks) const
+{
+    if ((data.size() != m_dataSize) || (std::hash<std::string>{}(data) != m_dataHash)) return false;
+    return (m_isComplete || ((maxWorks != -1) && ((int)m_works.size() >= maxWorks)));
+}
+
+void WorkIndex::IndexABC(const std::string &data, int maxWorks)
+{
+    this->Reset();
+
+    // As in ABCInput::parseABC, a tune starts with its X: field, has its header until the K: field and is ended by
+    // an empty line
+    bool inTune = false;
+    bool hasKey = false;
+    size_t pos = 0;
+    while (pos < data.size()) {
+        const size_t lineEnd = WorkIndex::GetLineEnd(data, pos);
+        if (!inTune) {
+            if (data.compare(pos, 2, "X:") == 0) {
+                if ((int)m_works.size() == maxWorks) break;
+                if (m_works.empty()) m_headerLength = pos;
+                m_works.push_back({ pos, data.size() - pos, WorkIndex::GetLineValue(data, pos + 2, lineEnd), "" });
+                inTune = true;
+                hasKey = false;
+            }
+        }
+        else if (!hasKey) {
+            if (data.compare(pos, 2, "K:") == 0) {
+                hasKey = true;
+            }
+            else if ((data.compare(pos, 2, "T:") == 0) && m_works.back().m_title.empty()) {
+                m_works.back().m_title = WorkIndex::GetLineValue(data, pos + 2, lineEnd);
+            }
+        }
+        else if (data.find_first_not_of(" \r\n", pos) >= lineEnd) {
+            m_works.back().m_length = pos - m_works.back().m_offset;
+            inTune = false;
+        }
+        pos = lineEnd;
+    }
+    this->SetIndexed(data, maxWorks);
+}
+
+void WorkIndex::IndexHumdrum(const std::string &data, int maxWorks)
+{
+    this->Reset();
+
+    // As in hum::HumdrumFileSet, a segment starts with its !!!!SEGMENT: record or with its exclusive interpretations
+    // when the previous one has data. Without a !!!!SEGMENT: record, the reference records directly preceding the
+    // exclusive interpretations (e.g., !!!OTL:) are the leading ones of the new piece
+    bool inData = false;
+    bool hasData = false;
+    size_t recordsStart = std::string::npos;
+    std::string recordsTitle;
+    size_t pos = 0;
+    while (pos < data.size()) {
+        const size_t lineEnd = WorkIndex::GetLineEnd(data, pos);
+        if (!inData) {
+            const bool isSegment = (data.compare(pos, 11, "!!!!SEGMENT") == 0);
+            const bool isExclusiveInterpretation = (data.compare(pos, 2, "**") == 0);
+            const bool isRecord = (data.compare(pos, 2, "!!") == 0) && (data.compare(pos, 4, "!!!!") != 0);
+            if (isRecord) {
+                if (recordsStart == std::string::npos) recordsStart = pos;
+                if (recordsTitle.empty() && (data.compare(pos, 6, "!!!OTL") == 0)) {
+                    const size_t colon = data.find(':', pos);
+                    if (colon < lineEnd) recordsTitle = WorkIndex::GetLineValue(data, colon + 1, lineEnd);
+                }
+            }
+            else if (!isExclusiveInterpretation) {
+                // The records are not followed by a new piece and are the trailing ones of the previous one
+                if (!m_works.empty() && m_works.back().m_title.empty()) m_works.back().m_title = recordsTitle;
+                recordsStart = std::string::npos;
+                recordsTitle.clear();
+            }
+            if ((isSegment || isExclusiveInterpretation) && (m_works.empty() || hasData)) {
+                const size_t offset
+                    = (isExclusiveInterpretation && (recordsStart != std::string::npos)) ? recordsStart : pos;
+                if (!m_works.empty()) m_works.back().m_length = offset - m_works.back().m_offset;
+                if ((int)m_works.size() == maxWorks) {
+                    recordsTitle.clear();
+                    break;
+                }
+                if (m_works.empty()) m_headerLength = offset;
+                m_works.push_back({ offset, data.size() - offset, "", "" });
+                hasData = false;
+            }
+            if (isSegment) {
+                const size_t colon = data.find(':', pos);
+                if (colon < lineEnd) m_works.back().m_id = WorkIndex::GetLineValue(data, colon + 1, lineEnd);
+            }
+            if (isExclusiveInterpretation) {
+                // The leading records are the ones of the piece, with or without a !!!!SEGMENT: record
+                if (!m_works.empty() && m_works.back().m_title.empty()) m_works.back().m_title = recordsTitle;
+                recordsStart = std::string::npos;
+                recordsTitle.clear();
+                inData = true;
+                hasData = true;
+            }
+        }
+        else if (data.compare(pos, 2, "*-") == 0) {
+            inData = false;
+        }
+        else if (m_works.back().m_title.empty() && (data.compare(pos, 6, "!!!OTL") == 0)) {
+            const size_t colon = data.find(':', pos);
+            if (colon < lineEnd) m_works.back().m_title = WorkIndex::GetLineValue(data, colon + 1, lineEnd);
+        }
+        pos = lineEnd;
+    }
+    // Trailing records of the last piece
+    if (!m_works.empty() && m_works.back().m_title.empty()) m_works.back().m_title = recordsTitle;
+    this->SetIndexed(data, maxWorks);
+}
+
+void WorkIndex::IndexMEI(const std::string &data, int maxWorks)
+{
+    this->Reset();
+
+    // Only the tags are looked at, skipping the comments, the CDATA sections and the processing instructions
+    bool inBody = false;
+    int depth = 0;
+    size_t pos = data.find('<');
+    while (pos != std::string::npos) {
+        size_t tagEnd = std::string::npos;
+        if (data.compare(pos, 4, "<!--") == 0) {
+            tagEnd = data.find("-->", pos + 4);
+            if (tagEnd != std::string::npos) tagEnd += 3;
+        }
+        else if (data.compare(pos, 9, "<![CDATA[") == 0) {
+            tagEnd = data.find("]]>", pos + 9);
+            if (tagEnd != std::string::npos) tagEnd += 3;
+        }
+        else if ((data.compare(pos, 2, "<?") == 0) || (data.compare(pos, 2, "<!") == 0)) {
+            tagEnd = data.find('>', pos + 2);
+            if (tagEnd != std::string::npos) tagEnd += 1;
+        }
+        else {
+            // Look for the end of the tag, ignoring the '>' in the attribute values
+            char quote = 0;
+            for (size_t i = pos + 1; i < data.size(); ++i) {
+                if (quote) {
+                    if (data[i] == quote) quote = 0;
+                }
+                else if ((data[i] == '"') || (data[i] == '\'')) {
+                    quote = data[i];
+                }
+                else if (data[i] == '>') {
+                    tagEnd = i + 1;
+                    break;
+                }
+            }
+            if (tagEnd == std::string::npos) break;
+
+            const bool isEndTag = (data[pos + 1] == '/');
+            const bool isEmptyTag = (data[tagEnd - 2] == '/');
+            const size_t nameStart = (isEndTag) ? pos + 2 : pos + 1;
+            const size_t nameEnd = std::min(data.find_first_of(" \t\r\n/>", nameStart), tagEnd);
+            const std::string name = data.substr(nameStart, nameEnd - nameStart);
+
+            if (!inBody) {
+                if ((name == "body") && !isEndTag) inBody = true;
+            }
+            else if (name == "mdiv") {
+                if (!isEndTag && (depth == 0)) {
+                    if ((int)m_works.size() == maxWorks) {
+                        m_footerOffset = data.rfind("</body");
+                        break;
+                    }
+                    if (m_works.empty()) m_headerLength = pos;
+                    const std::string tag = data.substr(pos, tagEnd - pos);
+                    m_works.push_back({ pos, data.size() - pos, WorkIndex::GetTagAttribute(tag, "xml:id"),
+                        WorkIndex::GetTagAttribute(tag, "label") });
+                }
+                if (isEndTag) {
+                    --depth;
+                }
+                else if (!isEmptyTag) {
+                    ++depth;
+                }
+                if ((depth == 0) && !m_works.empty()) {
+                    m_works.back().m_length = tagEnd - m_works.back().m_offset;
+                }
+            }
+            else if ((name == "body") && isEndTag) {
+                m_footerOffset = pos;
+                break;
+            }
+        }
+        if (tagEnd == std::string::npos) break;
+        pos = data.find('<', tagEnd);
+    }
+    this->SetIndexed(data, maxWorks);
+}
+
+bool WorkIndex::ExtractWork(const std::string &data, int n, std::string &workData) const
+{
+    if ((n < 1) || (n > (int)m_works.size())) return false;
+
+    const Work &work = m_works.at(n - 1);
+    assert(work.m_offset + work.m_length <= data.size());
+
+    workData.clear();
+    workData.append(data, 0, m_headerLength);
+    workData.append(data, work.m_offset, work.m_length);
+    if (m_footerOffset != std::string::npos) workData.append(data, m_footerOffset, std::string::npos);
+    return true;
+}
+
+size_t WorkIndex::GetMemorySize() const
+{
+    size_t bytes = sizeof(*this) + m_works.capacity() * sizeof(Work);
+    for (const Work &work : m_works) bytes += work.m_id.capacity() + work.m_title.capacity();
+    return bytes;
+}
+
+void WorkIndex::SetIndexed(const std::string &data, int maxWorks)
+{
+    m_dataSize = data.size();
+    m_dataHash = std::hash<std::string>{}(data);
+    m_isComplete = ((int)m_works.size() != maxWorks);
+}
+
+size_t WorkIndex::GetLineEnd(const std::string &data, size_t pos)
+{
+    const size_t newLine = data.find('\n', pos);
+    return (newLine == std::string::npos) ? data.size() : newLine + 1;
+}
+
+std::string WorkIndex::GetLineValue(const std::string &data, size_t pos, size_t lineEnd)
+{
+    const size_t start = data.find_first_not_of(" \t", pos);
+    if (start >= lineEnd) return "";
+    const size_t end = data.find_last_not_of(" \t\r\n", lineEnd - 1);
+    return data.substr(start, end + 1 - start);
+}
+
+std::string WorkIndex::GetTagAttribute(const std::string &tag, const std::string &attribute)
+{
+    // The attribute has to be preceded by a white space, e.g., for not taking xml:id for id
+    size_t start = tag.find(attribute + "=");
+    while ((start != std::string::npos) && !isspace(tag.at(start - 1))) {
+        start = tag.find(attribute + "=", start + 1);
+    }
+    if (start == std::string::npos) return "";
+
+    const size_t quote = start + attribute.size() + 1;
+    if (quote >= tag.size()) return "";
+    const size_t end = tag.find(tag.at(quote), quote + 1);
+    if (end == std::string::npos) return "";
+    return tag.substr(quote + 1, end - quote - 1);
+}
+
+} // namespace vrv
@@ -0,0 +1,866 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        bench.cpp
+// Author:      Laurent Pugin
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <new>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <getopt.h>
+#include <sys/resource.h>
+#else
+#include "win_getopt.h"
+#endif
+
+//----------------------------------------------------------------------------
+
+#include "doc.h"
+#include "ioabc.h"
+#include "iohumdrum.h"
+#include "iomei.h"
+#include "iomusxml.h"
+#include "iopae.h"
+#include "page.h"
+#include "toolkit.h"
+#include "vrv.h"
+
+//----------------------------------------------------------------------------
+
+#include "jsonxx.h"
+#include "pugixml.hpp"
+
+//----------------------------------------------------------------------------
+// Allocation counting
+//----------------------------------------------------------------------------
+
+static long s_allocationCount = 0;
+
+void *operator new(std::size_t size)
+{
+    ++s_allocationCount;
+    void *p = malloc((size > 0) ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+// gcc sees the memory of operator new freed once operator delete is inlined
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 11)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete(void *p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+    free(p);
+}
+
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 11)
+#pragma GCC diagnostic pop
+#endif
+
+//----------------------------------------------------------------------------
+// Peak resident set size
+//----------------------------------------------------------------------------
+
+/**
+ * Reset the peak resident set size, which is possible only on Linux. Otherwise the peak is the one of the process
+ * so far, and only its increases can be attributed to a file.
+ */
+void resetPeakRSS()
+{
+#ifdef __linux__
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    if (clearRefs) clearRefs << "5";
+#endif
+}
+
+/**
+ * Return the peak resident set size in kB (0 if not available).
+ */
+long getPeakRSS()
+{
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) return atol(line.c_str() + 6);
+    }
+#endif
+#ifndef _WIN32
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+#else
+    return 0;
+#endif
+}
+
+//----------------------------------------------------------------------------
+// Corpus files
+//----------------------------------------------------------------------------
+
+/**
+ * A file of the corpus, with the number of times its music is repeated for making a larger input of the same
+ * content.
+ */
+struct BenchFile {
+    std::string m_name;
+    std::string m_path;
+    int m_repeat;
+};
+
+/**
+ * The stages of the document timed for each file, in the order they are run.
+ * They are the ones of the load (import, drawing preparation and cast-off) and of the SVG (layout of each page) of the
+ * toolkit, run one by one on a document of their own. They are not counted in the total time of the file.
+ */
+const std::vector<std::string> docStageNames = { "import", "prepareDrawing", "castOff", "layout" };
+
+/**
+ * The stages of the toolkit timed for each file, in the order they are run.
+ * The load includes the import, the drawing preparation and the cast-off, and the SVG the layout of each page.
+ * The SVG cache stage renders the pages again from the cache, the invalidation stage renders the first page after an
+ * option changing the layout, the cast-off cache stage loads the cast-off cache of the data and the progressive
+ * cast-off stage loads the data and renders its first page with a progressive cast-off.
+ */
+const std::vector<std::string> stageNames = { "load", "svg", "midi", "timemap", "svgCache", "invalidation",
+    "castOffCache", "progressiveCastOff" };
+
+/**
+ * The time (in ms) and the number of allocations of a stage
+ */
+struct Stage {
+    double m_time = 0.0;
+    long m_allocations = 0;
+};
+
+/**
+ * The stages of one run of the pipeline, with the layout time and the rendering time (including the layout) of each
+ * page.
+ */
+struct BenchRun {
+    std::map<std::string, Stage> m_stages;
+    std::vector<double> m_pageLayoutTimes;
+    std::vector<double> m_pageRenderTimes;
+};
+
+/**
+ * Time a stage and count its allocations. The time and the allocations are added to the ones of the stage, so a
+ * stage can be timed in several steps (e.g., the layout of each page).
+ */
+class StageTimer {
+public:
+    StageTimer() { this->Start(); }
+
+    void Start()
+    {
+        m_allocations = s_allocationCount;
+        m_start = std::chrono::steady_clock::now();
+    }
+
+    double Stop(Stage &stage)
+    {
+        const double time
+            = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_start).count();
+        stage.m_time += time;
+        stage.m_allocations += s_allocationCount - m_allocations;
+        return time;
+    }
+
+private:
+    std::chrono::steady_clock::time_point m_start;
+    long m_allocations;
+};
+
+//----------------------------------------------------------------------------
+// Repeating the music of the corpus files
+//----------------------------------------------------------------------------
+
+/**
+ * Repeat the content of the first section, with a suffix added to the copied xml:ids and to the references to them.
+ */
+std::string repeatMEI(const std::string &data, int times)
+{
+    pugi::xml_document xml;
+    if (!xml.load_string(data.c_str(), pugi::parse_default | pugi::parse_declaration)) return data;
+    pugi::xml_node section = xml.select_node("//score/section").node();
+    if (!section) return data;
+
+    std::vector<pugi::xml_node> children;
+    std::vector<std::string> ids;
+    for (pugi::xml_node child : section.children()) {
+        children.push_back(child);
+        for (pugi::xpath_node node : child.select_nodes("descendant-or-self::*[@xml:id]")) {
+            ids.push_back(node.node().attribute("xml:id").value());
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+
+    for (int i = 1; i < times; ++i) {
+        const std::string suffix = vrv::StringFormat("-r%d", i);
+        for (pugi::xml_node child : children) {
+            pugi::xml_node copy = section.append_copy(child);
+            for (pugi::xpath_node node : copy.select_nodes("descendant-or-self::*")) {
+                for (pugi::xml_attribute attribute : node.node().attributes()) {
+                    if (std::string(attribute.name()) == "xml:id") {
+                        attribute.set_value((std::string(attribute.value()) + suffix).c_str());
+                        continue;
+                    }
+                    if (!strchr(attribute.value(), '#')) continue;
+                    // The references (e.g., @startid or @plist) to the copied elements
+                    std::istringstream references(attribute.value());
+                    std::string reference;
+                    std::string value;
+                    while (references >> reference) {
+                        if (!value.empty()) value += " ";
+                        value += reference;
+                        if ((reference[0] == '#')
+                            && std::binary_search(ids.begin(), ids.end(), reference.substr(1))) {
+                            value += suffix;
+                        }
+                    }
+                    attribute.set_value(value.c_str());
+                }
+            }
+        }
+    }
+
+    std::ostringstream output;
+    xml.save(output, "", pugi::format_raw);
+    return output.str();
+}
+
+/**
+ * Repeat the measures of each part, without the attributes of the first one.
+ */
+std::string repeatMusicXML(const std::string &data, int times)
+{
+    pugi::xml_document xml;
+    if (!xml.load_string(data.c_str(), pugi::parse_default | pugi::parse_declaration | pugi::parse_doctype)) {
+        return data;
+    }
+
+    for (pugi::xpath_node part : xml.select_nodes("/score-partwise/part")) {
+        std::vector<pugi::xml_node> measures;
+        for (pugi::xml_node measure : part.node().children("measure")) {
+            measures.push_back(measure);
+        }
+        for (int i = 1; i < times; ++i) {
+            for (pugi::xml_node measure : measures) {
+                pugi::xml_node copy = part.node().append_copy(measure);
+                const int n = measure.attribute("number").as_int();
+                if (n > 0) copy.attribute("number").set_value(n + i * (int)measures.size());
+                if (measure == measures.front()) {
+                    while (copy.child("attributes")) copy.remove_child("attributes");
+                }
+            }
+        }
+    }
+
+    std::ostringstream output;
+    xml.save(output, "", pugi::format_raw);
+    return output.str();
+}
+
+/**
+ * Repeat the lines between the first and the last barline, so the spines are the same at both ends.
+ */
+std::string repeatHumdrum(const std::string &data, int times)
+{
+    std::vector<std::string> lines;
+    std::istringstream input(data);
+    std::string line;
+    int first = -1;
+    int last = -1;
+    while (std::getline(input, line)) {
+        if (line.compare(0, 1, "=") == 0) {
+            if (first == -1) first = (int)lines.size();
+            last = (int)lines.size();
+        }
+        lines.push_back(line);
+    }
+    if (first == last) return data;
+
+    std::string output;
+    for (int i = 0; i < (int)lines.size(); ++i) {
+        if (i == last) {
+            for (int j = 1; j < times; ++j) {
+                for (int k = first; k < last; ++k) output += lines.at(k) + "\n";
+            }
+        }
+        output += lines.at(i) + "\n";
+    }
+    return output;
+}
+
+/**
+ * Repeat the body of the first tune, which are the lines after its K: field until an empty line.
+ */
+std::string repeatABC(const std::string &data, int times)
+{
+    std::vector<std::string> lines;
+    std::istringstream input(data);
+    std::string line;
+    int first = -1;
+    int end = -1;
+    while (std::getline(input, line)) {
+        if ((first == -1) && (line.compare(0, 2, "K:") == 0)) {
+            first = (int)lines.size() + 1;
+        }
+        else if ((first != -1) && (end == -1) && (line.find_first_not_of(" \r") == std::string::npos)) {
+            end = (int)lines.size();
+        }
+        lines.push_back(line);
+    }
+    if (first == -1) return data;
+    if (end == -1) end = (int)lines.size();
+
+    std::string output;
+    for (int i = 0; i < (int)lines.size(); ++i) {
+        if (i == end) {
+            for (int j = 1; j < times; ++j) {
+                for (int k = first; k < end; ++k) output += lines.at(k) + "\n";
+            }
+        }
+        output += lines.at(i) + "\n";
+    }
+    if (end == (int)lines.size()) {
+        for (int j = 1; j < times; ++j) {
+            for (int k = first; k < end; ++k) output += lines.at(k) + "\n";
+        }
+    }
+    return output;
+}
+
+/**
+ * Repeat the content of the @data: field. The field is limited to 1024 characters by the import.
+ */
+std::string repeatPAE(const std::string &data, int times)
+{
+    const size_t start = data.find("@data:");
+    if (start == std::string::npos) return data;
+    const size_t valueStart = start + 6;
+    const size_t valueEnd = std::min(data.find_first_of("\r\n", valueStart), data.size());
+
+    const std::string value = data.substr(valueStart, valueEnd - valueStart);
+    std::string output = data.substr(0, valueEnd);
+    for (int i = 1; i < times; ++i) output += value;
+    output += data.substr(valueEnd);
+    return output;
+}
+
+//----------------------------------------------------------------------------
+// Pipeline
+//----------------------------------------------------------------------------
+
+/**
+ * Return the SVG of a page without the ids, which are generated for the elements without one in the data and are
+ * different each time the data is loaded. They are in the id attributes, in the references and in some classes.
+ */
+std::string stripIds(const std::string &svg)
+{
+    static const std::regex ids("( id=\"[^\"]*\")|(#[^\" )]*)|([0-9]{16})");
+    return std::regex_replace(svg, ids, "");
+}
+
+/**
+ * Run the stages of the toolkit load and rendering on a document with the default options, each one timed
+ * separately. As with the toolkit, Humdrum data is imported through its conversion to MEI.
+ */
+bool runDocStages(const std::string &data, vrv::FileFormat format, BenchRun &run, const std::string &name)
+{
+    vrv::Doc doc;
+
+    //---------- import
+    StageTimer timer;
+    vrv::Input *input = NULL;
+    std::string meiData;
+    switch (format) {
+#ifndef NO_ABC_SUPPORT
+        case vrv::ABC: input = new vrv::ABCInput(&doc); break;
+#endif
+#ifndef NO_PAE_SUPPORT
+        case vrv::PAE: input = new vrv::PAEInput(&doc); break;
+#endif
+#ifndef NO_HUMDRUM_SUPPORT
+        case vrv::HUMDRUM: {
+            vrv::Doc humdrumDoc;
+            vrv::HumdrumInput humdrumInput(&humdrumDoc);
+            if (!humdrumInput.Import(data)) break;
+            vrv::MEIOutput meiOutput(&humdrumDoc);
+            meiOutput.SetScoreBasedMEI(true);
+            meiData = meiOutput.GetOutput();
+            input = new vrv::MEIInput(&doc);
+            break;
+        }
+#endif
+        case vrv::MEI: input = new vrv::MEIInput(&doc); break;
+        case vrv::MUSICXML: input = new vrv::MusicXmlInput(&doc); break;
+        default: break;
+    }
+    if (!input || !input->Import(meiData.empty() ? data : meiData)) {
+        std::cerr << "Cannot import " << name << std::endl;
+        delete input;
+        return false;
+    }
+    delete input;
+    timer.Stop(run.m_stages["import"]);
+
+    //---------- drawing preparation (with the header, the footer and the measure numbers of the default options)
+    timer.Start();
+    doc.GenerateFooter();
+    doc.GenerateHeader();
+    doc.GenerateMeasureNumbers();
+    doc.PrepareDrawing();
+    if (doc.IsMensuralMusicOnly()) doc.ConvertToCastOffMensuralDoc();
+    timer.Stop(run.m_stages["prepareDrawing"]);
+
+    //---------- cast-off (not done for transcriptions and facsimiles)
+    const bool isTranscription = ((doc.GetType() == vrv::Transcription) || (doc.GetType() == vrv::Facs));
+    timer.Start();
+    if (!isTranscription) doc.CastOffDoc();
+    timer.Stop(run.m_stages["castOff"]);
+
+    //---------- layout of each page
+    for (int i = 0; i < doc.GetPageCount(); ++i) {
+        timer.Start();
+        vrv::Page *page = doc.SetDrawingPage(i);
+        doc.SetCurrentScoreDefDoc();
+        if (isTranscription) {
+            page->LayOutTranscription();
+        }
+        else {
+            page->LayOut();
+        }
+        run.m_pageLayoutTimes.push_back(timer.Stop(run.m_stages["layout"]));
+    }
+
+    return true;
+}
+
+/**
+ * Run the pipeline of the toolkit on the data with the default options, with each stage timed separately.
+ * The pages of the progressive cast-off have to be the ones of the cast-off of the whole data, ids aside.
+ */
+bool runPipeline(const std::string &data, BenchRun &run, const std::string &name)
+{
+    vrv::Toolkit toolkit(false);
+
+    //---------- loading
+    StageTimer timer;
+    if (!toolkit.LoadData(data)) {
+        std::cerr << "Cannot load " << name << std::endl;
+        return false;
+    }
+    timer.Stop(run.m_stages["load"]);
+
+    //---------- layout and SVG of each page
+    std::vector<std::string> pages;
+    const int pageCount = toolkit.GetPageCount();
+    for (int i = 1; i <= pageCount; ++i) {
+        timer.Start();
+        const std::string svg = toolkit.RenderToSVG(i);
+        run.m_pageRenderTimes.push_back(timer.Stop(run.m_stages["svg"]));
+        pages.push_back(stripIds(svg));
+    }
+
+    //---------- MIDI (with the calculation of the timemap shared with the timemap output)
+    timer.Start();
+    toolkit.RenderToMIDI();
+    timer.Stop(run.m_stages["midi"]);
+
+    //---------- timemap
+    timer.Start();
+    toolkit.RenderToTimemap();
+    timer.Stop(run.m_stages["timemap"]);
+
+    //---------- SVG cache (filled by a first rendering of the pages)
+    const std::string castOffCache = toolkit.GetCastOffCache();
+    toolkit.SetOptions("{\"svgCacheSize\": 1000000000}");
+    for (int i = 1; i <= pageCount; ++i) toolkit.RenderToSVG(i);
+    timer.Start();
+    for (int i = 1; i <= pageCount; ++i) toolkit.RenderToSVG(i);
+    timer.Stop(run.m_stages["svgCache"]);
+
+    //---------- invalidation (the layout of the pages is done again)
+    timer.Start();
+    toolkit.SetOptions("{\"justifyVertically\": true}");
+    toolkit.RenderToSVG(1);
+    timer.Stop(run.m_stages["invalidation"]);
+
+    //---------- cast-off cache
+    vrv::Toolkit cacheToolkit(false);
+    timer.Start();
+    if (!cacheToolkit.LoadCastOffCache(castOffCache)) {
+        std::cerr << "Cannot load the cast-off cache of " << name << std::endl;
+        return false;
+    }
+    timer.Stop(run.m_stages["castOffCache"]);
+
+    //---------- progressive cast-off (until the first page)
+    vrv::Toolkit progressiveToolkit(false);
+    progressiveToolkit.SetOptions("{\"progressiveCastOff\": true}");
+    timer.Start();
+    if (!progressiveToolkit.LoadData(data)) {
+        std::cerr << "Cannot load " << name << " with a progressive cast-off" << std::endl;
+        return false;
+    }
+    std::vector<std::string> progressivePages;
+    progressivePages.push_back(stripIds(progressiveToolkit.RenderToSVG(1)));
+    timer.Stop(run.m_stages["progressiveCastOff"]);
+
+    // The page count is an estimation until the cast-off is completed
+    for (int i = 2; !progressiveToolkit.IsPageCountFinal() || (i <= progressiveToolkit.GetPageCount()); ++i) {
+        const std::string svg = progressiveToolkit.RenderToSVG(i);
+        if (svg.empty()) break;
+        progressivePages.push_back(stripIds(svg));
+    }
+    if (progressivePages.size() != pages.size()) {
+        std::cerr << "The progressive cast-off of " << name << " has " << progressivePages.size()
+                  << " pages instead of " << pages.size() << std::endl;
+        return false;
+    }
+    for (int i = 0; i < (int)pages.size(); ++i) {
+        if (progressivePages.at(i) == pages.at(i)) continue;
+        std::cerr << "The page " << i + 1 << " of the progressive cast-off of " << name
+                  << " differs from the one of the cast-off" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------
+// Benchmark
+//----------------------------------------------------------------------------
+
+double median(std::vector<double> values)
+{
+    if (values.empty()) return 0.0;
+    std::sort(values.begin(), values.end());
+    const size_t middle = values.size() / 2;
+    return (values.size() % 2) ? values.at(middle) : (values.at(middle - 1) + values.at(middle)) / 2.0;
+}
+
+/**
+ * Run the pipeline on a file the given number of times and return its result with the median time of each stage.
+ * The allocations are the ones of the first run, which is also the one for the peak RSS. The progress is reported on
+ * the standard error, so the results can be written to the standard output.
+ */
+bool benchmarkFile(const BenchFile &benchFile, int iterations, jsonxx::Object &result)
+{
+    std::ifstream file(benchFile.m_path.c_str());
+    if (!file.is_open()) {
+        std::cerr << "Cannot open " << benchFile.m_path << std::endl;
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string data = buffer.str();
+
+    vrv::Toolkit toolkit(false);
+    const vrv::FileFormat format = toolkit.IdentifyInputFrom(data);
+    if (benchFile.m_repeat > 1) {
+        switch (format) {
+            case vrv::MEI: data = repeatMEI(data, benchFile.m_repeat); break;
+            case vrv::MUSICXML: data = repeatMusicXML(data, benchFile.m_repeat); break;
+            case vrv::HUMDRUM: data = repeatHumdrum(data, benchFile.m_repeat); break;
+            case vrv::ABC: data = repeatABC(data, benchFile.m_repeat); break;
+            case vrv::PAE: data = repeatPAE(data, benchFile.m_repeat); break;
+            default: break;
+        }
+    }
+
+    std::vector<BenchRun> runs(iterations);
+    long peakRSS = 0;
+    for (int i = 0; i < iterations; ++i) {
+        if (i == 0) resetPeakRSS();
+        if (!runDocStages(data, format, runs.at(i), benchFile.m_path)) return false;
+        if (!runPipeline(data, runs.at(i), benchFile.m_path)) return false;
+        if (i == 0) peakRSS = getPeakRSS();
+    }
+
+    jsonxx::Object stages;
+    double totalTime = 0.0;
+    long totalAllocations = 0;
+    for (const std::string &name : docStageNames) {
+        std::vector<double> times;
+        for (BenchRun &run : runs) times.push_back(run.m_stages[name].m_time);
+        jsonxx::Object stage;
+        stage << "time" << median(times);
+        stage << "allocations" << runs.front().m_stages[name].m_allocations;
+        stages << name << stage;
+    }
+    for (const std::string &name : stageNames) {
+        std::vector<double> times;
+        for (BenchRun &run : runs) times.push_back(run.m_stages[name].m_time);
+        jsonxx::Object stage;
+        stage << "time" << median(times);
+        stage << "allocations" << runs.front().m_stages[name].m_allocations;
+        stages << name << stage;
+        totalTime += median(times);
+        totalAllocations += runs.front().m_stages[name].m_allocations;
+    }
+
+    jsonxx::Array pageLayoutTimes;
+    for (int i = 0; i < (int)runs.front().m_pageLayoutTimes.size(); ++i) {
+        std::vector<double> times;
+        for (BenchRun &run : runs) times.push_back(run.m_pageLayoutTimes.at(i));
+        pageLayoutTimes << median(times);
+    }
+
+    jsonxx::Array pageRenderTimes;
+    for (int i = 0; i < (int)runs.front().m_pageRenderTimes.size(); ++i) {
+        std::vector<double> times;
+        for (BenchRun &run : runs) times.push_back(run.m_pageRenderTimes.at(i));
+        pageRenderTimes << median(times);
+    }
+
+    jsonxx::Object total;
+    total << "time" << totalTime;
+    total << "allocations" << totalAllocations;
+
+    result << "name" << benchFile.m_name;
+    result << "file" << benchFile.m_path;
+    result << "repeat" << benchFile.m_repeat;
+    result << "size" << data.size();
+    result << "pages" << pageRenderTimes.size();
+    result << "stages" << stages;
+    result << "pageLayout" << pageLayoutTimes;
+    result << "pageRender" << pageRenderTimes;
+    result << "total" << total;
+    result << "peakRSS" << peakRSS;
+
+    std::cerr << benchFile.m_name << ": " << totalTime << " ms, " << pageRenderTimes.size() << " page(s), "
+              << totalAllocations << " allocations, " << peakRSS << " kB peak RSS" << std::endl;
+
+    return true;
+}
+
+/**
+ * Compare a value with its baseline and report it when it is above the threshold (in percent). Differences smaller
+ * than minDifference are ignored as noise.
+ */
+bool isRegression(const std::string &label, double baseline, double value, double threshold, double minDifference)
+{
+    if ((value <= baseline * (1.0 + threshold / 100.0)) || (value - baseline < minDifference)) return false;
+
+    const double increase = (baseline > 0.0) ? (value / baseline - 1.0) * 100.0 : 100.0;
+    std::cerr << "  " << label << ": " << baseline << " -> " << value << " (+" << increase << "%)" << std::endl;
+    return true;
+}
+
+/**
+ * Compare the results with the ones of a baseline file and return the number of regressions.
+ */
+int compareResults(const jsonxx::Object &results, const jsonxx::Object &baseline, double threshold)
+{
+    if (!baseline.has<jsonxx::Array>("files")) return 0;
+
+    std::map<std::string, const jsonxx::Object *> baselineFiles;
+    const jsonxx::Array &files = baseline.get<jsonxx::Array>("files");
+    for (size_t i = 0; i < files.size(); ++i) {
+        if (!files.has<jsonxx::Object>(i)) continue;
+        const jsonxx::Object &file = files.get<jsonxx::Object>(i);
+        if (file.has<jsonxx::String>("name")) baselineFiles[file.get<jsonxx::String>("name")] = &file;
+    }
+
+    int regressions = 0;
+    std::cerr << "Regressions above " << threshold << "%:" << std::endl;
+    const jsonxx::Array &resultFiles = results.get<jsonxx::Array>("files");
+    for (size_t i = 0; i < resultFiles.size(); ++i) {
+        const jsonxx::Object &file = resultFiles.get<jsonxx::Object>(i);
+        const std::string name = file.get<jsonxx::String>("name");
+        if (baselineFiles.count(name) == 0) continue;
+        const jsonxx::Object &baselineFile = *baselineFiles.at(name);
+
+        std::vector<std::string> names = docStageNames;
+        names.insert(names.end(), stageNames.begin(), stageNames.end());
+        names.push_back("total");
+        for (const std::string &stageName : names) {
+            const jsonxx::Object &stage = (stageName == "total")
+                ? file.get<jsonxx::Object>("total")
+                : file.get<jsonxx::Object>("stages").get<jsonxx::Object>(stageName);
+            const jsonxx::Object *baselineStage = NULL;
+            if (stageName == "total") {
+                if (baselineFile.has<jsonxx::Object>("total")) baselineStage = &baselineFile.get<jsonxx::Object>("total");
+            }
+            else if (baselineFile.has<jsonxx::Object>("stages")
+                && baselineFile.get<jsonxx::Object>("stages").has<jsonxx::Object>(stageName)) {
+                baselineStage = &baselineFile.get<jsonxx::Object>("stages").get<jsonxx::Object>(stageName);
+            }
+            if (!baselineStage) continue;
+
+            if (baselineStage->has<jsonxx::Number>("time")
+                && isRegression(name + " " + stageName + " time (ms)", baselineStage->get<jsonxx::Number>("time"),
+                    stage.get<jsonxx::Number>("time"), threshold, 1.0)) {
+                ++regressions;
+            }
+            if (baselineStage->has<jsonxx::Number>("allocations")
+                && isRegression(name + " " + stageName + " allocations",
+                    baselineStage->get<jsonxx::Number>("allocations"), stage.get<jsonxx::Number>("allocations"),
+                    threshold, 0.0)) {
+                ++regressions;
+            }
+        }
+
+        if (baselineFile.has<jsonxx::Number>("peakRSS") && (baselineFile.get<jsonxx::Number>("peakRSS") > 0)
+            && isRegression(name + " peak RSS (kB)", baselineFile.get<jsonxx::Number>("peakRSS"),
+                file.get<jsonxx::Number>("peakRSS"), threshold, 0.0)) {
+            ++regressions;
+        }
+    }
+    if (regressions == 0) std::cerr << "  none" << std::endl;
+
+    return regressions;
+}
+
+/**
+ * Read the files of the corpus, with their path relative to the one of the corpus file.
+ */
+bool readCorpus(const std::string &corpusPath, std::vector<BenchFile> &benchFiles)
+{
+    std::ifstream file(corpusPath.c_str());
+    jsonxx::Object corpus;
+    if (!file.is_open() || !corpus.parse(file) || !corpus.has<jsonxx::Array>("files")) {
+        std::cerr << "Cannot read the corpus file " << corpusPath << std::endl;
+        return false;
+    }
+
+    const size_t separator = corpusPath.find_last_of("/\\");
+    const std::string directory = (separator == std::string::npos) ? "" : corpusPath.substr(0, separator + 1);
+
+    const jsonxx::Array &files = corpus.get<jsonxx::Array>("files");
+    for (size_t i = 0; i < files.size(); ++i) {
+        if (!files.has<jsonxx::Object>(i)) continue;
+        const jsonxx::Object &entry = files.get<jsonxx::Object>(i);
+        if (!entry.has<jsonxx::String>("name") || !entry.has<jsonxx::String>("file")) continue;
+        BenchFile benchFile;
+        benchFile.m_name = entry.get<jsonxx::String>("name");
+        benchFile.m_path = directory + entry.get<jsonxx::String>("file");
+        benchFile.m_repeat = entry.has<jsonxx::Number>("repeat") ? (int)entry.get<jsonxx::Number>("repeat") : 1;
+        benchFiles.push_back(benchFile);
+    }
+    return true;
+}
+
+void display_usage()
+{
+    std::cout << "Verovio benchmark " << vrv::GetVersion() << std::endl << std::endl;
+    std::cout << "Example usage:" << std::endl << std::endl;
+    std::cout << " verovio-bench [-r resources] [-n iterations] [-o outfile] [-b baseline] corpus.json" << std::endl
+              << std::endl;
+    std::cout << "Options" << std::endl;
+    std::cout << " -b, --baseline <s>    Compare with the results of a previous run and exit with 1 on regressions"
+              << std::endl;
+    std::cout << " -h, --help            Display this message" << std::endl;
+    std::cout << " -n, --iterations <i>  Number of runs of each file, of which the median is kept (default is 5)"
+              << std::endl;
+    std::cout << " -o, --outfile <s>     Output JSON file name (default is the standard output)" << std::endl;
+    std::cout << " -r, --resources <s>   Path to SVG resources (default is " << vrv::Resources::GetPath() << ")"
+              << std::endl;
+    std::cout << " -t, --threshold <f>   Regression threshold in percent for the comparison (default is 10)"
+              << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    std::string baselinePath;
+    std::string outfile;
+    int iterations = 5;
+    double threshold = 10.0;
+
+    static struct option long_options[] = { { "baseline", required_argument, 0, 'b' },
+        { "help", no_argument, 0, 'h' }, { "iterations", required_argument, 0, 'n' },
+        { "outfile", required_argument, 0, 'o' }, { "resources", required_argument, 0, 'r' },
+        { "threshold", required_argument, 0, 't' }, { 0, 0, 0, 0 } };
+
+    int c;
+    int option_index = 0;
+    while ((c = getopt_long(argc, argv, "b:hn:o:r:t:", long_options, &option_index)) != -1) {
+        switch (c) {
+            case 'b': baselinePath = optarg; break;
+            case 'h': display_usage(); exit(0);
+            case 'n': iterations = std::max(1, atoi(optarg)); break;
+            case 'o': outfile = optarg; break;
+            case 'r': vrv::Resources::SetPath(optarg); break;
+            case 't': threshold = atof(optarg); break;
+            default: display_usage(); exit(1);
+        }
+    }
+
+    if (optind != argc - 1) {
+        std::cerr << "Expected one corpus file." << std::endl << std::endl;
+        display_usage();
+        exit(1);
+    }
+
+    std::vector<BenchFile> benchFiles;
+    if (!readCorpus(argv[optind], benchFiles)) exit(1);
+
+    // Read the baseline first since it can be the output file of the previous run
+    jsonxx::Object baseline;
+    if (!baselinePath.empty()) {
+        std::ifstream file(baselinePath.c_str());
+        if (!file.is_open() || !baseline.parse(file)) {
+            std::cerr << "Cannot read the baseline file " << baselinePath << std::endl;
+            exit(1);
+        }
+    }
+
+    if (!vrv::Resources::InitFonts()) {
+        std::cerr << "The music font could not be loaded; please check the resource path" << std::endl;
+        exit(1);
+    }
+    vrv::DisableLog();
+
+    jsonxx::Array files;
+    for (const BenchFile &benchFile : benchFiles) {
+        jsonxx::Object result;
+        if (!benchmarkFile(benchFile, iterations, result)) exit(1);
+        files << result;
+    }
+
+    jsonxx::Object results;
+    results << "version" << vrv::GetVersion();
+    results << "iterations" << iterations;
+    results << "files" << files;
+
+    if (outfile.empty()) {
+        std::cout << results.json() << std::endl;
+    }
+    else {
+        std::ofstream output(outfile.c_str());
+        if (!output.is_open()) {
+            std::cerr << "Cannot write " << outfile << std::endl;
+            exit(1);
+        }
+        output << results.json();
+    }
+
+    if (!baselinePath.empty() && (compareResults(results, baseline, threshold) > 0)) exit(1);
+
+    return 0;
+}
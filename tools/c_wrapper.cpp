@@ -62,18 +62,36 @@ const char *vrvToolkit_getAvailableOptions(Toolkit *tk)
     return tk->GetCString();
 }
 
+const char *vrvToolkit_getCastOffCache(Toolkit *tk)
+{
+    tk->SetCString(tk->GetCastOffCache());
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_getElementAttr(Toolkit *tk, const char *xmlId)
 {
     tk->SetCString(tk->GetElementAttr(xmlId));
     return tk->GetCString();
 }
 
+const char *vrvToolkit_getElementsAtPoint(Toolkit *tk, int page_no, int x, int y)
+{
+    tk->SetCString(tk->GetElementsAtPoint(page_no, x, y));
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_getElementsAtTime(Toolkit *tk, int millisec)
 {
     tk->SetCString(tk->GetElementsAtTime(millisec));
     return tk->GetCString();
 }
 
+const char *vrvToolkit_getElementsInRect(Toolkit *tk, int page_no, int x, int y, int width, int height)
+{
+    tk->SetCString(tk->GetElementsInRect(page_no, x, y, width, height));
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_getExpansionIdsForElement(Toolkit *tk, const char *xmlId)
 {
     tk->SetCString(tk->GetExpansionIdsForElement(xmlId));
@@ -92,6 +110,12 @@ const char *vrvToolkit_getLog(Toolkit *tk)
     return tk->GetCString();
 }
 
+const char *vrvToolkit_getMemoryUsage(Toolkit *tk)
+{
+    tk->SetCString(tk->GetMemoryUsage());
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_getMEI(Toolkit *tk, const char *options)
 {
     tk->SetCString(tk->GetMEI(options));
@@ -126,6 +150,12 @@ int vrvToolkit_getPageWithElement(Toolkit *tk, const char *xmlId)
     return tk->GetPageWithElement(xmlId);
 }
 
+const char *vrvToolkit_getSVGCacheStats(Toolkit *tk)
+{
+    tk->SetCString(tk->GetSVGCacheStats());
+    return tk->GetCString();
+}
+
 double vrvToolkit_getTimeForElement(Toolkit *tk, const char *xmlId)
 {
     return tk->GetTimeForElement(xmlId);
@@ -137,6 +167,23 @@ const char *vrvToolkit_getVersion(Toolkit *tk)
     return tk->GetCString();
 }
 
+const char *vrvToolkit_getWorks(Toolkit *tk, const char *data)
+{
+    tk->SetCString(tk->GetWorks(data));
+    return tk->GetCString();
+}
+
+bool vrvToolkit_isPageCountFinal(Toolkit *tk)
+{
+    return tk->IsPageCountFinal();
+}
+
+bool vrvToolkit_loadCastOffCache(Toolkit *tk, const char *cache)
+{
+    tk->ResetLogBuffer();
+    return tk->LoadCastOffCache(cache);
+}
+
 bool vrvToolkit_loadData(Toolkit *tk, const char *data)
 {
     tk->ResetLogBuffer();
@@ -157,6 +204,20 @@ const char *vrvToolkit_renderToSVG(Toolkit *tk, int page_no, const char *c_optio
     return tk->GetCString();
 }
 
+const char *vrvToolkit_renderToSVGDiff(Toolkit *tk, int page_no)
+{
+    tk->ResetLogBuffer();
+    tk->SetCString(tk->RenderToSVGDiff(page_no));
+    return tk->GetCString();
+}
+
+const char *vrvToolkit_renderToSVGRegion(Toolkit *tk, int page_no, int x, int y, int width, int height)
+{
+    tk->ResetLogBuffer();
+    tk->SetCString(tk->RenderToSVGRegion(page_no, x, y, width, height, false));
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_renderToTimemap(Toolkit *tk)
 {
     tk->ResetLogBuffer();
@@ -164,11 +225,23 @@ const char *vrvToolkit_renderToTimemap(Toolkit *tk)
     return tk->GetCString();
 }
 
+const char *vrvToolkit_renderToTimemapWithOptions(Toolkit *tk, const char *c_options)
+{
+    tk->ResetLogBuffer();
+    tk->SetCString(tk->RenderToTimemap(c_options));
+    return tk->GetCString();
+}
+
 void vrvToolkit_redoLayout(Toolkit *tk)
 {
     tk->RedoLayout();
 }
 
+void vrvToolkit_redoLayoutWithOptions(Toolkit *tk, const char *c_options)
+{
+    tk->RedoLayout(c_options);
+}
+
 void vrvToolkit_redoPagePitchPosLayout(Toolkit *tk)
 {
     tk->RedoPagePitchPosLayout();
@@ -190,4 +263,10 @@ void vrvToolkit_setOptions(Toolkit *tk, const char *options)
     }
 }
 
+bool vrvToolkit_switchSelection(Toolkit *tk, const char *selection)
+{
+    tk->ResetLogBuffer();
+    return tk->SwitchSelection(selection);
+}
+
 } // extern C
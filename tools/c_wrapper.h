@@ -14,24 +14,37 @@ void *vrvToolkit_constructorResourcePath(const char * resourcePath);
 void vrvToolkit_destructor(Toolkit *tk);
 bool vrvToolkit_edit(Toolkit *tk, const char *editorAction);
 const char *vrvToolkit_getAvailableOptions(Toolkit *tk);
+const char *vrvToolkit_getCastOffCache(Toolkit *tk);
 const char *vrvToolkit_getElementAttr(Toolkit *tk, const char *xmlId);
+const char *vrvToolkit_getElementsAtPoint(Toolkit *tk, int page_no, int x, int y);
 const char *vrvToolkit_getElementsAtTime(Toolkit *tk, int millisec);
+const char *vrvToolkit_getElementsInRect(Toolkit *tk, int page_no, int x, int y, int width, int height);
 const char *vrvToolkit_getExpansionIdsForElement(Toolkit *tk, const char *xmlId);
 const char *vrvToolkit_getHumdrum(Toolkit *tk);
 const char *vrvToolkit_getLog(Toolkit *tk);
 const char *vrvToolkit_getMEI(Toolkit *tk, const char *options);
+const char *vrvToolkit_getMemoryUsage(Toolkit *tk);
 const char *vrvToolkit_getMIDIValuesForElement(Toolkit *tk, const char *xmlId);
 const char *vrvToolkit_getNotatedIdForElement(Toolkit *tk, const char *xmlId);
 const char *vrvToolkit_getOptions(Toolkit *tk, bool default_values);
 int vrvToolkit_getPageCount(Toolkit *tk);
 int vrvToolkit_getPageWithElement(Toolkit *tk, const char *xmlId);
+const char *vrvToolkit_getSVGCacheStats(Toolkit *tk);
 double vrvToolkit_getTimeForElement(Toolkit *tk, const char *xmlId);
 const char *vrvToolkit_getVersion(Toolkit *tk);
+const char *vrvToolkit_getWorks(Toolkit *tk, const char *data);
+bool vrvToolkit_isPageCountFinal(Toolkit *tk);
+bool vrvToolkit_loadCastOffCache(Toolkit *tk, const char *cache);
 bool vrvToolkit_loadData(Toolkit *tk, const char *data);
 const char *vrvToolkit_renderToMIDI(Toolkit *tk, const char *c_options);
 const char *vrvToolkit_renderToSVG(Toolkit *tk, int page_no, const char *c_options);
+const char *vrvToolkit_renderToSVGDiff(Toolkit *tk, int page_no);
+const char *vrvToolkit_renderToSVGRegion(Toolkit *tk, int page_no, int x, int y, int width, int height);
 const char *vrvToolkit_renderToTimemap(Toolkit *tk);
+const char *vrvToolkit_renderToTimemapWithOptions(Toolkit *tk, const char *c_options);
 void vrvToolkit_redoLayout(Toolkit *tk);
+void vrvToolkit_redoLayoutWithOptions(Toolkit *tk, const char *c_options);
 void vrvToolkit_redoPagePitchPosLayout(Toolkit *tk);
 const char *vrvToolkit_renderData(Toolkit *tk, const char *data, const char *options);
 void vrvToolkit_setOptions(Toolkit *tk, const char *options);
+bool vrvToolkit_switchSelection(Toolkit *tk, const char *selection);
@@ -118,6 +118,7 @@ void display_usage()
     std::cout << " -x, --xml-id-seed <i> Seed the random number generator for XML IDs" << std::endl;
     
     std::cout << std::endl << "Additional long options" << std::endl;
+    std::cout << "--memory-usage         Write the approximate memory usage as JSON to the standard error" << std::endl;
     std::cout << "--remove-ids           Remove in the MEI output XML IDs that are not referenced " << std::endl;
 
     vrv::Options options;
@@ -197,6 +198,7 @@ int main(int argc, char **argv)
     std::string outformat = "svg";
     bool std_output = false;
     bool remove_ids = false;
+    bool memory_usage = false;
 
     int all_pages = 0;
     int page = 1;
@@ -227,6 +229,7 @@ int main(int argc, char **argv)
             { "xml-id-seed", required_argument, 0, 'x' },
             // mei output - long options only
             { "remove-ids", no_argument, 0, 'm' },
+            { "memory-usage", no_argument, 0, 'm' },
             { 0, 0, 0, 0 }
         };
 
@@ -333,6 +336,9 @@ int main(int argc, char **argv)
                 if (!strcmp(long_options[option_index].name, "remove-ids")) {
                     remove_ids = true;
                 }
+                else if (!strcmp(long_options[option_index].name, "memory-usage")) {
+                    memory_usage = true;
+                }
                 break;
 
             case 'o': outfile = std::string(optarg); break;
@@ -577,6 +583,10 @@ int main(int argc, char **argv)
         }
     }
 
+    if (memory_usage) {
+        std::cerr << toolkit.GetMemoryUsage() << std::endl;
+    }
+
     free(long_options);
     return 0;
 }